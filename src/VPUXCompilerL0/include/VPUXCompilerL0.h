@@ -121,17 +121,33 @@ typedef struct __vcl_compiler_desc_t {
 
 } vcl_compiler_desc_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Flag of the num of data elements in modelIRData, which marks that the weights
+///        are passed by reference instead of being copied into modelIRData
+#define VCL_IR_WEIGHTS_BY_REFERENCE 0x80000000u
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Defines weights passed by reference
+typedef struct __vcl_weights_desc_t {
+    const uint8_t* data;  ///< Weights memory, must stay valid until vclExecutableCreate returns
+    uint64_t size;        ///< Size of weights
+} vcl_weights_desc_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Defines executable description to be passed during executable
 ///        creation
 ///
 ///        Format of modelIRData (defined in L0 adaptor):
 ///        1. API version : vcl_version_info_t
-///        2. Num of data elements (now only xml + weights = 2) : uint32_t
+///        2. Num of data elements (now only xml + weights = 2) : uint32_t,
+///           may be combined with VCL_IR_WEIGHTS_BY_REFERENCE flag since 2.2
 ///        3. Size of data 1 (xml) : uint64_t
 ///        4. Data 1 : $2 bytes
 ///        5. Size of data 2 (weights) : uint64_t
 ///        6. Data 2 : $4 bytes
+///
+///        If VCL_IR_WEIGHTS_BY_REFERENCE flag is set, data 2 is vcl_weights_desc_t
+///        and its size is sizeof(vcl_weights_desc_t)
 typedef struct __vcl_executable_desc_t {
     const uint8_t* modelIRData;
     uint64_t modelIRSize;  ///< Size of modelIRData
@@ -28,7 +28,7 @@
 #define str(s) #s
 
 #define COMPILER_MAJOR 2
-#define COMPILER_MINOR 1
+#define COMPILER_MINOR 2
 static const char* COMPILER_VERSION = xstr(COMPILER_MAJOR) "." xstr(COMPILER_MINOR);
 
 #define PROFILING_MAJOR 1
@@ -359,7 +359,8 @@ private:
     Compiler::Ptr _compiler = NULL;
     vcl_compiler_properties_t _compilerProp;
     vcl_compiler_desc_t _compilerDesc;
-    std::mutex _mlock;
+    // Shared by all the compilations of the compiler handle, ov::Core::read_model is thread-safe
+    ov::Core _core;
     Logger _logger;
 };
 
@@ -390,17 +391,17 @@ std::pair<VPUXExecutableL0*, vcl_result_t> VPUXCompilerL0::importNetworkV1(const
         return std::pair<VPUXExecutableL0*, vcl_result_t>(nullptr, VCL_RESULT_ERROR_INVALID_ARGUMENT);
     }
 
-    std::string modelData(buffer, buffer + bufferSize);
+    // The weights are wrapped without copy, they stay in the IR memory until the model is compiled
     ov::runtime::Tensor weightsTensor;
     if (weightsSize > 0)
         weightsTensor = ov::runtime::Tensor(ov::element::u8, {weightsSize}, const_cast<uint8_t*>(weights));
-    ov::Core core;
 
     StopWatch stopWatch;
     if (enableProfiling)
         stopWatch.start();
 
-    auto model = core.read_model(modelData, weightsTensor);
+    // ov::Core::read_model needs an owning string, the temporary copy of the xml is released right after parsing
+    auto model = _core.read_model(std::string(buffer, buffer + bufferSize), weightsTensor);
     InferenceEngine::CNNNetwork cnnNet(std::const_pointer_cast<ngraph::Function>(model));
 
     if (enableProfiling) {
@@ -480,15 +481,15 @@ std::pair<VPUXExecutableL0*, vcl_result_t> VPUXCompilerL0::importNetworkV2(const
         return std::pair<VPUXExecutableL0*, vcl_result_t>(nullptr, VCL_RESULT_ERROR_INVALID_ARGUMENT);
     }
 
-    std::string modelData(buffer, buffer + bufferSize);
+    // The weights are wrapped without copy, they stay in the IR memory until the model is compiled
     ov::runtime::Tensor weightsTensor;
     if (weightsSize > 0)
         weightsTensor = ov::runtime::Tensor(ov::element::u8, {weightsSize}, const_cast<uint8_t*>(weights));
-    ov::Core core;
     StopWatch stopWatch;
     if (enableProfiling)
         stopWatch.start();
-    auto model = core.read_model(modelData, weightsTensor);
+    // ov::Core::read_model needs an owning string, the temporary copy of the xml is released right after parsing
+    auto model = _core.read_model(std::string(buffer, buffer + bufferSize), weightsTensor);
     if (enableProfiling) {
         stopWatch.stop();
         _logger.info("ReadNetwork time: {0} ms", stopWatch.delta_ms());
@@ -997,6 +998,8 @@ DLLEXPORT vcl_result_t vclExecutableCreate(vcl_compiler_handle_t compiler, vcl_e
     offset += sizeof(vcl_version_info_t);
     uint32_t numOfElements = 0;
     memcpy(&numOfElements, modelIR + offset, sizeof(numOfElements));
+    const bool weightsByReference = (numOfElements & VCL_IR_WEIGHTS_BY_REFERENCE) != 0;
+    numOfElements &= ~VCL_IR_WEIGHTS_BY_REFERENCE;
     if (numOfElements >= maxNumberOfElements) {
         VPUXCompilerL0::vclLogger.error("Bad elements number in IR!");
         return VCL_RESULT_ERROR_INVALID_IR;
@@ -1023,6 +1026,21 @@ DLLEXPORT vcl_result_t vclExecutableCreate(vcl_compiler_handle_t compiler, vcl_e
         VPUXCompilerL0::vclLogger.error("The IR content and size mismatch!");
         return VCL_RESULT_ERROR_INVALID_IR;
     }
+    if (weightsByReference) {
+        // The weights stay in the caller memory, so they are not copied neither by the caller nor here
+        if (weightsSize != sizeof(vcl_weights_desc_t)) {
+            VPUXCompilerL0::vclLogger.error("Bad weights descriptor size in IR!");
+            return VCL_RESULT_ERROR_INVALID_IR;
+        }
+        vcl_weights_desc_t weightsDesc;
+        memcpy(&weightsDesc, weights, sizeof(weightsDesc));
+        if (weightsDesc.size >= maxSizeOfWeights || (weightsDesc.data == NULL && weightsDesc.size != 0)) {
+            VPUXCompilerL0::vclLogger.error("Bad weights descriptor in IR!");
+            return VCL_RESULT_ERROR_INVALID_IR;
+        }
+        weights = weightsDesc.data != NULL ? weightsDesc.data : modelIR + offset;
+        weightsSize = weightsDesc.size;
+    }
 
     VPUXCompilerL0::IOInfoV1 ioInfoV1;
     VPUXCompilerL0::IOInfoV2 ioInfoV2;
@@ -27,6 +27,8 @@ public:
     ~CompilerTest() {
     }
     vcl_result_t init(const char* netName, const char* weightName);
+    void serializeIR(const vcl_version_info_t& version, bool weightsByReference);
+    void serializeIR(bool weightsByReference);
     vcl_result_t run(const std::string& options);
     void TestBody() override{};
     void SetUp() override;
@@ -42,6 +44,9 @@ public:
 private:
     std::vector<uint8_t> modelIR;
     size_t modelIRSize;
+    vcl_version_info_t irVersion = {};
+    std::vector<uint8_t> xmlBuffer;
+    std::vector<uint8_t> weightsBuffer;
 };
 
 vcl_result_t CompilerTest::init(const char* netName, const char* weightName) {
@@ -91,7 +96,43 @@ vcl_result_t CompilerTest::init(const char* netName, const char* weightName) {
         vclCompilerDestroy(compiler);
     }
 
+    xmlBuffer.resize(xmlSize);
+    nifs.read(reinterpret_cast<char*>(xmlBuffer.data()), xmlSize);
+    if (nifs.fail()) {
+        std::cerr << "Short read on network buffer!" << std::endl;
+        return VCL_RESULT_ERROR_IO;
+    }
+
+    weightsBuffer.resize(weightsSize);
+    if (weightsSize != 0) {
+        wifs.seekg(0, wifs.beg);
+        wifs.read(reinterpret_cast<char*>(weightsBuffer.data()), weightsSize);
+
+        if (wifs.fail()) {
+            std::cerr << "Short read on weights file!" << std::endl;
+            return VCL_RESULT_ERROR_IO;
+        }
+    }
+
+    serializeIR(version, false);
+    return VCL_RESULT_SUCCESS;
+}
+
+void CompilerTest::serializeIR(const vcl_version_info_t& version, bool weightsByReference) {
+    irVersion = version;
+
+    // With VCL_IR_WEIGHTS_BY_REFERENCE the weights stay in weightsBuffer and only their descriptor is serialized
+    const vcl_weights_desc_t weightsDesc = {weightsBuffer.data(), weightsBuffer.size()};
+
     uint32_t numberOfInputData = 2;
+    if (weightsByReference) {
+        numberOfInputData |= VCL_IR_WEIGHTS_BY_REFERENCE;
+    }
+    const uint64_t xmlSize = xmlBuffer.size();
+    const uint64_t weightsSize = weightsByReference ? sizeof(weightsDesc) : weightsBuffer.size();
+    const uint8_t* weightsData =
+            weightsByReference ? reinterpret_cast<const uint8_t*>(&weightsDesc) : weightsBuffer.data();
+
     modelIRSize =
             sizeof(version) + sizeof(numberOfInputData) + sizeof(xmlSize) + xmlSize + sizeof(weightsSize) + weightsSize;
     modelIR.resize(modelIRSize);
@@ -103,29 +144,19 @@ vcl_result_t CompilerTest::init(const char* netName, const char* weightName) {
     offset += sizeof(numberOfInputData);
     memcpy(modelIR.data() + offset, &xmlSize, sizeof(xmlSize));
     offset += sizeof(xmlSize);
-    uint8_t* xmlData = modelIR.data() + offset;
-
-    nifs.read(reinterpret_cast<char*>(xmlData), xmlSize);
-    if (nifs.fail()) {
-        std::cerr << "Short read on network buffer!" << std::endl;
-        return VCL_RESULT_ERROR_IO;
+    if (xmlSize != 0) {
+        memcpy(modelIR.data() + offset, xmlBuffer.data(), xmlSize);
     }
-
     offset += xmlSize;
     memcpy(modelIR.data() + offset, &weightsSize, sizeof(weightsSize));
     offset += sizeof(weightsSize);
-    uint8_t* weights = NULL;
     if (weightsSize != 0) {
-        weights = modelIR.data() + offset;
-        wifs.seekg(0, wifs.beg);
-        wifs.read(reinterpret_cast<char*>(weights), weightsSize);
-
-        if (wifs.fail()) {
-            std::cerr << "Short read on weights file!" << std::endl;
-            return VCL_RESULT_ERROR_IO;
-        }
+        memcpy(modelIR.data() + offset, weightsData, weightsSize);
     }
-    return VCL_RESULT_SUCCESS;
+}
+
+void CompilerTest::serializeIR(bool weightsByReference) {
+    serializeIR(irVersion, weightsByReference);
 }
 
 vcl_result_t CompilerTest::run(const std::string& options) {
@@ -279,6 +310,12 @@ TEST_P(CompilerTest, compilerTest) {
     EXPECT_EQ(run(getNetOptions()), VCL_RESULT_SUCCESS);
 }
 
+TEST_P(CompilerTest, compilerTestWeightsByReference) {
+    // The weights are not copied into modelIR, the compiler reads them from the caller memory
+    serializeIR(true);
+    EXPECT_EQ(run(getNetOptions()), VCL_RESULT_SUCCESS);
+}
+
 const auto cidTool = CompilerTest::getCidToolPath();
 const auto smoke_ir_infos = CompilerTest::readJson2Vec(cidTool + VpuxCompilerL0TestsUtils::SMOKE_TEST_CONFIG);
 const auto ir_infos = CompilerTest::readJson2Vec(cidTool + VpuxCompilerL0TestsUtils::TEST_CONFIG);
@@ -9,7 +9,10 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <mutex>
@@ -32,6 +35,8 @@ public:
     }
     vcl_result_t init(const char* netName, const char* weightName);
     vcl_result_t run(const std::string& options);
+    vcl_result_t benchmark(const std::string& options, size_t numThreads, size_t numCompilations,
+                           double& compilationsPerSecond);
 
     bool check() const;
     size_t getOutputSize() const {
@@ -39,6 +44,7 @@ public:
     }
     void TestBody() override{};
     void Run();
+    void RunBenchmark();
     void SetUp() override;
     static std::string getTestCaseName(const testing::TestParamInfo<compilerThreadParams>& obj) {
         auto param = obj.param;
@@ -227,6 +233,55 @@ vcl_result_t CompilerTestThread::run(const std::string& options) {
     return ret;
 }
 
+/* Compiles the same IR numCompilations times with numThreads threads sharing one compiler handle. */
+vcl_result_t CompilerTestThread::benchmark(const std::string& options, size_t numThreads, size_t numCompilations,
+                                           double& compilationsPerSecond) {
+    vcl_compiler_desc_t compilerDesc = {VCL_PLATFORM_VPU3700, 0};
+    vcl_compiler_handle_t compiler = NULL;
+    vcl_result_t ret = vclCompilerCreate(compilerDesc, &compiler);
+    if (ret) {
+        std::cerr << "Failed to create compiler! Result:0x" << std::hex << uint64_t(ret) << std::dec << std::endl;
+        return ret;
+    }
+
+    vcl_executable_desc_t exeDesc = {modelIR.data(), modelIRSize, options.c_str(), options.size() + 1};
+
+    std::atomic<size_t> nextCompilation{0};
+    std::vector<vcl_result_t> res(numThreads, VCL_RESULT_SUCCESS);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+        threads.emplace_back([&, i] {
+            while (nextCompilation++ < numCompilations && res[i] == VCL_RESULT_SUCCESS) {
+                vcl_executable_handle_t executable = NULL;
+                res[i] = vclExecutableCreate(compiler, exeDesc, &executable);
+                if (res[i] == VCL_RESULT_SUCCESS) {
+                    res[i] = vclExecutableDestroy(executable);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    compilationsPerSecond = static_cast<double>(numCompilations) / elapsed.count();
+
+    vclCompilerDestroy(compiler);
+
+    for (auto i = res.begin(); i != res.end(); ++i) {
+        if (*i != VCL_RESULT_SUCCESS) {
+            std::cerr << "Failed to compile with " << std::distance(res.begin(), i) << " thread!" << std::endl;
+            std::cerr << "Result:0x" << std::hex << uint64_t(*i) << std::dec << std::endl;
+            return *i;
+        }
+    }
+    return VCL_RESULT_SUCCESS;
+}
+
 bool CompilerTestThread::check() const {
     const size_t count = outputs.size();
     if (count == 0) {
@@ -344,10 +399,38 @@ void CompilerTestThread::Run() {
     EXPECT_EQ(check(), true);
 }
 
+void CompilerTestThread::RunBenchmark() {
+    // The benchmark takes a while, so it is executed on demand only
+    const char* numCompilationsEnv = std::getenv("VCL_BENCHMARK_COMPILATIONS");
+    if (numCompilationsEnv == nullptr) {
+        GTEST_SKIP() << "VCL_BENCHMARK_COMPILATIONS is not set. Skipping the throughput benchmark";
+    }
+    const size_t numCompilations = std::max<size_t>(std::strtoul(numCompilationsEnv, nullptr, 10), 1);
+    const size_t maxThreads = std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+
+    double singleThreadThroughput = 0.0;
+    for (size_t numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+        double throughput = 0.0;
+        const vcl_result_t ret = benchmark(getNetOptions(), numThreads, numCompilations, throughput);
+        ASSERT_EQ(ret, VCL_RESULT_SUCCESS) << "Failed to run benchmark with " << numThreads << " threads!";
+
+        if (numThreads == 1) {
+            singleThreadThroughput = throughput;
+        }
+        std::cout << "Threads: " << numThreads << " compilations: " << numCompilations
+                  << " throughput: " << throughput << " compilations/s"
+                  << " speedup: " << throughput / singleThreadThroughput << std::endl;
+    }
+}
+
 TEST_P(CompilerTestThread, threadTest) {
     Run();
 }
 
+TEST_P(CompilerTestThread, throughputBenchmark) {
+    RunBenchmark();
+}
+
 const auto cidTool = CompilerTestThread::getCidToolPath();
 const auto smoke_ir_infos = CompilerTestThread::readJson2Vec(cidTool + VpuxCompilerL0TestsUtils::SMOKE_TEST_CONFIG);
 const auto ir_infos = CompilerTestThread::readJson2Vec(cidTool + VpuxCompilerL0TestsUtils::TEST_CONFIG);
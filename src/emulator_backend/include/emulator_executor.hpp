@@ -7,6 +7,7 @@
 
 #include "vpux.hpp"
 #include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/plugin/profiling_aggregator.hpp"
 
 #include <emu/manager.hpp>
 
@@ -21,7 +22,8 @@ namespace vpux {
 
 class EmulatorExecutor final : public vpux::Executor {
 public:
-    EmulatorExecutor(const vpux::NetworkDescription::Ptr& network, const vpux::Config& config);
+    EmulatorExecutor(const vpux::NetworkDescription::Ptr& network, const vpux::Config& config,
+                     const std::shared_ptr<profiling::HostOverheadAggregator>& hostOverhead = nullptr);
 
     void setup(const InferenceEngine::ParamMap&) final {
     }
@@ -37,18 +39,20 @@ public:
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getLayerStatistics() final {
         return {};
     }
-    InferenceEngine::Parameter getParameter(const std::string&) const final {
-        return {};
+    InferenceEngine::Parameter getParameter(const std::string& paramName) const final;
+    profiling::HostOverheadAggregator* getHostOverheadAggregator() const final {
+        return _hostOverhead.get();
     }
     Executor::Ptr clone() const override;
 
 private:
-    ie::Blob::Ptr repackTensor(const ie::Blob::Ptr&, const ie::TensorDesc&);
-
     Logger _logger;
     Config _config;
     vpux::NetworkDescription::Ptr _network;
     mv::emu::Manager _manager;
+    // Shared with the clones, so the statistics cover all infer requests of the network.
+    // Created only if COLLECT_HOST_OVERHEAD_STATISTICS is enabled.
+    std::shared_ptr<profiling::HostOverheadAggregator> _hostOverhead;
 };
 
 }  // namespace vpux
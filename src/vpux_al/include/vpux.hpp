@@ -27,6 +27,10 @@
 
 namespace vpux {
 
+namespace profiling {
+class HostOverheadAggregator;
+}  // namespace profiling
+
 bool isBlobAllocatedByAllocator(const InferenceEngine::Blob::Ptr& blob,
                                 const std::shared_ptr<InferenceEngine::IAllocator>& allocator);
 
@@ -191,6 +195,11 @@ public:
     virtual std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getLayerStatistics() = 0;
     virtual InferenceEngine::Parameter getParameter(const std::string& paramName) const = 0;
 
+    // Host-side stage durations, shared by the executor and all its clones. nullptr if not collected by the backend
+    virtual profiling::HostOverheadAggregator* getHostOverheadAggregator() const {
+        return nullptr;
+    }
+
     virtual ~Executor() = default;
 };
 
@@ -0,0 +1,34 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/utils/IE/blob.hpp"
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/optional.hpp"
+
+#include <ie_blob.h>
+#include <ie_layouts.h>
+
+namespace vpux {
+
+//
+// Repacking of the user blobs into the device precision and layout, shared by the backends
+//
+
+// Converts the user input into the precision and layout of the device tensor, the result is written to destData.
+// The precision conversion goes to a temporary blob, if the layout has to be converted as well.
+void prepareInputForInference(const InferenceEngine::Blob::Ptr& userInput,
+                              const InferenceEngine::TensorDesc& deviceTensorDesc, void* destData,
+                              const Optional<QuantizationParam>& quantParam, Logger logger);
+
+// Returns the blob with the precision and layout of the target descriptor, each conversion allocates a new blob.
+// The tensor itself is returned, if no conversion is needed.
+InferenceEngine::MemoryBlob::Ptr repackTensor(const InferenceEngine::Blob::Ptr& tensor,
+                                              const InferenceEngine::TensorDesc& targetDesc, Logger logger);
+
+}  // namespace vpux
@@ -96,6 +96,28 @@ struct LOG_LEVEL final : OptionBase<LOG_LEVEL, LogLevel> {
     }
 };
 
+//
+// LOG_ASYNC
+//
+
+struct LOG_ASYNC final : OptionBase<LOG_ASYNC, bool> {
+    static StringRef key() {
+        return ov::intel_vpux::log_async.name();
+    }
+
+    static StringRef envVar() {
+        return "IE_VPUX_LOG_ASYNC";
+    }
+
+    static bool defaultValue() {
+        return false;
+    }
+
+    static bool isPublic() {
+        return false;
+    }
+};
+
 //
 // PLATFORM
 //
@@ -296,4 +296,86 @@ struct USE_ELF_COMPILER_BACKEND final : OptionBase<USE_ELF_COMPILER_BACKEND, boo
     }
 };
 
+//
+// COMPILED_BLOB_CACHE_DIR
+//
+
+struct COMPILED_BLOB_CACHE_DIR final : OptionBase<COMPILED_BLOB_CACHE_DIR, std::string> {
+    static StringRef key() {
+        return ov::intel_vpux::compiled_blob_cache_dir.name();
+    }
+
+    static StringRef envVar() {
+        return "IE_VPUX_COMPILED_BLOB_CACHE_DIR";
+    }
+
+    static std::string defaultValue() {
+        return {};
+    }
+
+    static OptionMode mode() {
+        return OptionMode::CompileTime;
+    }
+
+    static bool isPublic() {
+        return false;
+    }
+};
+
+//
+// COMPILED_BLOB_CACHE_SIZE_MB
+//
+
+struct COMPILED_BLOB_CACHE_SIZE_MB final : OptionBase<COMPILED_BLOB_CACHE_SIZE_MB, int64_t> {
+    static StringRef key() {
+        return ov::intel_vpux::compiled_blob_cache_size_mb.name();
+    }
+
+    static StringRef envVar() {
+        return "IE_VPUX_COMPILED_BLOB_CACHE_SIZE_MB";
+    }
+
+    static int64_t defaultValue() {
+        return 1024;
+    }
+
+    static void validateValue(int64_t v) {
+        VPUX_THROW_UNLESS(v > 0, "Attempt to set invalid compiled blob cache size: '{0}', positive value expected", v);
+    }
+
+    static OptionMode mode() {
+        return OptionMode::CompileTime;
+    }
+
+    static bool isPublic() {
+        return false;
+    }
+};
+
+//
+// COMPILER_TELEMETRY_FILE
+//
+
+struct COMPILER_TELEMETRY_FILE final : OptionBase<COMPILER_TELEMETRY_FILE, std::string> {
+    static StringRef key() {
+        return ov::intel_vpux::compiler_telemetry_file.name();
+    }
+
+    static StringRef envVar() {
+        return "IE_VPUX_COMPILER_TELEMETRY_FILE";
+    }
+
+    static std::string defaultValue() {
+        return {};
+    }
+
+    static OptionMode mode() {
+        return OptionMode::CompileTime;
+    }
+
+    static bool isPublic() {
+        return false;
+    }
+};
+
 }  // namespace vpux
@@ -298,6 +298,42 @@ struct PROFILING_OUTPUT_FILE final : OptionBase<PROFILING_OUTPUT_FILE, std::stri
     }
 };
 
+//
+// COLLECT_PROFILING_STATISTICS
+//
+
+struct COLLECT_PROFILING_STATISTICS final : OptionBase<COLLECT_PROFILING_STATISTICS, bool> {
+    static StringRef key() {
+        return ov::intel_vpux::collect_profiling_statistics.name();
+    }
+
+    static bool defaultValue() {
+        return false;
+    }
+
+    static OptionMode mode() {
+        return OptionMode::RunTime;
+    }
+};
+
+//
+// COLLECT_HOST_OVERHEAD_STATISTICS
+//
+
+struct COLLECT_HOST_OVERHEAD_STATISTICS final : OptionBase<COLLECT_HOST_OVERHEAD_STATISTICS, bool> {
+    static StringRef key() {
+        return ov::intel_vpux::collect_host_overhead_statistics.name();
+    }
+
+    static bool defaultValue() {
+        return false;
+    }
+
+    static OptionMode mode() {
+        return OptionMode::RunTime;
+    }
+};
+
 //
 // MODEL_PRIORITY
 //
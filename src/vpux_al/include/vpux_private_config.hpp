@@ -147,6 +147,21 @@ DECLARE_VPUX_CONFIG_VALUE(JSON);
  */
 DECLARE_VPUX_CONFIG_KEY(PROFILING_OUTPUT_FILE);
 
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: "YES", "NO", default is "NO".
+ * Accumulate the profiling output of every inference into the statistics returned by
+ * the VPUX_PROFILING_STATISTICS metric. Requires PERF_COUNT.
+ */
+DECLARE_VPUX_CONFIG_KEY(COLLECT_PROFILING_STATISTICS);
+
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: "YES", "NO", default is "NO".
+ * Time the host-side stages of every inference for the VPUX_HOST_OVERHEAD_STATISTICS metric.
+ */
+DECLARE_VPUX_CONFIG_KEY(COLLECT_HOST_OVERHEAD_STATISTICS);
+
 /**
  * @brief [Only for VPUX Plugin]
  * Type: String. Default is "NO".
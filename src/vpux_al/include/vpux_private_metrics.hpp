@@ -20,5 +20,24 @@ namespace Metrics {
  */
 DECLARE_VPUX_METRIC_KEY(BACKEND_NAME, std::string);
 
+/**
+ * @brief Metrics to get the number of hits, misses and loaded bytes of the plugin-side compiled network cache
+ */
+DECLARE_VPUX_METRIC_KEY(COMPILED_BLOB_CACHE_HITS, uint64_t);
+DECLARE_VPUX_METRIC_KEY(COMPILED_BLOB_CACHE_MISSES, uint64_t);
+DECLARE_VPUX_METRIC_KEY(COMPILED_BLOB_CACHE_BYTES, uint64_t);
+
+/**
+ * @brief Metric to get per-task and per-layer duration percentiles and engines utilization,
+ * accumulated over all profiled inferences of the network. The statistics are returned as JSON string.
+ */
+DECLARE_VPUX_METRIC_KEY(PROFILING_STATISTICS, std::string);
+
+/**
+ * @brief Metric to get duration percentiles of the host-side inference stages (preprocessing, repack, push, pull),
+ * accumulated over all infer requests of the network. The statistics are returned as JSON string.
+ */
+DECLARE_VPUX_METRIC_KEY(HOST_OVERHEAD_STATISTICS, std::string);
+
 }  // namespace Metrics
 }  // namespace InferenceEngine
@@ -342,11 +342,55 @@ static constexpr ov::Property<InferenceEngine::VPUXConfigParams::ProfilingOutput
  */
 static constexpr ov::Property<std::string> profiling_output_file{"VPUX_PROFILING_OUTPUT_FILE"};
 
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: "YES", "NO", default is "NO".
+ * Decode the profiling output of every inference and accumulate it into the statistics,
+ * which are returned by the VPUX_PROFILING_STATISTICS metric. Requires PERF_COUNT.
+ */
+static constexpr ov::Property<bool> collect_profiling_statistics{"VPUX_COLLECT_PROFILING_STATISTICS"};
+
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: "YES", "NO", default is "NO".
+ * Time the preprocessing, repacking, push and pull stages of every inference on the host,
+ * the durations are returned by the VPUX_HOST_OVERHEAD_STATISTICS metric.
+ */
+static constexpr ov::Property<bool> collect_host_overhead_statistics{"VPUX_COLLECT_HOST_OVERHEAD_STATISTICS"};
+
 /**
  * @brief
  * Type: "YES", "NO", default is "NO".
  */
 static constexpr ov::Property<bool> use_elf_compiler_backend{"VPUX_USE_ELF_COMPILER_BACKEND"};
 
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: Arbitrary string, default is empty.
+ * Directory of the plugin-side compiled network cache. The cache is disabled if this string is empty
+ */
+static constexpr ov::Property<std::string> compiled_blob_cache_dir{"VPUX_COMPILED_BLOB_CACHE_DIR"};
+
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: integer, default is 1024.
+ * Upper bound for the size of the compiled network cache in MB, least recently used blobs are evicted first
+ */
+static constexpr ov::Property<int64_t> compiled_blob_cache_size_mb{"VPUX_COMPILED_BLOB_CACHE_SIZE_MB"};
+
+/**
+ * @brief [Only for VPUX Compiler]
+ * Type: Arbitrary string, default is empty.
+ * JSON file to store per-pass compilation time and memory statistics. The statistics are not collected if it is empty
+ */
+static constexpr ov::Property<std::string> compiler_telemetry_file{"VPUX_COMPILER_TELEMETRY_FILE"};
+
+/**
+ * @brief [Only for VPUX Plugin]
+ * Type: "YES", "NO", default is "NO".
+ * Print the log messages from a background thread instead of the calling one
+ */
+static constexpr ov::Property<bool> log_async{"VPUX_LOG_ASYNC"};
+
 }  // namespace intel_vpux
 }  // namespace ov
@@ -25,6 +25,7 @@
 #include "vpux/utils/IE/blob.hpp"
 #include "vpux/utils/IE/itt.hpp"
 #include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/plugin/profiling_aggregator.hpp"
 
 namespace vpux {
 namespace IE = InferenceEngine;
@@ -146,15 +147,24 @@ void InferRequest::moveBlobsForPreprocessingToInputs(
 void InferRequest::InferAsync() {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "InferRequest::InferAsync");
 
+    const auto hostOverhead = _executorPtr->getHostOverheadAggregator();
+
     const auto preProcMap = preparePreProcessing(_networkInputs, _preProcData);
     if (_executorPtr->isPreProcessingSupported(preProcMap)) {
         moveBlobsForPreprocessingToInputs(_inputs, _networkInputs, _preProcData);
         updateRemoteBlobs(_inputs, preProcMap);
+
+        profiling::HostOverheadScope pushScope(hostOverhead, profiling::HostOverheadStage::Push);
         _executorPtr->push(_inputs, preProcMap);
     } else {
         _logger.info("Preprocessing cannot be executed on device. IE preprocessing will be executed.");
-        execDataPreprocessing(_inputs);
+        {
+            profiling::HostOverheadScope preprocessingScope(hostOverhead, profiling::HostOverheadStage::Preprocessing);
+            execDataPreprocessing(_inputs);
+        }
         updateRemoteBlobs(_inputs, preProcMap);
+
+        profiling::HostOverheadScope pushScope(hostOverhead, profiling::HostOverheadStage::Push);
         _executorPtr->push(_inputs);
     }
 #if defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
@@ -166,7 +176,11 @@ void InferRequest::InferAsync() {
 
 void InferRequest::GetResult() {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "InferRequest::GetResult");
-    _executorPtr->pull(_outputs);
+    {
+        profiling::HostOverheadScope pullScope(_executorPtr->getHostOverheadAggregator(),
+                                               profiling::HostOverheadStage::Pull);
+        _executorPtr->pull(_outputs);
+    }
 #if defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
     const char* dumpOutputPathEnv = std::getenv("IE_VPU_KMB_DUMP_OUTPUT_PATH");
     if (dumpOutputPathEnv != nullptr) {
@@ -0,0 +1,170 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/al/backend/repacking.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <dims_parser.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+using namespace vpux;
+
+namespace IE = InferenceEngine;
+
+namespace {
+
+IE::TensorDesc getTensorDescForNewDims(const IE::TensorDesc& origDesc, const std::size_t newSz) {
+    const auto actualLayout = origDesc.getLayout();
+    const auto& precision = origDesc.getPrecision();
+
+    std::size_t dimN, dimZ, dimY, dimX, dimD;
+    vpu::parseDims(origDesc.getDims(), dimN, dimZ, dimY, dimX, dimD);
+
+    switch (newSz) {
+    case 3:
+        VPUX_THROW_UNLESS(dimN == 1 && dimD == 1, "Expected dim N and D to be 1");
+        switch (actualLayout) {
+        case IE::Layout::NDHWC:
+        case IE::Layout::NHWC:
+            return IE::TensorDesc(precision, {dimY, dimX, dimZ}, IE::Layout::HWC);
+        case IE::Layout::NCDHW:
+        case IE::Layout::NCHW:
+            return IE::TensorDesc(precision, {dimZ, dimY, dimX}, IE::Layout::CHW);
+        default:
+            VPUX_THROW("Unsupported layout for actual blob: {0}", actualLayout);
+        }
+    case 4:
+        VPUX_THROW_UNLESS(dimD == 1, "Expected dim D to be 1");
+        switch (actualLayout) {
+        case IE::Layout::NDHWC:
+        case IE::Layout::HWC:
+            return IE::TensorDesc(precision, {dimN, dimY, dimX, dimZ}, IE::Layout::NHWC);
+        case IE::Layout::NCDHW:
+        case IE::Layout::CHW:
+            return IE::TensorDesc(precision, {dimN, dimZ, dimY, dimX}, IE::Layout::NCHW);
+        default:
+            VPUX_THROW("Unsupported layout for actual blob: {0}", actualLayout);
+        }
+    case 5:
+        switch (actualLayout) {
+        case IE::Layout::NHWC:
+        case IE::Layout::HWC:
+            return IE::TensorDesc(precision, {dimN, dimD, dimY, dimX, dimZ}, IE::Layout::NDHWC);
+        case IE::Layout::NCHW:
+        case IE::Layout::CHW:
+            return IE::TensorDesc(precision, {dimN, dimZ, dimD, dimY, dimX}, IE::Layout::NCDHW);
+        default:
+            VPUX_THROW("Unsupported layout for actual blob: {0}", actualLayout);
+        }
+    default:
+        VPUX_THROW("Unsupported dimensions layout");
+        break;
+    }
+}
+
+IE::MemoryBlob::Ptr adjustDims(const IE::MemoryBlob::Ptr& tensor, const IE::TensorDesc& targetDesc) {
+    const auto& actualDesc = tensor->getTensorDesc();
+
+    if (actualDesc.getDims().size() == targetDesc.getDims().size())
+        return tensor;
+
+    const auto mem = tensor->rmap();
+    const auto newDesc = getTensorDescForNewDims(actualDesc, targetDesc.getDims().size());
+    return makeBlob(newDesc, nullptr, mem.as<void*>());
+}
+
+bool needsLayoutChange(const IE::Layout& origLayout, const IE::Layout& targetLayout) {
+    const std::vector<IE::Layout> compatibleLayouts = {IE::Layout::C, IE::Layout::NC, IE::Layout::HW};
+    const auto isCompatibleLayout = [&compatibleLayouts](const IE::Layout& layout) {
+        return std::find(compatibleLayouts.begin(), compatibleLayouts.end(), layout) != compatibleLayouts.end();
+    };
+
+    return !(origLayout == targetLayout || isCompatibleLayout(origLayout) || isCompatibleLayout(targetLayout));
+}
+
+}  // namespace
+
+//
+// prepareInputForInference
+//
+
+void vpux::prepareInputForInference(const IE::Blob::Ptr& userInput, const IE::TensorDesc& deviceTensorDesc,
+                                    void* destData, const Optional<QuantizationParam>& quantParam, Logger logger) {
+    if (userInput == nullptr) {
+        IE_THROW() << "User input blob null pointer";
+    }
+    if (destData == nullptr) {
+        IE_THROW() << "Destination data null pointer";
+    }
+    const auto userPrecision = userInput->getTensorDesc().getPrecision();
+    const auto userLayout = userInput->getTensorDesc().getLayout();
+    const auto devicePrecision = deviceTensorDesc.getPrecision();
+    const auto deviceLayout = deviceTensorDesc.getLayout();
+
+    const bool isPrecisionMatched = userPrecision == devicePrecision;
+    const bool isLayoutMatched = userLayout == deviceLayout;
+    if (isPrecisionMatched && isLayoutMatched) {
+        IE_THROW() << "There is nothing to repack";
+    }
+
+    if (!isPrecisionMatched) {
+        logger.info("Different precisions of user and device input blobs.\tConversion required from {0} to {1}",
+                    userPrecision.name(), devicePrecision.name());
+        if (!isLayoutMatched) {
+            IE::Blob::Ptr expectedInput = toPrecision(IE::as<IE::MemoryBlob>(userInput), devicePrecision, quantParam);
+            std::stringstream conversionDetailsStr;
+            conversionDetailsStr << "Conversion required from " << userLayout << " to " << deviceLayout << ".";
+            logger.info("Different layouts of user and device input blobs.\t{0}", conversionDetailsStr.str());
+            toLayout(IE::as<IE::MemoryBlob>(expectedInput), deviceLayout, nullptr, destData);
+        } else {
+            toPrecision(IE::as<IE::MemoryBlob>(userInput), devicePrecision, quantParam, nullptr, destData);
+        }
+    } else if (!isLayoutMatched) {
+        std::stringstream conversionDetailsStr;
+        conversionDetailsStr << "Conversion required from " << userLayout << " to " << deviceLayout << ".";
+        logger.info("Different layouts of user and device input blobs.\t{0}", conversionDetailsStr.str());
+        toLayout(IE::as<IE::MemoryBlob>(userInput), deviceLayout, nullptr, destData);
+    }
+}
+
+//
+// repackTensor
+//
+
+IE::MemoryBlob::Ptr vpux::repackTensor(const IE::Blob::Ptr& tensor, const IE::TensorDesc& targetDesc,
+                                       Logger logger) {
+    const auto& actualDesc = tensor->getTensorDesc();
+    const auto& actualPrecision = actualDesc.getPrecision();
+    const auto& actualLayout = actualDesc.getLayout();
+
+    const auto& devicePrecision = targetDesc.getPrecision();
+    const auto& deviceLayout = targetDesc.getLayout();
+
+    auto tensorBlob = IE::as<IE::MemoryBlob>(tensor);
+
+    if (actualPrecision != devicePrecision) {
+        logger.warning("Blob is inconsistent with network input/output. "
+                       "Need to do convert precision from {0} to {1}.",
+                       actualPrecision, devicePrecision);
+        tensorBlob = toPrecision(tensorBlob, devicePrecision, None);
+    }
+
+    if (needsLayoutChange(actualLayout, deviceLayout)) {
+        logger.warning("Blob is inconsistent with network input/output. "
+                       "Need to do convert layout from {0} to {1}.",
+                       actualLayout, deviceLayout);
+
+        tensorBlob = adjustDims(tensorBlob, targetDesc);
+        tensorBlob = toLayout(tensorBlob, deviceLayout);
+    }
+
+    return tensorBlob;
+}
@@ -17,6 +17,7 @@ void vpux::registerCommonOptions(OptionsDesc& desc) {
     desc.add<PERFORMANCE_HINT_NUM_REQUESTS>();
     desc.add<PERF_COUNT>();
     desc.add<LOG_LEVEL>();
+    desc.add<LOG_ASYNC>();
     desc.add<PLATFORM>();
     desc.add<DEVICE_ID>();
 }
@@ -25,6 +25,9 @@ void vpux::registerCompilerOptions(OptionsDesc& desc) {
     desc.add<USE_ELF_COMPILER_BACKEND>();
     desc.add<FORCE_HOST_PRECISION_LAYOUT_CONVERSION>();
     desc.add<DDR_HEAP_SIZE_MB>();
+    desc.add<COMPILED_BLOB_CACHE_DIR>();
+    desc.add<COMPILED_BLOB_CACHE_SIZE_MB>();
+    desc.add<COMPILER_TELEMETRY_FILE>();
 }
 
 //
@@ -26,6 +26,8 @@ void vpux::registerRunTimeOptions(OptionsDesc& desc) {
     desc.add<INFERENCE_TIMEOUT_MS>();
     desc.add<PRINT_PROFILING>();
     desc.add<PROFILING_OUTPUT_FILE>();
+    desc.add<COLLECT_PROFILING_STATISTICS>();
+    desc.add<COLLECT_HOST_OVERHEAD_STATISTICS>();
     desc.add<MODEL_PRIORITY>();
 }
 
@@ -24,6 +24,7 @@ std::unique_ptr<mlir::Pass> createMoveDeclarationsToTopPass(Logger log = Logger:
 std::unique_ptr<mlir::Pass> createPrintDotPass(StringRef fileName = {}, StringRef startAfter = {},
                                                StringRef stopBefore = {}, bool printConst = false,
                                                bool printDeclarations = false);
+std::unique_ptr<mlir::Pass> createDumpIRStatisticsPass(StringRef fileName = {}, Logger log = Logger::global());
 
 //
 // Generated
@@ -10,6 +10,7 @@
 #include "vpux/compiler/dialect/IE/ops.hpp"
 #include "vpux/compiler/dialect/VPU/attributes.hpp"
 #include "vpux/compiler/dialect/VPUIP/graph-schema/schema.hpp"
+#include "vpux/compiler/dialect/VPUIP/graph-schema/weights_segment.hpp"
 #include "vpux/compiler/utils/logging.hpp"
 
 #include <mlir/IR/BuiltinOps.h>
@@ -25,7 +26,9 @@ public:
     static VPU::ArchKind parseDeviceRevision(const MVCNN::SummaryHeader* header);
 
 public:
-    BlobReader(mlir::MLIRContext* ctx, ArrayRef<char> blob, Logger log);
+    // The weights segment is required only for the blobs with out-of-line constants
+    BlobReader(mlir::MLIRContext* ctx, ArrayRef<char> blob, Logger log,
+               const WeightsSegmentReader* weights = nullptr);
     mlir::OwningOpRef<mlir::ModuleOp> read();
 
 private:
@@ -128,6 +131,7 @@ private:
     mlir::FlatSymbolRefAttr _mainFuncName;
     Logger _log;
     const MVCNN::GraphFile* _graphFile;
+    const WeightsSegmentReader* _weights;
 
     int32_t _constCounter = 0;
 
@@ -62,6 +62,7 @@ public:
     using BarrierReference = flatbuffers::Offset<MVCNN::BarrierReference>;
 
     using BinaryData = flatbuffers::Offset<MVCNN::BinaryData>;
+    using BinaryDataStorage = flatbuffers::Offset<flatbuffers::Vector<uint64_t>>;
 
     using KernelData = flatbuffers::Offset<MVCNN::KernelData>;
     using ActKernel = flatbuffers::Offset<MVCNN::ActKernel>;
@@ -141,7 +142,14 @@ public:
     const DMADescriptorReference getUpsamplingNNDMADescriptorReference(mlir::Operation* op) const;
 
 public:
-    BinaryData createBinaryData(ArrayRef<uint64_t> content, vpux::NDTypeInterface type, bool csram_cacheable = false);
+    // Reserves uninitialized space for the content inside the blob, it must be filled via getBinaryDataStorage
+    BinaryData createBinaryData(vpux::NDTypeInterface type, BinaryDataStorage& storage, bool csram_cacheable = false);
+
+    // The returned memory is valid until the next object is added to the blob
+    MutableArrayRef<char> getBinaryDataStorage(BinaryDataStorage storage);
+
+    // Describes the content stored out of the blob in the weights segment, the data vector is left empty
+    BinaryData createOutOfLineBinaryData(vpux::NDTypeInterface type, bool csram_cacheable = false);
 
 public:
     Barrier createBarrier(mlir::Value val, Optional<int64_t> physicalID = None);
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "vpux/compiler/dialect/VPUIP/graph-schema/weights_segment.hpp"
+
 #include "vpux/utils/core/logger.hpp"
 #include "vpux/utils/core/preprocessing.hpp"
 #include "vpux_compiler.hpp"
@@ -25,5 +27,19 @@ flatbuffers::DetachedBuffer exportToBlob(mlir::ModuleOp module, mlir::TimingScop
                                          const std::vector<std::shared_ptr<const ov::Node>>& results,
                                          Logger log = Logger::global());
 
+// Keeps the constant content out of the blob, it is produced into the weights segment by WeightsSegmentWriter::write,
+// which must be called while the module is alive. The segment can be appended to the blob or stored separately.
+flatbuffers::DetachedBuffer exportToBlob(mlir::ModuleOp module, mlir::TimingScope& rootTiming,
+                                         const std::vector<PreProcessInfo>& preprocessInfo,
+                                         const std::vector<std::shared_ptr<const ov::Node>>& parameters,
+                                         const std::vector<std::shared_ptr<const ov::Node>>& results,
+                                         WeightsSegmentWriter& weights, Logger log = Logger::global());
+
+// Compile-time cycle estimates of the tasks, which are joined with the measured durations by prof_parser.
+// The segment is appended to the blob after the graph, but before the weights segment if any.
+// Returns an empty segment if the network isn't profiled or the tasks don't have the estimates.
+std::vector<char> exportPredictedCycles(mlir::ModuleOp module, uint32_t alignment = 1,
+                                        Logger log = Logger::global());
+
 }  // namespace VPUIP
 }  // namespace vpux
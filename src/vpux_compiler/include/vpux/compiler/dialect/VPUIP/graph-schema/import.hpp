@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "vpux/compiler/dialect/VPUIP/graph-schema/weights_segment.hpp"
+
 #include "vpux/utils/core/logger.hpp"
 
 #include <mlir/IR/BuiltinOps.h>
@@ -15,8 +17,13 @@
 namespace vpux {
 namespace VPUIP {
 
+// The trailing weights segment is detected automatically
 mlir::OwningOpRef<mlir::ModuleOp> importBlob(mlir::MLIRContext* ctx, const std::vector<char>& blob,
                                              Logger log = Logger::global());
 
+// The constant content is taken from the external weights segment (e.g. sidecar weights file)
+mlir::OwningOpRef<mlir::ModuleOp> importBlob(mlir::MLIRContext* ctx, const std::vector<char>& blob,
+                                             const WeightsSegmentReader& weights, Logger log = Logger::global());
+
 }  // namespace VPUIP
 }  // namespace vpux
@@ -0,0 +1,123 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/utils/IE/loop.hpp"
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/mem_size.hpp"
+#include "vpux/utils/core/optional.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+#include "vpux/utils/plugin/weights_segment_format.hpp"
+
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vpux {
+namespace VPUIP {
+
+//
+// Weights segment
+//
+// The format is defined by vpux/utils/plugin/weights_segment_format.hpp.
+//
+
+using vpux::WEIGHTS_SEGMENT_MAGIC;
+using vpux::WEIGHTS_SEGMENT_VERSION;
+using vpux::WeightsSegmentFooter;
+using vpux::WeightsSegmentTableEntry;
+
+constexpr uint32_t WEIGHTS_SEGMENT_DEFAULT_ALIGNMENT = 64;
+
+//
+// WeightsSegmentWriter
+//
+
+class WeightsSegmentWriter final {
+public:
+    using ContentWriter = std::function<void(MutableArrayRef<char>)>;
+
+public:
+    explicit WeightsSegmentWriter(uint32_t alignment = WEIGHTS_SEGMENT_DEFAULT_ALIGNMENT,
+                                  Byte stagingSize = Byte(64 * 1024 * 1024));
+
+    // The content is produced only during write(), so the writer must stay valid until then.
+    // Returns the index of the entry in the offset table.
+    uint64_t append(Byte size, ContentWriter writer);
+
+    size_t numEntries() const {
+        return _entries.size();
+    }
+
+    // Total segment size, including the offset table and the footer
+    uint64_t getSegmentSize() const;
+
+    // Streams the segment, the entries are produced with the given policy into a bounded staging buffer.
+    // The writers, which fold the constants, must use Const::getFoldingExecPolicy of the module context.
+    void write(llvm::raw_ostream& stream, LoopExecPolicy policy, Logger log = Logger::global()) const;
+
+private:
+    struct Entry final {
+        WeightsSegmentTableEntry location;
+        ContentWriter writer;
+    };
+
+    uint32_t _alignment;
+    Byte _stagingSize;
+    std::vector<Entry> _entries;
+    uint64_t _dataSize = 0;
+};
+
+//
+// WeightsSegmentReader
+//
+
+class WeightsSegmentReader final {
+public:
+    using Ptr = std::shared_ptr<const WeightsSegmentReader>;
+
+public:
+    // Returns the segment located at the end of the blob, if any
+    static Optional<ArrayRef<char>> findTrailingSegment(ArrayRef<char> blob);
+
+public:
+    // The segment memory is owned by the caller
+    explicit WeightsSegmentReader(ArrayRef<char> segment);
+
+    // The sidecar file is mapped on the first access to the content and the mapping is shared
+    // by all users of the reader
+    explicit WeightsSegmentReader(std::string filePath);
+
+    WeightsSegmentReader(const WeightsSegmentReader&) = delete;
+    WeightsSegmentReader& operator=(const WeightsSegmentReader&) = delete;
+
+    ~WeightsSegmentReader();
+
+    uint64_t numEntries() const;
+    ArrayRef<char> getEntry(uint64_t index) const;
+
+private:
+    void init() const;
+
+private:
+    std::string _filePath;
+    mutable std::once_flag _initFlag;
+    mutable std::unique_ptr<llvm::sys::fs::mapped_file_region> _mapping;
+    mutable ArrayRef<char> _segment;
+    mutable WeightsSegmentFooter _footer = {};
+};
+
+}  // namespace VPUIP
+}  // namespace vpux
@@ -0,0 +1,91 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/dialect/VPURT/ops.hpp"
+
+#include "vpux/utils/core/func_ref.hpp"
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/optional.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <mlir/IR/BuiltinOps.h>
+#include <mlir/IR/PatternMatch.h>
+
+#include <vector>
+
+namespace vpux {
+namespace VPUIP {
+
+//
+// UnrollingMetric
+//
+
+// Reports the number of tasks before and after the unrolling. Their ratio is the op-count blow-up caused by
+// the number of clusters and by the splitting of the DMAs.
+class UnrollingMetric final {
+public:
+    explicit UnrollingMetric(mlir::FuncOp func);
+
+public:
+    void report(StringRef passName, Logger log) const;
+
+private:
+    mlir::FuncOp _func;
+    int64_t _numTasksBefore = 0;
+};
+
+//
+// unrollTasks
+//
+
+namespace details {
+
+void unrollTasks(mlir::FuncOp func, StringRef passName, ArrayRef<VPURT::TaskOp> tasks, FuncRef<void(size_t)> plan,
+                 FuncRef<bool(mlir::PatternRewriter&, size_t)> insert, Logger log);
+
+}  // namespace details
+
+// Unrolls the tasks with the inner operation of `OpTy` type in two phases:
+//   * `plan` computes the parts of a task (types, offsets, DMA descriptors) and doesn't change the IR.
+//     It is called for all the tasks in parallel, if the context allows multithreading. It returns `None`
+//     for the tasks, which don't need to be unrolled.
+//   * `insert` creates the new tasks from the plan, the insertion point is set after the original task.
+//     The tasks are processed in the program order, so the result doesn't depend on the number of threads.
+// The original tasks and their trivially dead buffers are erased.
+template <class OpTy, class Plan>
+void unrollTasks(mlir::FuncOp func, StringRef passName, FuncRef<Optional<Plan>(OpTy)> plan,
+                 FuncRef<void(mlir::PatternRewriter&, OpTy, const Plan&)> insert, Logger log) {
+    SmallVector<VPURT::TaskOp> tasks;
+    SmallVector<OpTy> ops;
+    func.walk([&](VPURT::TaskOp task) {
+        if (auto op = mlir::dyn_cast<OpTy>(task.getInnerTaskOp())) {
+            tasks.push_back(task);
+            ops.push_back(op);
+        }
+    });
+
+    std::vector<Optional<Plan>> plans(ops.size());
+
+    details::unrollTasks(
+            func, passName, tasks,
+            [&](size_t ind) {
+                plans[ind] = plan(ops[ind]);
+            },
+            [&](mlir::PatternRewriter& rewriter, size_t ind) {
+                if (!plans[ind].hasValue()) {
+                    return false;
+                }
+
+                insert(rewriter, ops[ind], plans[ind].getValue());
+                return true;
+            },
+            log);
+}
+
+}  // namespace VPUIP
+}  // namespace vpux
@@ -20,6 +20,7 @@ namespace Const {
 //
 
 std::unique_ptr<mlir::Pass> createConstantFoldingPass(Logger log = Logger::global());
+std::unique_ptr<mlir::Pass> createDeduplicateConstantsPass(Logger log = Logger::global());
 
 //
 // Generated
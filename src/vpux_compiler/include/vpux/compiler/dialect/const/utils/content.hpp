@@ -13,6 +13,7 @@
 #include "vpux/compiler/utils/types.hpp"
 
 #include "vpux/utils/IE/float16.hpp"
+#include "vpux/utils/IE/loop.hpp"
 #include "vpux/utils/core/array_ref.hpp"
 #include "vpux/utils/core/checked_cast.hpp"
 #include "vpux/utils/core/error.hpp"
@@ -222,6 +223,11 @@ public:
 
     ArrayRef<char> getRawStorageBuf() && = delete;
 
+    // The content owns the temporary buffer, which can be modified in place
+    bool hasTempBuf() const {
+        return _tempBuf != nullptr;
+    }
+
     MutableArrayRef<char> getRawTempBuf() & {
         VPUX_THROW_UNLESS(_tempBuf != nullptr, "Temp buffer was not allocated");
         return makeMutableArrayRef(_tempBuf.get(), _data.size());
@@ -280,5 +286,21 @@ private:
     std::unique_ptr<char[]> _tempBuf;
 };
 
+//
+// getFoldingExecPolicy
+//
+
+// Folding creates new attributes and types, which are uniqued by the context without a lock once its
+// multithreading is disabled, so the constants are folded by the worker threads only if the context allows it
+LoopExecPolicy getFoldingExecPolicy(mlir::MLIRContext* ctx);
+
+//
+// getFoldedBytes
+//
+
+// Total size of the content produced by ContentAttr::fold in the process so far.
+// The counter is shared by all threads and compilations, the splat content is counted as a single element.
+uint64_t getFoldedBytes();
+
 }  // namespace Const
 }  // namespace vpux
@@ -0,0 +1,78 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/utils/core/array_ref.hpp"
+
+#include <llvm/ADT/Hashing.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace vpux {
+namespace Const {
+
+//
+// SharedBuffer
+//
+// Read-only constant data, which is not owned by the MLIR context. The buffer keeps a reference to the owner
+// of the memory (for example, the nGraph Constant node or the mapped weights file), so the data stays valid
+// as long as any attribute refers to it, and it is never copied or touched at creation.
+//
+// The content hash is computed on the first request only, the attributes are uniqued by the buffer identity.
+//
+
+class SharedBuffer final {
+public:
+    using Owner = std::shared_ptr<const void>;
+
+public:
+    static std::shared_ptr<const SharedBuffer> create(ArrayRef<char> data, Owner owner);
+
+    // Makes an owned copy of the data, used when no external owner exists (for example, for parsed IR)
+    static std::shared_ptr<const SharedBuffer> copy(ArrayRef<char> data);
+
+public:
+    SharedBuffer(ArrayRef<char> data, Owner owner);
+
+    SharedBuffer(const SharedBuffer&) = delete;
+    SharedBuffer& operator=(const SharedBuffer&) = delete;
+
+public:
+    ArrayRef<char> getData() const {
+        return _data;
+    }
+
+    size_t size() const {
+        return _data.size();
+    }
+
+    llvm::hash_code getContentHash() const;
+    bool hasContentHash() const {
+        return _hashReady.load(std::memory_order_acquire);
+    }
+
+private:
+    ArrayRef<char> _data;
+    Owner _owner;
+
+    mutable std::once_flag _hashFlag;
+    mutable llvm::hash_code _hash = 0;
+    mutable std::atomic<bool> _hashReady{false};
+};
+
+using SharedBufferPtr = std::shared_ptr<const SharedBuffer>;
+
+// Used for the attribute storage uniquing, which must not touch the data
+inline llvm::hash_code hash_value(const SharedBufferPtr& buffer) {
+    return llvm::hash_value(buffer.get());
+}
+
+}  // namespace Const
+}  // namespace vpux
@@ -0,0 +1,68 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/compiler/dialect/const/utils/content.hpp"
+
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <vector>
+
+namespace vpux {
+namespace Const {
+
+//
+// Weights sparsity kernels
+//
+// The kernels process the dense weights with the output channels in the outermost dimension, each output channel
+// is handled by a separate task of the worker threads. The elements are compared by their bit patterns, the sign bit
+// is ignored for the floating point zero, which gives the same result as the value comparison, but lets
+// the compiler vectorize the loops.
+//
+// The kernels are instantiated for int8_t, uint8_t, float16, bfloat16 and float storage types.
+//
+
+// Returns the number of the elements, which are not equal to the sparsify value, per output channel
+template <typename StorageType>
+SmallVector<int64_t> countNonSparseElements(ArrayRef<StorageType> weights, int64_t numOC, StorageType sparsifyValue);
+
+// Builds the bit mask of the non-sparse elements with mapSizePerOC bytes reserved for each output channel.
+// The map buffer is expected to be zero-initialized.
+template <typename StorageType>
+void buildSparsityMap(ArrayRef<StorageType> weights, int64_t numOC, StorageType sparsifyValue, int64_t mapSizePerOC,
+                      MutableArrayRef<char> map);
+
+// Copies the non-sparse elements of each output channel to the output, the data of each output channel starts
+// at the offset aligned to the given number of bytes. The output buffer is expected to be zero-initialized.
+template <typename StorageType>
+void compactWeights(ArrayRef<StorageType> weights, int64_t numOC, StorageType sparsifyValue, int64_t alignment,
+                    MutableArrayRef<char> output);
+
+// Returns the dense values of the content in the given storage type. The storage of the content is referred
+// directly, if it already has that type, otherwise the values are converted into the temporary buffer.
+template <typename StorageType>
+ArrayRef<StorageType> getDenseValues(const Content& content, mlir::Type storageElemType,
+                                     std::vector<StorageType>& tempBuf) {
+    auto contentElemType = content.getStorageElemType();
+    if (const auto qType = contentElemType.dyn_cast<mlir::quant::QuantizedType>()) {
+        contentElemType = normalizeQuantStorageType(qType);
+    }
+
+    if (!content.isSplat() && contentElemType == storageElemType) {
+        const auto rawData = content.getRawStorageBuf();
+        return makeArrayRef(reinterpret_cast<const StorageType*>(rawData.data()), rawData.size() / sizeof(StorageType));
+    }
+
+    const auto values = content.getValues<StorageType>();
+    tempBuf.assign(values.begin(), values.end());
+    return makeArrayRef(tempBuf);
+}
+
+}  // namespace Const
+}  // namespace vpux
@@ -0,0 +1,110 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/utils/core/memory_usage.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <mlir/IR/Operation.h>
+#include <mlir/Pass/PassManager.h>
+
+#include <llvm/Support/raw_ostream.h>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vpux {
+
+//
+// IRSize
+//
+
+struct IRSize final {
+    size_t numOps = 0;
+    size_t numConstants = 0;
+    int64_t constBytes = 0;  // Total size of the Const.Declare results
+};
+
+IRSize getIRSize(mlir::Operation* root);
+
+//
+// CompileTelemetry
+//
+// Per-pass compilation statistics for tracking the compile time and memory regressions.
+// The process memory and the folded bytes counter are shared by all threads, so the deltas of the passes
+// running in parallel on different functions also include the allocations and the folding of each other.
+//
+
+struct TelemetryRecord final {
+    std::string name;    // Pass argument or compilation stage name
+    std::string kind;    // "pass" or "stage"
+    std::string anchor;  // Name of the operation the pass was run on
+    double wallTimeMs = 0.0;
+    IRSize before;
+    IRSize after;
+    uint64_t foldedBytes = 0;  // Size of the content folded during the pass or stage
+    MemoryUsage memBefore;
+    MemoryUsage memAfter;
+    bool failed = false;
+};
+
+class CompileTelemetry final {
+public:
+    CompileTelemetry();
+
+public:
+    void addRecord(TelemetryRecord record);
+    std::vector<TelemetryRecord> getRecords() const;
+
+public:
+    void printAsJson(llvm::raw_ostream& stream) const;
+    void writeToFile(StringRef fileName) const;
+
+private:
+    mutable std::mutex _mutex;
+    std::vector<TelemetryRecord> _records;
+    std::chrono::steady_clock::time_point _startTime;
+    MemoryUsage _initialMemory;
+};
+
+// Records each pass of the PassManager
+void addTelemetry(mlir::PassManager& pm, const std::shared_ptr<CompileTelemetry>& telemetry);
+
+//
+// TelemetryScope
+//
+// Records a compilation stage outside of the PassManager, like import or export of the network.
+// Does nothing if the telemetry is null.
+//
+
+class TelemetryScope final {
+public:
+    TelemetryScope(CompileTelemetry* telemetry, StringRef name, mlir::Operation* op = nullptr);
+    ~TelemetryScope();
+
+    TelemetryScope(const TelemetryScope&) = delete;
+    TelemetryScope& operator=(const TelemetryScope&) = delete;
+
+public:
+    // IR to be measured at the end of the stage, if it was created by the stage itself
+    void setOperation(mlir::Operation* op) {
+        _op = op;
+    }
+
+private:
+    CompileTelemetry* _telemetry = nullptr;
+    mlir::Operation* _op = nullptr;
+    TelemetryRecord _record;
+    uint64_t _foldedBytesBefore = 0;
+    std::chrono::steady_clock::time_point _startTime;
+};
+
+}  // namespace vpux
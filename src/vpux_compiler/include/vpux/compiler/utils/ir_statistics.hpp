@@ -0,0 +1,67 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <mlir/IR/Operation.h>
+#include <mlir/Pass/PassManager.h>
+
+#include <llvm/Support/raw_ostream.h>
+
+#include <map>
+#include <string>
+
+namespace vpux {
+
+//
+// IRStatistics
+//
+// Structured snapshot of the IR size and the constant and buffer memory, which can be taken after any pass.
+// The constant sizes are inferred from the types of the transformations, so no constant is folded.
+//
+
+struct BufferStatistics final {
+    size_t count = 0;
+    int64_t bytes = 0;        // Total size of the allocated or declared buffers, aliased buffers are counted each
+    int64_t extentBytes = 0;  // The highest end offset of the declared buffers, 0 before the static allocation
+};
+
+struct IRStatistics final {
+    size_t numOps = 0;
+    std::map<std::string, size_t> opsPerDialect;
+
+    size_t numConstants = 0;
+    int64_t constBaseBytes = 0;    // Stored base content, splat is counted as a single element
+    int64_t constFoldedBytes = 0;  // Content after all the transformations are applied
+    size_t maxTransformations = 0;
+    size_t totalTransformations = 0;
+    std::map<size_t, size_t> transformationsHistogram;  // Number of transformations -> number of constants
+
+    // Constants with the same base content and the same transformations. The constants, which fold into
+    // the same data from the different bases or transformation chains, are not detected, so it is the lower bound.
+    size_t numDuplicateGroups = 0;
+    size_t numDuplicateConstants = 0;  // All but one constant of each group
+    int64_t duplicateFoldedBytes = 0;
+
+    std::map<std::string, BufferStatistics> buffersPerMemory;  // By memory kind
+
+    size_t numVirtualBarriers = 0;
+    size_t numPhysicalBarriers = 0;
+};
+
+IRStatistics getIRStatistics(mlir::Operation* root);
+
+// Single line JSON object, so the statistics of several passes can be written to the same file as JSON Lines
+void printIRStatisticsAsJson(const IRStatistics& stats, StringRef afterPass, llvm::raw_ostream& stream);
+
+// Dumps the statistics after each pass, which matches the regular expression. The options have the format of
+// `dump-ir-statistics` pass options, several printers are separated by comma.
+void addIRStatisticsPrinter(mlir::PassManager& pm, StringRef options);
+
+}  // namespace vpux
@@ -17,6 +17,8 @@
 
 #include <mlir/IR/DialectImplementation.h>
 
+#include <memory>
+
 namespace vpux {
 
 namespace BufferTransform {
@@ -52,6 +54,28 @@ private:
     uint32_t _ramCutAddressMask{RAM_CUT_ADDRESS_MASK};
 };
 
+//
+// SwizzlePattern
+//
+// The permutation of the 16-byte chunks within the swizzle stripe, the address transformation is periodic with
+// the stripe size for all the swizzle keys. The consecutive chunks, which stay consecutive after the transformation,
+// are merged into the runs, so the stripe is copied by a few wide copies instead of the per-chunk address
+// computation. The pattern is built once per (swizzle key, arch) pair and shared by all the transformations.
+//
+
+struct SwizzlePattern final {
+    struct Run final {
+        uint32_t dpuOffset = 0;
+        uint32_t phyOffset = 0;
+        uint32_t size = 0;
+    };
+
+    uint32_t stripeSize = 0;
+    SmallVector<Run> runs;
+
+    static std::shared_ptr<const SwizzlePattern> get(uint32_t swizzleKey, VPU::ArchKind archKind);
+};
+
 class BufferSwizzleTransform {
 public:
     BufferSwizzleTransform(uint32_t swizzleKey = 5, VPU::ArchKind archKind = VPU::ArchKind::VPUX37XX);
@@ -59,54 +83,26 @@ public:
 
     template <typename OutT>
     void swizzle(ArrayRef<char> in, MutableArrayRef<OutT>& swizzledBuffer) {
-        const auto logToRamCutDataWidth{_addressTransform.getLog2RamCutDataWidth()};
-        const auto copyDataWidth{1u << logToRamCutDataWidth};
-        const auto dataWidthM1{copyDataWidth - 1u};
-
-        auto inSize{in.size() * sizeof(char)};
-        auto rawData = in.data();
-        // Make sure in buffer size is a multiple of the NN CMX data width (VPUX37XX: 16B)
-        inSize = ((inSize + dataWidthM1) >> logToRamCutDataWidth) << logToRamCutDataWidth;
-        const auto iterations{inSize >> logToRamCutDataWidth};
-
-        uint32_t dpuAddr{};
-        auto pIn = reinterpret_cast<const uint8_t*>(rawData);
-        auto pOut = reinterpret_cast<uint8_t*>(&swizzledBuffer[0]);
-
-        for (size_t i{}; i < iterations; ++i) {
-            auto phyAddr{_addressTransform.getPhysicalAddress(dpuAddr)};
-            memcpy(reinterpret_cast<void*>(pOut + phyAddr), reinterpret_cast<const void*>(pIn + dpuAddr),
-                   copyDataWidth);
-            dpuAddr += copyDataWidth;
-        }
+        swizzleRaw(in, makeMutableArrayRef(reinterpret_cast<char*>(swizzledBuffer.data()),
+                                           swizzledBuffer.size() * sizeof(OutT)));
     }
 
     // Function to be used for testing
     template <typename OutT>
     void deswizzle(MutableArrayRef<OutT>& in, SmallVector<OutT>& deSwizzledBuffer) {
-        const auto logToRamCutDataWidth{_addressTransform.getLog2RamCutDataWidth()};
-        const auto copyDataWidth{1u << logToRamCutDataWidth};
-        const auto dataWidthM1{copyDataWidth - 1u};
-
-        auto inSize{in.size() * sizeof(OutT)};
-        // Make sure in buffer size is a multiple of the NN CMX data width (VPUX37XX: 16B)
-        inSize = ((inSize + dataWidthM1) >> logToRamCutDataWidth) << logToRamCutDataWidth;
-        const auto iterations{inSize >> logToRamCutDataWidth};
-
-        uint32_t dpuAddr{};
-        auto pIn = reinterpret_cast<uint8_t*>(&in[0]);
-        auto pOut = reinterpret_cast<uint8_t*>(&deSwizzledBuffer[0]);
-
-        for (size_t i{}; i < iterations; ++i) {
-            auto phyAddr{_addressTransform.getPhysicalAddress(dpuAddr)};
-            memcpy(reinterpret_cast<void*>(pOut + dpuAddr), reinterpret_cast<const void*>(pIn + phyAddr),
-                   copyDataWidth);
-            dpuAddr += copyDataWidth;
-        }
+        deswizzleRaw(makeArrayRef(reinterpret_cast<const char*>(in.data()), in.size() * sizeof(OutT)),
+                     makeMutableArrayRef(reinterpret_cast<char*>(deSwizzledBuffer.data()),
+                                         deSwizzledBuffer.size() * sizeof(OutT)));
     }
 
+private:
+    // The stripes are processed by the worker threads, the input size is rounded up to the 16-byte chunk
+    void swizzleRaw(ArrayRef<char> in, MutableArrayRef<char> out) const;
+    void deswizzleRaw(ArrayRef<char> in, MutableArrayRef<char> out) const;
+
 private:
     AddressTransform _addressTransform;
+    std::shared_ptr<const SwizzlePattern> _pattern;
 };
 
 }  // namespace BufferTransform
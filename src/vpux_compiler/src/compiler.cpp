@@ -22,13 +22,16 @@
 #include "vpux/compiler/frontend/IE.hpp"
 #include "vpux/compiler/init.hpp"
 #include "vpux/compiler/pipelines.hpp"
+#include "vpux/compiler/utils/compile_telemetry.hpp"
 #include "vpux/compiler/utils/dot_printer.hpp"
+#include "vpux/compiler/utils/ir_statistics.hpp"
 #include "vpux/compiler/utils/logging.hpp"
 
 #include "vpux/utils/IE/itt.hpp"
 #include "vpux/utils/core/error.hpp"
 #include "vpux/utils/core/helper_macros.hpp"
 #include "vpux/utils/core/optional.hpp"
+#include "vpux/utils/core/scope_exit.hpp"
 #include "vpux/utils/core/string_utils.hpp"
 
 #include <mlir/IR/Dialect.h>
@@ -46,6 +49,7 @@
 #include <transformations/utils/utils.hpp>
 
 #include <algorithm>
+#include <atomic>
 
 #if defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
 
@@ -58,6 +62,34 @@ using namespace InferenceEngine;
 
 namespace {
 
+//
+// Shared compilation resources
+//
+
+// The registries are not modified after construction, so they are built once and shared by all compilations.
+// Every compilation still owns its MLIRContext, since the uniqued attributes and types (including the constants)
+// live as long as the context does.
+const mlir::DialectRegistry& getDialectRegistry(bool enableDummyOpReplacement) {
+    struct Registries final {
+        Registries() {
+            registerDialects(common);
+            registerDialects(withDummyOpReplacement);
+            registerInterfacesWithReplacement(withDummyOpReplacement);
+        }
+
+        mlir::DialectRegistry common;
+        mlir::DialectRegistry withDummyOpReplacement;
+    };
+
+    static const Registries registries;
+    return enableDummyOpReplacement ? registries.withDummyOpReplacement : registries.common;
+}
+
+// Each MLIRContext owns a thread pool sized by the number of cores, so concurrent compilations
+// use a single thread each to avoid oversubscription. The constants are folded sequentially then
+// (see Const::getFoldingExecPolicy), since the context doesn't lock its uniquer without multithreading.
+std::atomic<int64_t> activeCompilations{0};
+
 //
 // getArchKind
 //
@@ -176,10 +208,6 @@ public:
     void setup(mlir::DefaultTimingManager& tm) const;
     void setup(mlir::PassManager& pm) const;
 
-    bool useSharedConstants() const {
-        return _crashReproducerFile.empty() && _irPrintingFilter.empty();
-    }
-
 private:
     Logger _log;
 
@@ -193,6 +221,7 @@ private:
     bool _printFullConstant = false;
     bool _printDebugInfo = false;
     std::string _printDotOptions;
+    std::string _irStatisticsOptions;
 
     llvm::raw_ostream* _timingStream = nullptr;
 
@@ -215,6 +244,7 @@ DeveloperConfig::DeveloperConfig(Logger log): _log(log) {
     parseEnv("IE_VPUX_PRINT_DEBUG_INFO", _printDebugInfo);
 
     parseEnv("IE_VPUX_PRINT_DOT", _printDotOptions);
+    parseEnv("IE_VPUX_IR_STATISTICS", _irStatisticsOptions);
 #endif  // defined(VPUX_DEVELOPER_BUILD) || !defined(NDEBUG)
 
     if (_log.isActive(LogLevel::Info)) {
@@ -327,6 +357,11 @@ void DeveloperConfig::setup(mlir::PassManager& pm) const {
     if (!_printDotOptions.empty()) {
         addDotPrinter(pm, _printDotOptions);
     }
+
+    // IR statistics
+    if (!_irStatisticsOptions.empty()) {
+        addIRStatisticsPrinter(pm, _irStatisticsOptions);
+    }
 }
 
 }  // namespace
@@ -452,11 +487,14 @@ CNNNetwork prepareNetwork(const std::shared_ptr<ngraph::Function>& func, const I
     return cnnNet;
 }
 
-auto importNetwork(mlir::MLIRContext* ctx, CNNNetwork cnnNet, const DeveloperConfig& devConf,
-                   std::vector<vpux::PreProcessInfo>& preProcInfo, mlir::TimingScope& rootTiming, bool enableProfiling,
-                   bool stubLayers, vpux::VPU::ArchKind arch, Logger log) {
+auto importNetwork(mlir::MLIRContext* ctx, CNNNetwork cnnNet, std::vector<vpux::PreProcessInfo>& preProcInfo,
+                   mlir::TimingScope& rootTiming, bool enableProfiling, bool stubLayers, vpux::VPU::ArchKind arch,
+                   Logger log) {
     auto importTiming = rootTiming.nest("Import network");
-    return IE::importNetwork(ctx, cnnNet, preProcInfo, devConf.useSharedConstants(), importTiming, enableProfiling,
+
+    // The weights are shared with the nGraph Constant nodes and are printed as `dense` constants, so the IR printing
+    // elides them unless IE_VPUX_PRINT_FULL_CONSTANT is set and the crash reproducer can parse them back
+    return IE::importNetwork(ctx, cnnNet, preProcInfo, /*sharedConstants=*/true, importTiming, enableProfiling,
                              stubLayers, arch, log.nest());
 }
 
@@ -551,9 +589,6 @@ std::shared_ptr<INetworkDescription> vpux::CompilerImpl::compile(const std::shar
     mlir::DefaultTimingManager tm;
     devConf.setup(tm);
 
-    mlir::DialectRegistry registry;
-    registerDialects(registry);
-
     bool enableDummyOpReplacement = false;
 
     bool inAndOutFp16 = false;
@@ -585,13 +620,18 @@ std::shared_ptr<INetworkDescription> vpux::CompilerImpl::compile(const std::shar
         inAndOutFp16 = inFp16 && outFp16;
     }
 
-    if (enableDummyOpReplacement) {
-        registerInterfacesWithReplacement(registry);
-    }
-
     OV_ITT_TASK_CHAIN(COMPILER_IMPLEMENTATION, itt::domains::VPUXPlugin, "CompilerImpl::compile", "MLIRContext");
 
-    mlir::MLIRContext ctx(registry);
+    const auto concurrentCompilations = ++activeCompilations;
+    VPUX_SCOPE_EXIT {
+        --activeCompilations;
+    };
+
+    mlir::MLIRContext ctx(getDialectRegistry(enableDummyOpReplacement));
+    if (concurrentCompilations > 1) {
+        log.debug("{0} compilations are running concurrently, disable multithreading", concurrentCompilations);
+        ctx.disableMultithreading();
+    }
     addLogging(ctx, log);
 
     OV_ITT_TASK_NEXT(COMPILER_IMPLEMENTATION, "PassManager");
@@ -600,6 +640,13 @@ std::shared_ptr<INetworkDescription> vpux::CompilerImpl::compile(const std::shar
     addLogging(pm, log);
     devConf.setup(pm);
 
+    std::shared_ptr<CompileTelemetry> telemetry;
+    const auto telemetryFile = config.get<COMPILER_TELEMETRY_FILE>();
+    if (!telemetryFile.empty()) {
+        telemetry = std::make_shared<CompileTelemetry>();
+        addTelemetry(pm, telemetry);
+    }
+
     auto rootTiming = tm.getRootScope();
 
     // TODO: somehow protect non-target cases
@@ -613,8 +660,13 @@ std::shared_ptr<INetworkDescription> vpux::CompilerImpl::compile(const std::shar
 
     OV_ITT_TASK_NEXT(COMPILER_IMPLEMENTATION, "importNetwork");
 
-    const auto module = importNetwork(&ctx, cnnNet, devConf, preProcInfo, rootTiming, config.get<PERF_COUNT>(),
-                                      enableDummyOpReplacement, arch, log);
+    mlir::OwningOpRef<mlir::ModuleOp> module;
+    {
+        TelemetryScope importTelemetry(telemetry.get(), "import-network");
+        module = importNetwork(&ctx, cnnNet, preProcInfo, rootTiming, config.get<PERF_COUNT>(),
+                               enableDummyOpReplacement, arch, log);
+        importTelemetry.setOperation(module.get());
+    }
 
     OV_ITT_TASK_NEXT(COMPILER_IMPLEMENTATION, "compileNetwork");
 
@@ -622,10 +674,22 @@ std::shared_ptr<INetworkDescription> vpux::CompilerImpl::compile(const std::shar
 
     OV_ITT_TASK_NEXT(COMPILER_IMPLEMENTATION, "exportNetwork");
 
-    const auto blob =
-            exportToELF(module.get(), preProcInfo, buildOVParams(func, inputsInfo), buildOVResults(func, outputsInfo));
-    std::vector<char> compiledNetwork(blob.size());
-    std::copy_n(reinterpret_cast<const char*>(blob.data()), blob.size(), compiledNetwork.data());
+    std::vector<char> compiledNetwork;
+    {
+        TelemetryScope exportTelemetry(telemetry.get(), "export-network", module.get());
+
+        // elf::Writer owns the image as unsigned bytes, convert it without zero-filling the destination first
+        // and release the source before the network description is parsed
+        const auto blob = exportToELF(module.get(), preProcInfo, buildOVParams(func, inputsInfo),
+                                      buildOVResults(func, outputsInfo));
+        compiledNetwork.assign(blob.begin(), blob.end());
+    }
+
+    if (telemetry != nullptr) {
+        log.info("Write compilation telemetry to '{0}'", telemetryFile);
+        telemetry->writeToFile(telemetryFile);
+    }
+
     return std::make_shared<VPUIPRegMapped::NetworkDescription>(std::move(compiledNetwork));
 
     OV_ITT_TASK_SKIP(COMPILER_IMPLEMENTATION);
@@ -0,0 +1,156 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/utils/ir_statistics.hpp"
+
+#include "vpux/compiler/core/passes.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <mlir/Pass/PassInstrumentation.h>
+
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Regex.h>
+
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+using namespace vpux;
+
+namespace {
+
+//
+// DumpIRStatisticsPass
+//
+
+class DumpIRStatisticsPass final : public DumpIRStatisticsBase<DumpIRStatisticsPass> {
+public:
+    DumpIRStatisticsPass() = default;
+    DumpIRStatisticsPass(StringRef fileName, Logger log): _fileName(fileName.str()) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+public:
+    mlir::LogicalResult initializeOptions(StringRef options) final;
+
+public:
+    void dump(mlir::Operation* op, StringRef afterPass);
+
+public:
+    bool checkPass(mlir::Pass* pass) const;
+
+private:
+    void safeRunOnModule() final {
+        dump(getOperation(), {});
+    }
+
+private:
+    std::string _fileName;
+    std::shared_ptr<llvm::Regex> _passNameFilter;
+};
+
+mlir::LogicalResult DumpIRStatisticsPass::initializeOptions(StringRef options) {
+    if (mlir::failed(Base::initializeOptions(options))) {
+        return mlir::failure();
+    }
+
+    if (outputFileOpt.hasValue()) {
+        _fileName = outputFileOpt.getValue();
+    }
+    if (afterPassOpt.hasValue()) {
+        _passNameFilter = std::make_shared<llvm::Regex>(afterPassOpt.getValue(), llvm::Regex::IgnoreCase);
+
+        std::string regexErr;
+        if (!_passNameFilter->isValid(regexErr)) {
+            VPUX_THROW("Invalid regular expression '{0}' : {1}", afterPassOpt.getValue(), regexErr);
+        }
+    }
+
+    return mlir::success();
+}
+
+bool DumpIRStatisticsPass::checkPass(mlir::Pass* pass) const {
+    VPUX_THROW_WHEN(_passNameFilter == nullptr, "Pass name filter was not specified");
+    return _passNameFilter->match(pass->getName()) || _passNameFilter->match(pass->getArgument());
+}
+
+void DumpIRStatisticsPass::dump(mlir::Operation* op, StringRef afterPass) {
+    const auto stats = getIRStatistics(op);
+
+    // Function passes might be run in parallel, so the dumps are serialized
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (_fileName.empty()) {
+        printIRStatisticsAsJson(stats, afterPass, Logger::getBaseStream());
+        return;
+    }
+
+    std::error_code err;
+    llvm::raw_fd_ostream stream(_fileName, err, llvm::sys::fs::OF_Append);
+    VPUX_THROW_WHEN(err, "Failed to open file '{0}' for write : {1}", _fileName, err.message());
+
+    printIRStatisticsAsJson(stats, afterPass, stream);
+}
+
+//
+// DumpIRStatisticsInstrumentation
+//
+
+class DumpIRStatisticsInstrumentation final : public mlir::PassInstrumentation {
+public:
+    void addPrinter(std::unique_ptr<DumpIRStatisticsPass> printer) {
+        _printers.push_back(std::move(printer));
+    }
+
+public:
+    void runAfterPass(mlir::Pass* pass, mlir::Operation* op) final;
+
+private:
+    std::vector<std::unique_ptr<DumpIRStatisticsPass>> _printers;
+};
+
+void DumpIRStatisticsInstrumentation::runAfterPass(mlir::Pass* pass, mlir::Operation* op) {
+    for (auto& printer : _printers) {
+        if (!printer->checkPass(pass)) {
+            continue;
+        }
+
+        printer->dump(op, pass->getArgument().empty() ? pass->getName() : pass->getArgument());
+    }
+}
+
+}  // namespace
+
+//
+// addIRStatisticsPrinter
+//
+
+void vpux::addIRStatisticsPrinter(mlir::PassManager& pm, StringRef options) {
+    auto instr = std::make_unique<DumpIRStatisticsInstrumentation>();
+
+    std::stringstream ss(options.str());
+    std::string split;
+    while (std::getline(ss, split, ',')) {
+        auto printer = std::make_unique<DumpIRStatisticsPass>();
+        VPUX_THROW_WHEN(mlir::failed(printer->initializeOptions(split)), "Failed to initialize options");
+
+        instr->addPrinter(std::move(printer));
+    }
+
+    pm.addInstrumentation(std::move(instr));
+}
+
+//
+// createDumpIRStatisticsPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::createDumpIRStatisticsPass(StringRef fileName, Logger log) {
+    return std::make_unique<DumpIRStatisticsPass>(fileName, log);
+}
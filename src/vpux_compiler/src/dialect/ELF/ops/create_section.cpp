@@ -8,6 +8,70 @@
 #include <vpux_elf/writer.hpp>
 #include "vpux/compiler/dialect/ELF/ops.hpp"
 
+#include "vpux/utils/IE/loop.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
+
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+// Upper bound for the constants folded at the same time, so only the section itself
+// keeps the full copy of the constant data
+constexpr size_t CONST_STAGING_SIZE = 64 * 1024 * 1024;
+
+Const::DeclareOp getConstOp(mlir::Operation& op) {
+    if (auto putOp = mlir::dyn_cast<ELF::PutOpInSectionOp>(op)) {
+        return putOp.inputArg().getDefiningOp<Const::DeclareOp>();
+    }
+    return mlir::dyn_cast<Const::DeclareOp>(op);
+}
+
+// The constants are independent from each other, so their content is folded by the worker threads
+// directly into the staging buffer and appended to the section by batches in the original order
+void serializeConstants(ArrayRef<Const::DeclareOp> constOps, elf::writer::BinaryDataSection<uint8_t>& section,
+                        std::vector<uint8_t>& staging, LoopExecPolicy policy) {
+    SmallVector<size_t> offsets;
+    offsets.reserve(constOps.size() + 1);
+
+    size_t batchBegin = 0;
+    while (batchBegin < constOps.size()) {
+        offsets.clear();
+        offsets.push_back(0);
+
+        size_t batchEnd = batchBegin;
+        while (batchEnd < constOps.size()) {
+            auto constOp = constOps[batchEnd];
+            const auto size = constOp.getBinarySize();
+            if (batchEnd > batchBegin && offsets.back() + size > CONST_STAGING_SIZE) {
+                break;
+            }
+
+            offsets.push_back(offsets.back() + size);
+            ++batchEnd;
+        }
+
+        staging.resize(offsets.back());
+
+        loop_1d(policy, checked_cast<int64_t>(batchEnd - batchBegin), [&](int64_t ind) {
+            const auto constInd = static_cast<size_t>(ind);
+            auto constOp = constOps[batchBegin + constInd];
+
+            const auto chunkSize = offsets[constInd + 1] - offsets[constInd];
+            const auto chunk = makeMutableArrayRef(reinterpret_cast<char*>(staging.data() + offsets[constInd]),
+                                                   chunkSize);
+
+            constOp.contentAttr().copyFoldedTo(chunk);
+        });
+
+        section.appendData(staging.data(), staging.size());
+        batchBegin = batchEnd;
+    }
+}
+
+}  // namespace
+
 void vpux::ELF::CreateSectionOp::serialize(elf::Writer& writer, vpux::ELF::SectionMapType& sectionMap,
                                            vpux::ELF::SymbolMapType& symbolMap) {
     VPUX_UNUSED(symbolMap);
@@ -16,14 +80,32 @@ void vpux::ELF::CreateSectionOp::serialize(elf::Writer& writer, vpux::ELF::Secti
     section->maskFlags(static_cast<elf::Elf_Xword>(secFlags()));
     section->setAddrAlign(secAddrAlign());
 
+    SmallVector<Const::DeclareOp> pendingConstOps;
+    std::vector<uint8_t> staging;
+    const auto policy = Const::getFoldingExecPolicy(getContext());
+
+    const auto flushConstants = [&]() {
+        serializeConstants(pendingConstOps, *section, staging, policy);
+        pendingConstOps.clear();
+    };
+
     auto block = getBody();
     for (auto& op : block->getOperations()) {
         if (op.hasTrait<vpux::ELF::BinaryOpInterface::Trait>()) {
+            if (auto constOp = getConstOp(op)) {
+                pendingConstOps.push_back(constOp);
+                continue;
+            }
+
+            flushConstants();
+
             auto binaryOp = llvm::cast<vpux::ELF::BinaryOpInterface>(op);
 
             binaryOp.serialize(*section);
         }
     }
 
+    flushConstants();
+
     sectionMap[getOperation()] = section;
 }
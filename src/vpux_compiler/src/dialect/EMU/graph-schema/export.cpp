@@ -261,7 +261,8 @@ SmallVector<EMU::BlobWriter::BinaryData> serializeBinaryData(EMU::BlobWriter& wr
 
     SmallVector<std::vector<uint64_t>> bufs(constOps.size());
 
-    loop_1d(LoopExecPolicy::Parallel, checked_cast<int64_t>(constOps.size()), [&](int64_t ind) {
+    const auto policy = Const::getFoldingExecPolicy(netFunc.getContext());
+    loop_1d(policy, checked_cast<int64_t>(constOps.size()), [&](int64_t ind) {
         const auto attr = constOps[static_cast<size_t>(ind)].contentAttr();
 
         const auto type = attr.getType();
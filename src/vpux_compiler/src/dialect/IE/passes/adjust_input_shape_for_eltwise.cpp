@@ -75,6 +75,8 @@ mlir::FailureOr<int64_t> getRealDataSize(Const::DeclareOp constOp) {
         return denseBaseAttr.getType().getNumElements();
     } else if (auto opaqueBaseAttr = baseContent.dyn_cast<mlir::OpaqueElementsAttr>()) {
         return opaqueBaseAttr.getType().getNumElements();
+    } else if (auto sharedBaseAttr = baseContent.dyn_cast<Const::SharedElementsAttr>()) {
+        return sharedBaseAttr.getType().getNumElements();
     } else {
         VPUX_THROW("Got unsupported 'baseContent' in 'ContentAttr'");
     }
@@ -328,6 +330,9 @@ mlir::LogicalResult ExpandEltwisePattern::rewrite() {
         } else if (auto opaqueBaseAttr = baseContent.dyn_cast<mlir::OpaqueElementsAttr>()) {
             newContentAttr = Const::ContentAttr::get(opaqueBaseAttr);
             realDataShape = opaqueBaseAttr.getType().getShape();
+        } else if (auto sharedBaseAttr = baseContent.dyn_cast<Const::SharedElementsAttr>()) {
+            newContentAttr = Const::ContentAttr::get(sharedBaseAttr);
+            realDataShape = sharedBaseAttr.getType().getShape();
         } else {
             VPUX_THROW("Got unsupported 'baseContent' in 'ContentAttr'");
         }
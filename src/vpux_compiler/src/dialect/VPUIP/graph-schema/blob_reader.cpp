@@ -104,7 +104,9 @@ private:
 
 }  // namespace
 
-vpux::VPUIP::BlobReader::BlobReader(mlir::MLIRContext* ctx, ArrayRef<char> blob, Logger log): _ctx(ctx), _log(log) {
+vpux::VPUIP::BlobReader::BlobReader(mlir::MLIRContext* ctx, ArrayRef<char> blob, Logger log,
+                                    const WeightsSegmentReader* weights)
+        : _ctx(ctx), _log(log), _weights(weights) {
     VPUX_THROW_UNLESS(!blob.empty(), "Blob is empty");
 
     flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(blob.data()), blob.size());
@@ -322,9 +324,19 @@ mlir::Value vpux::VPUIP::BlobReader::createTensorOp(mlir::OpBuilder& builder, co
         const auto tensorType = mlir::RankedTensorType::get(importedType.getShape(), importedType.getElementType());
         const auto numElems = tensorType.getNumElements();
         const Byte elemTypeSize = getElemTypeSize(tensorType);
-        const auto rawBuffer = makeArrayRef(
-                reinterpret_cast<const char*>(_graphFile->binary_data()->Get(_constCounter++)->data()->Data()),
-                numElems * elemTypeSize.count());
+        const auto constInd = _constCounter++;
+        const auto binaryData = _graphFile->binary_data()->Get(constInd);
+
+        ArrayRef<char> rawBuffer;
+        if (binaryData->data()->size() == 0 && binaryData->length() != 0) {
+            VPUX_THROW_UNLESS(_weights != nullptr, "Constant '{0}' is stored out-of-line, but got no weights segment",
+                              constInd);
+            rawBuffer = _weights->getEntry(checked_cast<uint64_t>(constInd));
+        } else {
+            rawBuffer = makeArrayRef(reinterpret_cast<const char*>(binaryData->data()->Data()),
+                                     binaryData->data()->size() * sizeof(uint64_t));
+        }
+        rawBuffer = rawBuffer.take_front(numElems * elemTypeSize.count());
 
         bool isSplatBuffer = false;
         const auto value = mlir::DenseElementsAttr::getFromRawBuffer(tensorType, rawBuffer, isSplatBuffer);
@@ -817,16 +817,38 @@ VPUIP::BlobWriter::IndirectDataReference vpux::VPUIP::BlobWriter::createIndirect
     return builder.Finish();
 }
 
-VPUIP::BlobWriter::BinaryData vpux::VPUIP::BlobWriter::createBinaryData(ArrayRef<uint64_t> content,
-                                                                        vpux::NDTypeInterface type,
+VPUIP::BlobWriter::BinaryData vpux::VPUIP::BlobWriter::createBinaryData(vpux::NDTypeInterface type,
+                                                                        BinaryDataStorage& storage,
                                                                         bool csram_cacheable) {
     const auto totalByteSize = type.getTotalAllocSize();
-    const auto serializedContent = createVector(content);
+    const auto numWords = alignVal(static_cast<size_t>(totalByteSize.count()), sizeof(uint64_t)) / sizeof(uint64_t);
+
+    uint8_t* data = nullptr;
+    storage = BinaryDataStorage(_impl.CreateUninitializedVector(numWords, sizeof(uint64_t), &data));
 
     MVCNN::BinaryDataBuilder builder(_impl);
     builder.add_underlying_type(MVCNN::DType::DType_U8);
     builder.add_length(totalByteSize.count());
-    builder.add_data(serializedContent);
+    builder.add_data(storage);
+    builder.add_csram_cacheable(csram_cacheable);
+    return builder.Finish();
+}
+
+MutableArrayRef<char> vpux::VPUIP::BlobWriter::getBinaryDataStorage(BinaryDataStorage storage) {
+    // FlatBufferBuilder grows downwards, so offsets are counted from the end of the buffer
+    auto* vec = reinterpret_cast<flatbuffers::Vector<uint64_t>*>(_impl.GetCurrentBufferPointer() + _impl.GetSize() -
+                                                                 storage.o);
+    return makeMutableArrayRef(reinterpret_cast<char*>(vec->data()), vec->size() * sizeof(uint64_t));
+}
+
+VPUIP::BlobWriter::BinaryData vpux::VPUIP::BlobWriter::createOutOfLineBinaryData(vpux::NDTypeInterface type,
+                                                                                 bool csram_cacheable) {
+    const auto emptyData = _impl.CreateVector(static_cast<const uint64_t*>(nullptr), 0);
+
+    MVCNN::BinaryDataBuilder builder(_impl);
+    builder.add_underlying_type(MVCNN::DType::DType_U8);
+    builder.add_length(type.getTotalAllocSize().count());
+    builder.add_data(emptyData);
     builder.add_csram_cacheable(csram_cacheable);
     return builder.Finish();
 }
@@ -7,6 +7,7 @@
 
 #include "vpux/compiler/dialect/VPUIP/graph-schema/export.hpp"
 
+#include "vpux/compiler/core/cost_model_utils.hpp"
 #include "vpux/compiler/dialect/IE/ops.hpp"
 #include "vpux/compiler/dialect/IE/utils/resources.hpp"
 #include "vpux/compiler/dialect/IERT/ops.hpp"
@@ -14,11 +15,14 @@
 #include "vpux/compiler/dialect/VPUIP/graph-schema/blob_writer.hpp"
 #include "vpux/compiler/dialect/VPUIP/graph-schema/schema.hpp"
 #include "vpux/compiler/dialect/VPUIP/graph-schema/utils.hpp"
+#include "vpux/compiler/dialect/VPUIP/graph-schema/weights_segment.hpp"
 #include "vpux/compiler/dialect/VPUIP/ops.hpp"
 #include "vpux/compiler/dialect/VPUIP/utils.hpp"
 #include "vpux/compiler/dialect/VPURT/ops.hpp"
+#include "vpux/compiler/utils/strings.hpp"
 
 #include "vpux/utils/IE/loop.hpp"
+#include "vpux/utils/IE/prefix.hpp"
 #include "vpux/utils/core/array_ref.hpp"
 #include "vpux/utils/core/checked_cast.hpp"
 #include "vpux/utils/core/enums.hpp"
@@ -27,6 +31,7 @@
 #include "vpux/utils/core/numeric.hpp"
 #include "vpux/utils/core/range.hpp"
 #include "vpux/utils/core/string_ref.hpp"
+#include "vpux/utils/plugin/predicted_cycles.hpp"
 
 #include <llvm/ADT/DenseMap.h>
 #include <mlir/IR/BuiltinOps.h>
@@ -36,6 +41,8 @@
 #include <transformations/utils/utils.hpp>
 #include <version.hpp>
 
+#include <algorithm>
+#include <map>
 #include <unordered_map>
 
 // Base of frequency values used in tables (in MHz).
@@ -442,43 +449,76 @@ void serializeTensorDecls(VPUIP::BlobWriter& writer, mlir::FuncOp netFunc, mlir:
     });
 }
 
-SmallVector<VPUIP::BlobWriter::BinaryData> serializeBinaryData(VPUIP::BlobWriter& writer, mlir::FuncOp netFunc,
-                                                               mlir::TimingScope& rootTiming, Logger log) {
-    auto scopeTiming = rootTiming.nest("Serialize binary data");
+SmallVector<VPUIP::BlobWriter::BinaryData> serializeOutOfLineBinaryData(VPUIP::BlobWriter& writer,
+                                                                        ArrayRef<Const::DeclareOp> constOps,
+                                                                        VPUIP::WeightsSegmentWriter& weights,
+                                                                        Logger log) {
+    SmallVector<VPUIP::BlobWriter::BinaryData> binaryData(constOps.size());
 
-    auto constOps = to_small_vector(netFunc.getOps<Const::DeclareOp>());
+    // The content is folded only when the weights segment is written, the blob keeps the lengths only
+    for (auto constTensorInd : irange(constOps.size())) {
+        auto constOp = constOps[constTensorInd];
+        const auto type = constOp.getType().cast<vpux::NDTypeInterface>();
 
-    SmallVector<std::vector<uint64_t>> bufs(constOps.size());
+        log.trace("Got out-of-line constant at '{0}' with type '{1}'", constOp->getLoc(), constOp.getType());
 
-    loop_1d(LoopExecPolicy::Parallel, checked_cast<int64_t>(constOps.size()), [&](int64_t ind) {
-        const auto attr = constOps[static_cast<size_t>(ind)].contentAttr();
+        binaryData[constTensorInd] = writer.createOutOfLineBinaryData(type);
 
-        const auto type = attr.getType();
-        const auto content = attr.fold();
+        writer.createTensorRef(constOp.output(), printToString("constant-{0}", constTensorInd),
+                               VPURT::BufferSection::Constant, checked_cast<uint32_t>(constTensorInd), 0);
 
-        const auto totalByteSize = type.cast<vpux::NDTypeInterface>().getTotalAllocSize();
-        bufs[static_cast<size_t>(ind)].resize(
-                alignVal(static_cast<size_t>(totalByteSize.count()), sizeof(uint64_t)) / sizeof(uint64_t), 0);
+        const auto entryInd = weights.append(type.getTotalAllocSize(), [constOp](MutableArrayRef<char> storage) {
+            constOp.contentAttr().copyFoldedTo(storage);
+        });
+        VPUX_THROW_UNLESS(entryInd == constTensorInd, "Weights segment entry '{0}' doesn't match constant '{1}'",
+                          entryInd, constTensorInd);
+    }
 
-        const auto buf = makeMutableArrayRef(reinterpret_cast<char*>(bufs[static_cast<size_t>(ind)].data()),
-                                             totalByteSize.count());
-        content.copyTo(buf);
-    });
+    return binaryData;
+}
+
+SmallVector<VPUIP::BlobWriter::BinaryData> serializeBinaryData(VPUIP::BlobWriter& writer, mlir::FuncOp netFunc,
+                                                               VPUIP::WeightsSegmentWriter* weights,
+                                                               mlir::TimingScope& rootTiming, Logger log) {
+    auto scopeTiming = rootTiming.nest("Serialize binary data");
+
+    auto constOps = to_small_vector(netFunc.getOps<Const::DeclareOp>());
+
+    if (weights != nullptr) {
+        return serializeOutOfLineBinaryData(writer, constOps, *weights, log);
+    }
 
     SmallVector<VPUIP::BlobWriter::BinaryData> binaryData(constOps.size());
+    SmallVector<VPUIP::BlobWriter::BinaryDataStorage> storages(constOps.size());
 
+    // Reserve the space for all constants first, so the folded content can be written directly into the blob
+    // without keeping an intermediate copy of all constants at once
     for (auto constTensorInd : irange(constOps.size())) {
         auto constOp = constOps[constTensorInd];
-        const auto& content = bufs[constTensorInd];
 
         log.trace("Got constant at '{0}' with type '{1}'", constOp->getLoc(), constOp.getType());
 
-        binaryData[constTensorInd] = writer.createBinaryData(content, constOp.getType().cast<vpux::NDTypeInterface>());
+        binaryData[constTensorInd] =
+                writer.createBinaryData(constOp.getType().cast<vpux::NDTypeInterface>(), storages[constTensorInd]);
 
         writer.createTensorRef(constOp.output(), printToString("constant-{0}", constTensorInd),
                                VPURT::BufferSection::Constant, checked_cast<uint32_t>(constTensorInd), 0);
     }
 
+    // No objects are added to the blob in the loop below, so the reserved storage doesn't move
+    // and only the constants being folded by the worker threads are held in memory at the same time
+    const auto policy = Const::getFoldingExecPolicy(netFunc.getContext());
+    loop_1d(policy, checked_cast<int64_t>(constOps.size()), [&](int64_t ind) {
+        const auto constOp = constOps[static_cast<size_t>(ind)];
+
+        const auto totalByteSize = constOp.getType().cast<vpux::NDTypeInterface>().getTotalAllocSize();
+        const auto storage = writer.getBinaryDataStorage(storages[static_cast<size_t>(ind)]);
+
+        // The weights tables are relocated in the blob storage, see Const::ContentAttr::copyFoldedTo
+        constOp.contentAttr().copyFoldedTo(storage.take_front(static_cast<size_t>(totalByteSize.count())));
+        std::fill(storage.begin() + totalByteSize.count(), storage.end(), 0);
+    });
+
     return binaryData;
 }
 
@@ -575,13 +615,11 @@ flatbuffers::Offset<MVCNN::GraphFile> createGraphFile(VPUIP::BlobWriter& writer,
     return graphBuilder.Finish();
 }
 
-}  // namespace
-
-flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mlir::TimingScope& rootTiming,
-                                                      const std::vector<vpux::PreProcessInfo>& preprocessInfo,
-                                                      const std::vector<std::shared_ptr<const ov::Node>>& parameters,
-                                                      const std::vector<std::shared_ptr<const ov::Node>>& results,
-                                                      Logger log) {
+flatbuffers::DetachedBuffer exportToBlobImpl(mlir::ModuleOp module, mlir::TimingScope& rootTiming,
+                                             const std::vector<vpux::PreProcessInfo>& preprocessInfo,
+                                             const std::vector<std::shared_ptr<const ov::Node>>& parameters,
+                                             const std::vector<std::shared_ptr<const ov::Node>>& results,
+                                             VPUIP::WeightsSegmentWriter* weights, Logger log) {
     log.setName("VPUIP::BackEnd");
 
     log.trace("Extract 'IE.{0}' from Module", IE::CNNNetworkOp::getOperationName());
@@ -597,7 +635,7 @@ flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mli
                                             preprocessInfo, parameters, results, log);
 
     serializeTensorDecls(writer, netFunc, rootTiming);
-    const auto binaryData = serializeBinaryData(writer, netFunc, rootTiming, log);
+    const auto binaryData = serializeBinaryData(writer, netFunc, weights, rootTiming, log);
     const auto virtBarriers = serializeVirtBarriers(writer, netFunc, withDynamicBarriers, rootTiming, log);
     const auto taskLists = serializeTaskLists(writer, netFunc, rootTiming, log);
     const auto kernelData = serializeKernelData(writer, netFunc, rootTiming, log);
@@ -722,3 +760,122 @@ flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mli
 
     return detached;
 }
+
+//
+// Predicted cycles
+//
+
+profiling::TaskInfo::ExecType getProfilingExecType(VPU::ExecutorKind executor) {
+    switch (executor) {
+    case VPU::ExecutorKind::DMA_NN:
+        return profiling::TaskInfo::ExecType::DMA;
+    case VPU::ExecutorKind::NCE:
+    case VPU::ExecutorKind::DPU:
+        return profiling::TaskInfo::ExecType::DPU;
+    case VPU::ExecutorKind::SHAVE_UPA:
+    case VPU::ExecutorKind::SHAVE_NN:
+    case VPU::ExecutorKind::SHAVE_ACT:
+        return profiling::TaskInfo::ExecType::SW;
+    default:
+        return profiling::TaskInfo::ExecType::NONE;
+    }
+}
+
+// Task name as it is reported by the profiling parser - without the profiling metadata suffix
+std::string getProfiledTaskName(std::string name) {
+    name = name.substr(0, name.find("_PROF"));
+    if (!name.empty() && name.back() == '/') {
+        name.pop_back();
+    }
+    if (!name.empty() && name.back() == ORIGINAL_NAME_SEPARATOR) {
+        name.pop_back();
+    }
+    return name;
+}
+
+std::string getPredictedTaskOpType(mlir::Operation* op) {
+    if (auto nceTask = mlir::dyn_cast<VPUIP::NCEClusterTaskOp>(op)) {
+        return stringifyEnum(nceTask.task_type()).str();
+    }
+    if (auto swKernel = mlir::dyn_cast<VPUIP::SwKernelOp>(op)) {
+        return swKernel.kernelFunction().getLeafReference().getValue().str();
+    }
+    return op->getName().stripDialect().str();
+}
+
+}  // namespace
+
+flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mlir::TimingScope& rootTiming,
+                                                      const std::vector<vpux::PreProcessInfo>& preprocessInfo,
+                                                      const std::vector<std::shared_ptr<const ov::Node>>& parameters,
+                                                      const std::vector<std::shared_ptr<const ov::Node>>& results,
+                                                      Logger log) {
+    return exportToBlobImpl(module, rootTiming, preprocessInfo, parameters, results, nullptr, log);
+}
+
+flatbuffers::DetachedBuffer vpux::VPUIP::exportToBlob(mlir::ModuleOp module, mlir::TimingScope& rootTiming,
+                                                      const std::vector<vpux::PreProcessInfo>& preprocessInfo,
+                                                      const std::vector<std::shared_ptr<const ov::Node>>& parameters,
+                                                      const std::vector<std::shared_ptr<const ov::Node>>& results,
+                                                      WeightsSegmentWriter& weights, Logger log) {
+    return exportToBlobImpl(module, rootTiming, preprocessInfo, parameters, results, &weights, log);
+}
+
+std::vector<char> vpux::VPUIP::exportPredictedCycles(mlir::ModuleOp module, uint32_t alignment, Logger log) {
+    log.setName("VPUIP::BackEnd");
+
+    IE::CNNNetworkOp netOp;
+    mlir::FuncOp netFunc;
+    IE::CNNNetworkOp::getFromModule(module, netOp, netFunc);
+
+    if (netOp.getProfilingOutputsInfo().empty()) {
+        return {};
+    }
+
+    profiling::PredictedCycles predicted;
+    predicted.frequencyMHz = VPU::getDpuFrequency(VPU::getArch(module));
+
+    // Tasks of the same operation, which start at the same cycle (e.g. per-cluster tasks), are executed in parallel,
+    // so only the longest of them is counted. Sequential tasks of the operation are summed.
+    std::map<std::pair<std::string, profiling::TaskInfo::ExecType>, size_t> taskIndex;
+    std::map<std::pair<size_t, int64_t>, uint64_t> parallelTasksCycles;
+
+    netFunc.walk([&](VPURT::TaskOp taskOp) {
+        const auto beginAttr = taskOp->getAttrOfType<mlir::IntegerAttr>(cycleBegin);
+        const auto endAttr = taskOp->getAttrOfType<mlir::IntegerAttr>(cycleEnd);
+        if (beginAttr == nullptr || endAttr == nullptr || endAttr.getInt() <= beginAttr.getInt()) {
+            return;
+        }
+
+        const auto execType = getProfilingExecType(taskOp.getExecutorKind());
+        if (execType == profiling::TaskInfo::ExecType::NONE) {
+            return;
+        }
+
+        const auto fullName = stringifyLocation(taskOp->getLoc());
+        // Timestamp DMAs are added by the profiling, they aren't reported as separate tasks
+        if (execType == profiling::TaskInfo::ExecType::DMA && fullName.find("_PROF") != std::string::npos) {
+            return;
+        }
+
+        auto name = getProfiledTaskName(fullName);
+        const auto task = taskIndex.emplace(std::make_pair(name, execType), predicted.tasks.size());
+        if (task.second) {
+            log.trace("Got predicted cycles for '{0}' task '{1}'", taskOp.getExecutorKind(), name);
+            predicted.tasks.push_back({std::move(name), getPredictedTaskOpType(taskOp.getInnerTaskOp()), execType, 0});
+        }
+
+        auto& cycles = parallelTasksCycles[std::make_pair(task.first->second, beginAttr.getInt())];
+        cycles = std::max(cycles, checked_cast<uint64_t>(endAttr.getInt() - beginAttr.getInt()));
+    });
+
+    if (predicted.tasks.empty()) {
+        return {};
+    }
+
+    for (const auto& p : parallelTasksCycles) {
+        predicted.tasks[p.first.first].cycles += p.second;
+    }
+
+    return profiling::serializePredictedCycles(predicted, alignment);
+}
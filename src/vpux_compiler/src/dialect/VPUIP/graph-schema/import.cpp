@@ -12,7 +12,19 @@ namespace vpux {
 namespace VPUIP {
 
 mlir::OwningOpRef<mlir::ModuleOp> importBlob(mlir::MLIRContext* ctx, const std::vector<char>& blob, Logger log) {
-    return BlobReader(ctx, blob, log).read();
+    const auto segment = WeightsSegmentReader::findTrailingSegment(blob);
+    if (!segment.hasValue()) {
+        return BlobReader(ctx, blob, log).read();
+    }
+
+    const WeightsSegmentReader weights(segment.getValue());
+    const auto metadata = makeArrayRef(blob).drop_back(segment->size());
+    return BlobReader(ctx, metadata, log, &weights).read();
+}
+
+mlir::OwningOpRef<mlir::ModuleOp> importBlob(mlir::MLIRContext* ctx, const std::vector<char>& blob,
+                                             const WeightsSegmentReader& weights, Logger log) {
+    return BlobReader(ctx, blob, log, &weights).read();
 }
 
 }  // namespace VPUIP
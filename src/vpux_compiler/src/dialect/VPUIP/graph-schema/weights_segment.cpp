@@ -0,0 +1,187 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/dialect/VPUIP/graph-schema/weights_segment.hpp"
+
+#include "vpux/utils/IE/loop.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/numeric.hpp"
+
+#include <llvm/Support/Error.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace vpux;
+
+//
+// WeightsSegmentWriter
+//
+
+vpux::VPUIP::WeightsSegmentWriter::WeightsSegmentWriter(uint32_t alignment, Byte stagingSize)
+        : _alignment(alignment), _stagingSize(stagingSize) {
+    VPUX_THROW_UNLESS(alignment >= alignof(WeightsSegmentTableEntry) && isPowerOfTwo(alignment),
+                      "Unsupported weights segment alignment '{0}'", alignment);
+}
+
+uint64_t vpux::VPUIP::WeightsSegmentWriter::append(Byte size, ContentWriter writer) {
+    const auto offset = alignVal<uint64_t>(_dataSize, _alignment);
+    const auto byteSize = checked_cast<uint64_t>(size.count());
+
+    _entries.push_back({{offset, byteSize}, std::move(writer)});
+    _dataSize = offset + byteSize;
+
+    return _entries.size() - 1;
+}
+
+uint64_t vpux::VPUIP::WeightsSegmentWriter::getSegmentSize() const {
+    return alignVal<uint64_t>(_dataSize, _alignment) + _entries.size() * sizeof(WeightsSegmentTableEntry) +
+           sizeof(WeightsSegmentFooter);
+}
+
+void vpux::VPUIP::WeightsSegmentWriter::write(llvm::raw_ostream& stream, LoopExecPolicy policy, Logger log) const {
+    const auto tableOffset = alignVal<uint64_t>(_dataSize, _alignment);
+    const auto stagingSize = checked_cast<uint64_t>(_stagingSize.count());
+
+    // End of the entry content including the padding up to the next entry
+    const auto getChunkEnd = [&](size_t entryInd) {
+        return entryInd + 1 < _entries.size() ? _entries[entryInd + 1].location.offset : tableOffset;
+    };
+
+    std::vector<char> staging;
+
+    // The entries are produced by batches, so only the staging buffer is held in memory at the same time
+    size_t batchBegin = 0;
+    while (batchBegin < _entries.size()) {
+        const auto batchOffset = _entries[batchBegin].location.offset;
+
+        size_t batchEnd = batchBegin + 1;
+        while (batchEnd < _entries.size() && getChunkEnd(batchEnd) - batchOffset <= stagingSize) {
+            ++batchEnd;
+        }
+
+        const auto batchSize = getChunkEnd(batchEnd - 1) - batchOffset;
+        staging.resize(checked_cast<size_t>(batchSize));
+
+        log.trace("Write weights segment entries [{0}, {1}), {2} bytes", batchBegin, batchEnd, batchSize);
+
+        loop_1d(policy, checked_cast<int64_t>(batchEnd - batchBegin), [&](int64_t ind) {
+            const auto entryInd = batchBegin + static_cast<size_t>(ind);
+            const auto& entry = _entries[entryInd];
+
+            const auto chunk = makeMutableArrayRef(staging.data() + (entry.location.offset - batchOffset),
+                                                   checked_cast<size_t>(getChunkEnd(entryInd) - entry.location.offset));
+
+            entry.writer(chunk.take_front(checked_cast<size_t>(entry.location.size)));
+            std::fill(chunk.begin() + entry.location.size, chunk.end(), 0);
+        });
+
+        stream.write(staging.data(), staging.size());
+        batchBegin = batchEnd;
+    }
+
+    for (const auto& entry : _entries) {
+        stream.write(reinterpret_cast<const char*>(&entry.location), sizeof(entry.location));
+    }
+
+    WeightsSegmentFooter footer = {};
+    std::memcpy(footer.magic, WEIGHTS_SEGMENT_MAGIC, sizeof(footer.magic));
+    footer.version = WEIGHTS_SEGMENT_VERSION;
+    footer.alignment = _alignment;
+    footer.numEntries = _entries.size();
+    footer.tableOffset = tableOffset;
+    footer.segmentSize = getSegmentSize();
+    stream.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+}
+
+//
+// WeightsSegmentReader
+//
+
+namespace {
+
+bool readFooter(ArrayRef<char> data, VPUIP::WeightsSegmentFooter& footer) {
+    if (data.size() < sizeof(footer)) {
+        return false;
+    }
+
+    // The segment might be placed at unaligned offset, so the fields are copied instead of being accessed in place
+    std::memcpy(&footer, data.end() - sizeof(footer), sizeof(footer));
+    return StringRef(footer.magic, sizeof(footer.magic)) == VPUIP::WEIGHTS_SEGMENT_MAGIC;
+}
+
+}  // namespace
+
+Optional<ArrayRef<char>> vpux::VPUIP::WeightsSegmentReader::findTrailingSegment(ArrayRef<char> blob) {
+    WeightsSegmentFooter footer = {};
+    if (!readFooter(blob, footer) || footer.segmentSize > blob.size()) {
+        return None;
+    }
+
+    return blob.take_back(checked_cast<size_t>(footer.segmentSize));
+}
+
+vpux::VPUIP::WeightsSegmentReader::WeightsSegmentReader(ArrayRef<char> segment): _segment(segment) {
+}
+
+vpux::VPUIP::WeightsSegmentReader::WeightsSegmentReader(std::string filePath): _filePath(std::move(filePath)) {
+}
+
+vpux::VPUIP::WeightsSegmentReader::~WeightsSegmentReader() = default;
+
+void vpux::VPUIP::WeightsSegmentReader::init() const {
+    if (!_filePath.empty()) {
+        uint64_t fileSize = 0;
+        VPUX_THROW_WHEN(llvm::sys::fs::file_size(_filePath, fileSize), "Failed to get size of weights file '{0}'",
+                        _filePath);
+
+        auto file = llvm::sys::fs::openNativeFileForRead(_filePath);
+        VPUX_THROW_UNLESS(file, "Failed to open weights file '{0}' : {1}", _filePath,
+                          llvm::toString(file.takeError()));
+
+        std::error_code ec;
+        _mapping = std::make_unique<llvm::sys::fs::mapped_file_region>(
+                *file, llvm::sys::fs::mapped_file_region::readonly, checked_cast<size_t>(fileSize), 0, ec);
+        // The mapping keeps its own reference to the file, so the descriptor isn't needed anymore
+        llvm::sys::fs::closeFile(*file);
+        VPUX_THROW_WHEN(ec, "Failed to map weights file '{0}' : {1}", _filePath, ec.message());
+
+        _segment = makeArrayRef(_mapping->const_data(), _mapping->size());
+    }
+
+    VPUX_THROW_UNLESS(readFooter(_segment, _footer), "Got invalid weights segment");
+    VPUX_THROW_UNLESS(_footer.version == WEIGHTS_SEGMENT_VERSION, "Unsupported weights segment version '{0}'",
+                      _footer.version);
+    VPUX_THROW_UNLESS(_footer.segmentSize == _segment.size(), "Weights segment size mismatch : '{0}' vs '{1}'",
+                      _footer.segmentSize, _segment.size());
+    VPUX_THROW_UNLESS(_footer.tableOffset + _footer.numEntries * sizeof(WeightsSegmentTableEntry) +
+                                      sizeof(WeightsSegmentFooter) ==
+                              _footer.segmentSize,
+                      "Got invalid weights segment offset table");
+}
+
+uint64_t vpux::VPUIP::WeightsSegmentReader::numEntries() const {
+    std::call_once(_initFlag, [this]() {
+        init();
+    });
+
+    return _footer.numEntries;
+}
+
+ArrayRef<char> vpux::VPUIP::WeightsSegmentReader::getEntry(uint64_t index) const {
+    VPUX_THROW_UNLESS(index < numEntries(), "Weights segment entry index '{0}' is out of range '{1}'", index,
+                      _footer.numEntries);
+
+    WeightsSegmentTableEntry entry = {};
+    std::memcpy(&entry, _segment.data() + _footer.tableOffset + index * sizeof(entry), sizeof(entry));
+
+    VPUX_THROW_UNLESS(entry.offset + entry.size <= _footer.tableOffset,
+                      "Weights segment entry '{0}' is out of the segment bounds", index);
+
+    return _segment.slice(checked_cast<size_t>(entry.offset), checked_cast<size_t>(entry.size));
+}
@@ -297,6 +297,17 @@ vpux::VPUIP::NetworkDescription::NetworkDescription(std::vector<char> blob)
     const auto* graphFile = MVCNN::GetGraphFile(_compiledNetwork.data());
     const auto* header = graphFile->header();
 
+    // The out-of-line weights segment is produced and read back by vpux-translate only, the runtime takes
+    // the constant content from the BinaryData entries of the blob
+    if (const auto* binaryData = graphFile->binary_data()) {
+        const auto isOutOfLine = [](const MVCNN::BinaryData* entry) {
+            return entry->data()->size() == 0 && entry->length() != 0;
+        };
+        VPUX_THROW_WHEN(std::any_of(binaryData->begin(), binaryData->end(), isOutOfLine),
+                        "Got VPUIP blob with the constants stored in the out-of-line weights segment, "
+                        "it can't be loaded by the runtime");
+    }
+
     if (header->identifier() != nullptr) {
         _name = header->identifier()->str();
     }
@@ -20,8 +20,12 @@
 #include "vpux/compiler/utils/logging.hpp"
 
 #include "vpux/compiler/dialect/VPUIP/utils.hpp"
+#include "vpux/utils/IE/loop.hpp"
 #include "vpux/utils/core/range.hpp"
 
+#include <cstring>
+#include <functional>
+
 using namespace vpux;
 namespace {
 
@@ -84,6 +88,71 @@ VPUIP::CopyOp createFusedCopyOp(mlir::Value allocDefiningOp, Const::DeclareOp de
     return fusedCopyOp;
 }
 
+// Returns the job, which copies the values of the folded constant into its segment of the fused buffer.
+// If the raw storage already holds the values in the requested type, it is copied as a whole,
+// otherwise the values are converted one by one.
+template <typename T>
+std::function<void()> makeSegmentCopy(const Const::Content& content, bool isSameStorageType,
+                                      MutableArrayRef<uint8_t> segment) {
+    const auto values = content.getValues<T>();
+    VPUX_THROW_UNLESS(values.size() * sizeof(T) == segment.size(),
+                      "Constant with '{0}' elements doesn't match its fused segment of '{1}' bytes", values.size(),
+                      segment.size());
+
+    if (isSameStorageType && !content.isSplat()) {
+        const auto rawBuf = content.getRawStorageBuf();
+        VPUX_THROW_UNLESS(rawBuf.size() == segment.size(), "Raw storage of '{0}' bytes doesn't match '{1}' bytes",
+                          rawBuf.size(), segment.size());
+
+        return [rawBuf, segment]() {
+            std::memcpy(segment.data(), rawBuf.data(), rawBuf.size());
+        };
+    }
+
+    return [values, segment]() {
+        // The segments are not aligned to the element size
+        for (size_t idx = 0; idx < values.size(); ++idx) {
+            const T value = values[idx];
+            std::memcpy(segment.data() + idx * sizeof(T), &value, sizeof(T));
+        }
+    };
+}
+
+// The folded content is stored in `contents`, since it must outlive the copy job
+std::function<void()> prepareSegmentCopy(Const::DeclareOp declOp, std::vector<Const::Content>& contents,
+                                         MutableArrayRef<uint8_t> segment) {
+    contents.push_back(declOp.content());
+    const auto& content = contents.back();
+
+    const auto contentType = declOp.getType().cast<vpux::NDTypeInterface>();
+    const auto storageElemType = content.getStorageElemType();
+
+    auto elemType = contentType.getElementType();
+    if (VPUIP::getCompressionSchemeAttr(contentType) != nullptr) {
+        elemType = getUInt8Type(elemType.getContext());
+    }
+
+    if (elemType.isa<mlir::quant::QuantizedType>() || elemType.isUnsignedInteger(8)) {
+        // If the weights are quantized they will be UI8 else it is activation window
+        return makeSegmentCopy<uint8_t>(content, storageElemType.isUnsignedInteger(8), segment);
+    } else if (elemType.isF16()) {
+        return makeSegmentCopy<float16>(content, storageElemType.isF16(), segment);
+    } else if (elemType.isSignedInteger(32)) {
+        return makeSegmentCopy<int32_t>(content, storageElemType.isSignedInteger(32), segment);
+    } else if (elemType.isInteger(1)) {
+        const auto packedNumElems = contentType.getNumElements() / CHAR_BIT;
+        const auto packedElemType = getUInt8Type(contentType.getContext());
+        const auto packedContentType =
+                contentType.changeShapeElemType(Shape({1, 1, 1, packedNumElems}), packedElemType);
+        contents.push_back(Const::Content::fromRawBuffer(packedContentType, content.getRawStorageBuf(),
+                                                         packedElemType, content.isSplat()));
+
+        return makeSegmentCopy<uint8_t>(contents.back(), true, segment);
+    }
+
+    VPUX_THROW("Unsupported data type for constant {0}", declOp.getLoc());
+}
+
 mlir::RankedTensorType FuseConstants::populateFusedConstantBuffer(vpux::ConstantFusing::ConstantVector& constantVector,
                                                                   std::vector<uint8_t>& fusedValuesBuf,
                                                                   mlir::PatternRewriter& rewriter) const {
@@ -94,60 +163,36 @@ mlir::RankedTensorType FuseConstants::populateFusedConstantBuffer(vpux::Constant
         }
     }
 
-    fusedValuesBuf.reserve(totalTensorsize);
+    fusedValuesBuf.resize(checked_cast<size_t>(totalTensorsize));
     SmallVector<int64_t> fusedConstShape({1, 1, 1, totalTensorsize});
     auto fusedConstElemType = getUInt8Type(rewriter.getContext());
     const auto fusedTensorType = mlir::RankedTensorType::get(fusedConstShape, fusedConstElemType);
 
+    // The layout of the fused constant is known in advance, so each constant is copied directly into its segment.
+    // Folding might create new types, which is not thread-safe if the context multithreading is disabled,
+    // so the constants are folded sequentially and only the copying is done in parallel.
+    std::vector<Const::Content> contents;
+    contents.reserve(constantVector.size() * 2);
+    SmallVector<std::function<void()>> segmentCopies;
+
+    int64_t offset = 0;
     for (auto& pair : constantVector) {
         // In case of some layers like MaxPool the weights won't be present so skip over to the next
         // constant for fusion
-        if (pair.second != nullptr) {
-            auto content = pair.second.content();
-            auto contentType = pair.second.getType().cast<vpux::NDTypeInterface>();
-            auto elemType = contentType.getElementType();
-
-            if (VPUIP::getCompressionSchemeAttr(contentType) != nullptr) {
-                elemType = getUInt8Type(elemType.getContext());
-            }
-
-            if (elemType.isa<mlir::quant::QuantizedType>() || elemType.isUnsignedInteger(8)) {
-                // If the weights are quantized they will be UI8 else it is activation window
-                auto values = content.getValues<uint8_t>();
-                for (size_t idx = 0; idx < values.size(); ++idx) {
-                    fusedValuesBuf.push_back(values[idx]);
-                }
-
-            } else if (elemType.isF16()) {
-                auto weightsValues = content.getValues<float16>();
-                for (size_t idx = 0; idx < weightsValues.size(); ++idx) {
-                    vpux::ConstantFusing::convertToU8<float16>(weightsValues[idx], fusedValuesBuf);
-                }
-
-            } else if (elemType.isSignedInteger(32)) {
-                auto weightTableValues = content.getValues<int32_t>();
-                for (size_t idx = 0; idx < weightTableValues.size(); ++idx) {
-                    vpux::ConstantFusing::convertToU8<int32_t>(weightTableValues[idx], fusedValuesBuf);
-                }
-
-            } else if (elemType.isInteger(1)) {
-                const auto packedNumElems = contentType.getNumElements() / CHAR_BIT;
-                const auto packedElemType = getUInt8Type(contentType.getContext());
-                const auto packedContentType =
-                        contentType.changeShapeElemType(Shape({1, 1, 1, packedNumElems}), packedElemType);
-                auto packedContent = Const::Content::fromRawBuffer(packedContentType, content.getRawStorageBuf(),
-                                                                   packedElemType, content.isSplat());
-
-                auto weightsSMValues = packedContent.getValues<uint8_t>();
-                for (size_t idx = 0; idx < weightsSMValues.size(); ++idx) {
-                    fusedValuesBuf.push_back(weightsSMValues[idx]);
-                }
-
-            } else {
-                VPUX_THROW("Unsupported data type for constant {0}", pair.second.getLoc());
-            }
+        if (pair.second == nullptr) {
+            continue;
         }
+
+        const auto size = vpux::getTotalSize(pair.second->getOpResult(0)).count();
+        const auto segment = makeMutableArrayRef(fusedValuesBuf.data() + offset, checked_cast<size_t>(size));
+        segmentCopies.push_back(prepareSegmentCopy(pair.second, contents, segment));
+        offset += size;
     }
+
+    loop_1d(LoopExecPolicy::Parallel, checked_cast<int64_t>(segmentCopies.size()), [&](int64_t ind) {
+        segmentCopies[ind]();
+    });
+
     return fusedTensorType;
 }
 
@@ -161,6 +161,14 @@ void PatchWeightsTablePass::patchWeightsTable(Const::DeclareOp cstOp, mlir::Oper
     // transformation
     auto newConstAttr = origConstAttr.relocateWeightsTablePointers(
             weightBasePointer, sparsityBasePtr, ShapeRef(offsets), weightsElemByteSize, weightsCompression);
+
+    // The constant is usually loaded by this DMA only, so its content is updated in place without creating
+    // a new operation
+    if (cstOp->hasOneUse()) {
+        cstOp.contentAttr(newConstAttr);
+        return;
+    }
+
     mlir::OpBuilder builder(cstOp);
 
     // Create new DeclareOp with the new content attribute and replace the old DeclareOp
@@ -13,6 +13,7 @@
 #include "vpux/compiler/dialect/VPU/utils/distributed_tensor_utils.hpp"
 #include "vpux/compiler/dialect/VPUIP/ops.hpp"
 #include "vpux/compiler/dialect/VPUIP/sw_utils.hpp"
+#include "vpux/compiler/dialect/VPUIP/task_unrolling.hpp"
 #include "vpux/compiler/dialect/VPUIP/utils.hpp"
 #include "vpux/compiler/dialect/VPURT/attributes.hpp"
 #include "vpux/compiler/dialect/VPURT/ops.hpp"
@@ -1189,10 +1190,15 @@ void UnrollClusterTilingPass::safeRunOnFunc() {
     patterns.add<ClusterNCERewriter>(&ctx, _log);
     patterns.add<ClusterSWRewriter>(&ctx, module, _log);
 
+    const VPUIP::UnrollingMetric metric(func);
+
     if (mlir::failed(
                 mlir::applyPatternsAndFoldGreedily(func, std::move(patterns), vpux::getDefaultGreedyRewriteConfig()))) {
         signalPassFailure();
+        return;
     }
+
+    metric.report(getArgumentName(), _log);
 }
 
 }  // namespace
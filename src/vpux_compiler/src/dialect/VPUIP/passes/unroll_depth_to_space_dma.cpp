@@ -12,6 +12,7 @@
 #include "vpux/compiler/dialect/IE/utils/resources.hpp"
 #include "vpux/compiler/dialect/VPU/attributes.hpp"
 #include "vpux/compiler/dialect/VPUIP/dma_descriptor_generator.hpp"
+#include "vpux/compiler/dialect/VPUIP/task_unrolling.hpp"
 #include "vpux/compiler/dialect/VPUIP/utils.hpp"
 #include "vpux/compiler/dialect/VPURT/attributes.hpp"
 #include "vpux/compiler/dialect/VPURT/ops.hpp"
@@ -353,10 +354,15 @@ void UnrollDepthToSpaceDMAPass::safeRunOnFunc() {
     mlir::RewritePatternSet patterns(&ctx);
     patterns.add<DepthToSpaceDMARewriter>(&ctx, dmaPortCount, _log);
 
+    const VPUIP::UnrollingMetric metric(func);
+
     if (mlir::failed(
                 mlir::applyPatternsAndFoldGreedily(func, std::move(patterns), vpux::getDefaultGreedyRewriteConfig()))) {
         signalPassFailure();
+        return;
     }
+
+    metric.report(getArgumentName(), _log);
 }
 
 }  // namespace
@@ -8,6 +8,7 @@
 #include "vpux/compiler/dialect/IE/utils/resources.hpp"
 #include "vpux/compiler/dialect/VPUIP/dma_descriptor_generator.hpp"
 #include "vpux/compiler/dialect/VPUIP/passes.hpp"
+#include "vpux/compiler/dialect/VPUIP/task_unrolling.hpp"
 
 #include "vpux/compiler/core/aliases_info.hpp"
 #include "vpux/compiler/core/cost_model_utils.hpp"
@@ -433,10 +434,15 @@ void UnrollExpandDMAPass::safeRunOnFunc() {
     mlir::RewritePatternSet patterns(&ctx);
     patterns.insert<ClusterExpandDMARewriter>(&ctx, dmaPortCount, _log);
 
+    const VPUIP::UnrollingMetric metric(func);
+
     if (mlir::failed(
                 mlir::applyPatternsAndFoldGreedily(func, std::move(patterns), vpux::getDefaultGreedyRewriteConfig()))) {
         signalPassFailure();
+        return;
     }
+
+    metric.report(getArgumentName(), _log);
 }
 
 }  // namespace
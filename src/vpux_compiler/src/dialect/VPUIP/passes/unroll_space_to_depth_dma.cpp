@@ -12,6 +12,7 @@
 #include "vpux/compiler/dialect/IE/utils/resources.hpp"
 #include "vpux/compiler/dialect/VPU/attributes.hpp"
 #include "vpux/compiler/dialect/VPUIP/dma_descriptor_generator.hpp"
+#include "vpux/compiler/dialect/VPUIP/task_unrolling.hpp"
 #include "vpux/compiler/dialect/VPURT/attributes.hpp"
 #include "vpux/compiler/dialect/VPURT/ops.hpp"
 #include "vpux/compiler/dialect/VPURT/task.hpp"
@@ -552,10 +553,15 @@ void UnrollSpaceToDepthDMAPass::safeRunOnFunc() {
     mlir::RewritePatternSet patterns(&ctx);
     patterns.add<SpaceToDepthDMARewriter>(&ctx, dmaPortCount, _log);
 
+    const VPUIP::UnrollingMetric metric(func);
+
     if (mlir::failed(
                 mlir::applyPatternsAndFoldGreedily(func, std::move(patterns), vpux::getDefaultGreedyRewriteConfig()))) {
         signalPassFailure();
+        return;
     }
+
+    metric.report(getArgumentName(), _log);
 }
 
 }  // namespace
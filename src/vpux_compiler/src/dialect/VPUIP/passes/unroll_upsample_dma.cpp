@@ -13,6 +13,7 @@
 #include "vpux/compiler/dialect/VPU/attributes.hpp"
 #include "vpux/compiler/dialect/VPUIP/convert_to_dma_utils.hpp"
 #include "vpux/compiler/dialect/VPUIP/dma_descriptor_generator.hpp"
+#include "vpux/compiler/dialect/VPUIP/task_unrolling.hpp"
 #include "vpux/compiler/dialect/VPURT/attributes.hpp"
 #include "vpux/compiler/dialect/VPURT/ops.hpp"
 #include "vpux/compiler/dialect/VPURT/task.hpp"
@@ -20,7 +21,6 @@
 #include "vpux/compiler/utils/rewriter.hpp"
 
 #include <llvm/ADT/DenseMap.h>
-#include <mlir/Transforms/GreedyPatternRewriteDriver.h>
 
 #include <numeric>
 
@@ -29,28 +29,22 @@ using namespace vpux;
 namespace {
 
 //
-// ClusterUpsamplingDMARewriter
+// UpsamplingDMAPart
 //
 
-class ClusterUpsamplingDMARewriter final : public mlir::OpRewritePattern<VPUIP::UpsamplingDMAOp> {
-public:
-    ClusterUpsamplingDMARewriter(mlir::MLIRContext* ctx, int64_t dmaPortCount, Logger log)
-            : mlir::OpRewritePattern<VPUIP::UpsamplingDMAOp>(ctx), _log(log), _ctx(ctx), _dmaPortCount(dmaPortCount) {
-        setDebugName("ClusterUpsamplingDMARewriter");
-
-        _cmxNameAttr = mlir::FlatSymbolRefAttr::get(ctx, stringifyEnum(VPU::MemoryKind::CMX_NN));
-    }
-
-    mlir::LogicalResult matchAndRewrite(VPUIP::UpsamplingDMAOp UpsamplingDMAOp,
-                                        mlir::PatternRewriter& rewriter) const final;
-
-private:
-    Logger _log;
-    mlir::MLIRContext* _ctx;
-    int64_t _dmaPortCount;
-    mlir::FlatSymbolRefAttr _cmxNameAttr;
+// The part of the UpsamplingDMA task, which is computed before the new tasks are inserted
+struct UpsamplingDMAPart final {
+    vpux::NDTypeInterface srcType;
+    int64_t srcOffset;
+    vpux::NDTypeInterface dstType;
+    int64_t dstOffset;
+    VPUIP::DmaDescriptorAttr dmaDescriptor;
+    mlir::Location loc;
+    int64_t port;
 };
 
+using UpsamplingDMAPlan = SmallVector<UpsamplingDMAPart>;
+
 static VPUIP::DmaDescriptorAttr generateUpsampingDmaDescriptor(mlir::MLIRContext* ctx, vpux::ShapeRef inShape,
                                                                mlir::ArrayAttr factor, Byte inElemTypeSize) {
     auto upsampleFactor = parseIntArrayAttr<int64_t>(factor);
@@ -73,19 +67,12 @@ static VPUIP::DmaDescriptorAttr generateUpsampingDmaDescriptor(mlir::MLIRContext
                                          dstPlaneStride, ctx);
 }
 
-mlir::LogicalResult ClusterUpsamplingDMARewriter::matchAndRewrite(VPUIP::UpsamplingDMAOp upsamplingDMAOp,
-                                                                  mlir::PatternRewriter& rewriter) const {
-    _log.trace("Process UpsamplingDMA op: {0}", upsamplingDMAOp);
+// Splits the UpsamplingDMA into the DMAs with the supported number of planes, the IR isn't changed
+Optional<UpsamplingDMAPlan> planUpsamplingDMA(VPUIP::UpsamplingDMAOp upsamplingDMAOp, int64_t dmaPortCount) {
     if (upsamplingDMAOp.dma_descriptor().hasValue()) {
-        return mlir::failure();
+        return None;
     }
 
-    auto vpurtTask = upsamplingDMAOp->getParentOfType<VPURT::TaskOp>();
-    VPUX_THROW_UNLESS(vpurtTask != nullptr, "Can't get VPURT task operation");
-    auto cycleBeginAttr = vpurtTask->getAttr(cycleBegin);
-    auto cycleEndAttr = vpurtTask->getAttr(cycleEnd);
-    rewriter.setInsertionPointAfter(vpurtTask);
-
     auto inType = upsamplingDMAOp.input().getType().cast<vpux::NDTypeInterface>();
     Byte elemTypeSize = inType.getElemTypeSize();
 
@@ -125,23 +112,53 @@ mlir::LogicalResult ClusterUpsamplingDMARewriter::matchAndRewrite(VPUIP::Upsampl
         return outShape;
     };
 
+    UpsamplingDMAPlan plan;
+
     int64_t dmaPort = 0;
     for (auto& inputShape : subInputShapes) {
         auto newSrcMemRef = vpux::getMemRefType(inputShape, srcType.getElementType(), inOrder, srcType.getMemSpace());
-        auto newSrcBuff = VPUIP::createNewDeclareBuffer(rewriter, srcDeclBuff, srcDeclBuff, newSrcMemRef, srcOffset);
 
         auto outShape = getOutShape(inputShape);
         auto newDstMemRef = vpux::getMemRefType(outShape, dstType.getElementType(), inOrder, dstType.getMemSpace());
-        auto newDstBuff = VPUIP::createNewDeclareBuffer(rewriter, dstDeclBuff, dstDeclBuff, newDstMemRef, dstOffset);
         auto descriptorAttr = generateUpsampingDmaDescriptor(contex, inputShape, upsamplingDMAOp.upsampling_factor(),
                                                              inType.getElemTypeSize());
 
         auto nextOffset = srcOffset + inputShape.totalSize() * elemTypeSize.count();
         const auto newLoc =
                 appendLoc(upsamplingDMAOp->getLoc(), "_unroll_upsampingDMA[{0},{1}]", srcOffset, nextOffset);
+
+        plan.push_back(UpsamplingDMAPart{newSrcMemRef, srcOffset, newDstMemRef, dstOffset, descriptorAttr, newLoc,
+                                         dmaPort});
+
+        dmaPort = (dmaPort + 1) % dmaPortCount;
+        srcOffset = nextOffset;
+        dstOffset += outShape.totalSize() * elemTypeSize.count();
+    }
+
+    return plan;
+}
+
+void insertUpsamplingDMAs(mlir::PatternRewriter& rewriter, VPUIP::UpsamplingDMAOp upsamplingDMAOp,
+                          const UpsamplingDMAPlan& plan, Logger log) {
+    log.trace("Process UpsamplingDMA op: {0}", upsamplingDMAOp);
+
+    auto vpurtTask = upsamplingDMAOp->getParentOfType<VPURT::TaskOp>();
+    VPUX_THROW_UNLESS(vpurtTask != nullptr, "Can't get VPURT task operation");
+    auto cycleBeginAttr = vpurtTask->getAttr(cycleBegin);
+    auto cycleEndAttr = vpurtTask->getAttr(cycleEnd);
+
+    auto srcDeclBuff = upsamplingDMAOp.input().getDefiningOp<VPURT::DeclareBufferOp>();
+    auto dstDeclBuff = upsamplingDMAOp.output_buff().getDefiningOp<VPURT::DeclareBufferOp>();
+
+    for (const auto& part : plan) {
+        auto newSrcBuff =
+                VPUIP::createNewDeclareBuffer(rewriter, srcDeclBuff, srcDeclBuff, part.srcType, part.srcOffset);
+        auto newDstBuff =
+                VPUIP::createNewDeclareBuffer(rewriter, dstDeclBuff, dstDeclBuff, part.dstType, part.dstOffset);
+
         const auto newUpsamplingDMA = VPURT::wrapIntoTaskOp<VPUIP::UpsamplingDMAOp>(
-                rewriter, vpurtTask.waitBarriers(), vpurtTask.updateBarriers(), newLoc, newSrcBuff, newDstBuff,
-                upsamplingDMAOp.upsampling_factorAttr(), descriptorAttr, dmaPort);
+                rewriter, vpurtTask.waitBarriers(), vpurtTask.updateBarriers(), part.loc, newSrcBuff, newDstBuff,
+                upsamplingDMAOp.upsampling_factorAttr(), part.dmaDescriptor, part.port);
         auto newVpurtTask = newUpsamplingDMA->getParentOfType<VPURT::TaskOp>();
         if (cycleBeginAttr) {
             newVpurtTask->setAttr(cycleBegin, cycleBeginAttr);
@@ -149,13 +166,7 @@ mlir::LogicalResult ClusterUpsamplingDMARewriter::matchAndRewrite(VPUIP::Upsampl
         if (cycleEndAttr) {
             newVpurtTask->setAttr(cycleEnd, cycleEndAttr);
         }
-        dmaPort = (dmaPort + 1) % _dmaPortCount;
-        srcOffset = nextOffset;
-        dstOffset += outShape.totalSize() * elemTypeSize.count();
     }
-    rewriter.eraseOp(vpurtTask);
-
-    return mlir::success();
 }
 
 //
@@ -173,19 +184,20 @@ private:
 };
 
 void UnrollUpsamplingDMAPass::safeRunOnFunc() {
-    auto& ctx = getContext();
     auto func = getFunction();
     auto module = func->getParentOfType<mlir::ModuleOp>();
     auto dmaOp = IE::getAvailableExecutor(module, VPU::ExecutorKind::DMA_NN);
     auto dmaPortCount = dmaOp.count();
 
-    mlir::RewritePatternSet patterns(&ctx);
-    patterns.insert<ClusterUpsamplingDMARewriter>(&ctx, dmaPortCount, _log);
-
-    if (mlir::failed(
-                mlir::applyPatternsAndFoldGreedily(func, std::move(patterns), vpux::getDefaultGreedyRewriteConfig()))) {
-        signalPassFailure();
-    }
+    VPUIP::unrollTasks<VPUIP::UpsamplingDMAOp, UpsamplingDMAPlan>(
+            func, getArgumentName(),
+            [&](VPUIP::UpsamplingDMAOp origOp) {
+                return planUpsamplingDMA(origOp, dmaPortCount);
+            },
+            [&](mlir::PatternRewriter& rewriter, VPUIP::UpsamplingDMAOp origOp, const UpsamplingDMAPlan& plan) {
+                insertUpsamplingDMAs(rewriter, origOp, plan, _log);
+            },
+            _log);
 }
 
 }  // namespace
@@ -0,0 +1,105 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPUIP/task_unrolling.hpp"
+
+#include "vpux/utils/IE/loop.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/range.hpp"
+
+#include <mlir/Interfaces/SideEffectInterfaces.h>
+
+#include <llvm/ADT/SetVector.h>
+
+#include <iterator>
+
+using namespace vpux;
+
+//
+// UnrollingMetric
+//
+
+namespace {
+
+int64_t getNumTasks(mlir::FuncOp func) {
+    const auto tasks = func.getOps<VPURT::TaskOp>();
+    return checked_cast<int64_t>(std::distance(tasks.begin(), tasks.end()));
+}
+
+}  // namespace
+
+vpux::VPUIP::UnrollingMetric::UnrollingMetric(mlir::FuncOp func): _func(func), _numTasksBefore(getNumTasks(func)) {
+}
+
+void vpux::VPUIP::UnrollingMetric::report(StringRef passName, Logger log) const {
+    const auto numTasksAfter = getNumTasks(_func);
+    const auto blowUp = _numTasksBefore != 0 ? static_cast<double>(numTasksAfter) / _numTasksBefore : 1.0;
+
+    log.debug("{0}: '{1}' tasks were unrolled into '{2}' tasks in function '{3}', blow-up x{4:F2}", passName,
+              _numTasksBefore, numTasksAfter, _func.getName(), blowUp);
+}
+
+//
+// unrollTasks
+//
+
+namespace {
+
+class UnrollingRewriter final : public mlir::PatternRewriter {
+public:
+    explicit UnrollingRewriter(mlir::MLIRContext* ctx): mlir::PatternRewriter(ctx) {
+    }
+};
+
+}  // namespace
+
+void vpux::VPUIP::details::unrollTasks(mlir::FuncOp func, StringRef passName, ArrayRef<VPURT::TaskOp> tasks,
+                                       FuncRef<void(size_t)> plan, FuncRef<bool(mlir::PatternRewriter&, size_t)> insert,
+                                       Logger log) {
+    auto* ctx = func.getContext();
+
+    const UnrollingMetric metric(func);
+
+    // The plans only read the IR and create the types and the attributes, which is allowed from several threads
+    // when the context has the multithreading enabled
+    const auto policy = ctx->isMultithreadingEnabled() ? LoopExecPolicy::Parallel : LoopExecPolicy::Sequential;
+    loop_1d(policy, checked_cast<int64_t>(tasks.size()), [&](int64_t ind) {
+        plan(static_cast<size_t>(ind));
+    });
+
+    UnrollingRewriter rewriter(ctx);
+
+    for (auto ind : irange(tasks.size())) {
+        auto task = tasks[ind];
+
+        rewriter.setInsertionPointAfter(task);
+        if (!insert(rewriter, ind)) {
+            continue;
+        }
+
+        llvm::SmallSetVector<mlir::Operation*, 4> producers;
+        task.walk([&](mlir::Operation* op) {
+            for (auto operand : op->getOperands()) {
+                if (auto producer = operand.getDefiningOp()) {
+                    if (producer->getParentOp() == func.getOperation()) {
+                        producers.insert(producer);
+                    }
+                }
+            }
+        });
+
+        log.trace("Unrolled task at '{0}'", task->getLoc());
+        rewriter.eraseOp(task);
+
+        // The original buffers are usually replaced by the per-part ones
+        for (auto* producer : producers) {
+            if (producer->use_empty() && mlir::isOpTriviallyDead(producer)) {
+                rewriter.eraseOp(producer);
+            }
+        }
+    }
+
+    metric.report(passName, log);
+}
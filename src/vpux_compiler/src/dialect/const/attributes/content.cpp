@@ -11,6 +11,7 @@
 #include "vpux/compiler/dialect/const/ops.hpp"
 #include "vpux/compiler/utils/types.hpp"
 
+#include "vpux/utils/core/checked_cast.hpp"
 #include "vpux/utils/core/format.hpp"
 #include "vpux/utils/core/func_ref.hpp"
 #include "vpux/utils/core/range.hpp"
@@ -20,6 +21,8 @@
 
 #include <llvm/ADT/TypeSwitch.h>
 
+#include <atomic>
+#include <cstdint>
 #include <exception>
 #include <numeric>
 
@@ -75,7 +78,7 @@ mlir::LogicalResult vpux::Const::ContentAttr::verify(FuncRef<mlir::InFlightDiagn
                        baseContent.getType().getElementType());
     }
 
-    if (baseContent.isa<mlir::DenseElementsAttr>()) {
+    if (baseContent.isa<mlir::DenseElementsAttr, Const::SharedElementsAttr>()) {
         // OK
     } else if (const auto opaque = baseContent.dyn_cast<mlir::OpaqueElementsAttr>()) {
         const size_t numElems = opaque.getNumElements();
@@ -127,6 +130,11 @@ Const::Content wrapBaseContent(mlir::ElementsAttr baseContent) {
     if (const auto dense = baseContent.dyn_cast<mlir::DenseElementsAttr>()) {
         data = dense.getRawData();
         isSplat = dense.isSplat();
+    } else if (const auto shared = baseContent.dyn_cast<Const::SharedElementsAttr>()) {
+        data = shared.getRawData();
+
+        VPUX_THROW_UNLESS(mlir::DenseElementsAttr::isValidRawBuffer(baseContent.getType(), data, isSplat),
+                          "Got invalid shared buffer");
     } else {
         const auto opaque = baseContent.cast<mlir::OpaqueElementsAttr>();
         const auto bytes = opaque.getValue();
@@ -146,19 +154,73 @@ Const::Content wrapBaseContent(mlir::ElementsAttr baseContent) {
 // ContentAttr::fold
 //
 
-Const::Content vpux::Const::ContentAttr::fold() const {
-    auto res = wrapBaseContent(getBaseContent());
+namespace {
 
-    if (const auto transformations = getImpl()->transformations) {
-        for (const auto attr : transformations.getAsRange<Const::TransformAttrInterface>()) {
-            Const::logger().trace("Applying transformation: {0}", attr);
-            res = attr.transform(res);
-        }
+std::atomic<uint64_t> foldedBytes{0};
+
+Const::Content applyTransformations(Const::Content res, ArrayRef<Const::TransformAttrInterface> transformations) {
+    for (const auto attr : transformations) {
+        Const::logger().trace("Applying transformation: {0}", attr);
+        res = attr.transform(res);
     }
 
     return res;
 }
 
+}  // namespace
+
+Const::Content vpux::Const::ContentAttr::fold() const {
+    auto res = applyTransformations(wrapBaseContent(getBaseContent()), getTransformations());
+
+    foldedBytes.fetch_add(res.getRawStorageBuf().size(), std::memory_order_relaxed);
+    return res;
+}
+
+uint64_t vpux::Const::getFoldedBytes() {
+    return foldedBytes.load(std::memory_order_relaxed);
+}
+
+//
+// ContentAttr::getWeightsTableRelocation
+//
+
+Const::RelocateWeightsTableAttr vpux::Const::ContentAttr::getWeightsTableRelocation() const {
+    const auto transformations = getTransformations();
+    if (transformations.empty()) {
+        return nullptr;
+    }
+
+    return transformations.back().dyn_cast<Const::RelocateWeightsTableAttr>();
+}
+
+//
+// ContentAttr::copyFoldedTo
+//
+
+void vpux::Const::ContentAttr::copyFoldedTo(MutableArrayRef<char> buf) const {
+    // The weights table is copied to the buffer as the base table and the relocation record is resolved in place,
+    // so the relocated table isn't materialized in a temporary buffer
+    const auto relocation = getWeightsTableRelocation();
+    const auto isInt32Aligned = reinterpret_cast<uintptr_t>(buf.data()) % alignof(int32_t) == 0;
+    if (relocation == nullptr || !isInt32Aligned) {
+        fold().copyTo(buf);
+        return;
+    }
+
+    const auto tableByteSize = checked_cast<size_t>(getType().getTotalAllocSize().count());
+    VPUX_THROW_UNLESS(buf.size() >= tableByteSize && getType().getElementType().isSignedInteger(32),
+                      "Got unexpected weights table '{0}' for the buffer of '{1}' bytes", getType(), buf.size());
+
+    const auto transformations = getTransformations();
+    const auto baseTable = applyTransformations(wrapBaseContent(getBaseContent()),
+                                                makeArrayRef(transformations).drop_back());
+    baseTable.copyTo(buf);
+
+    relocation.relocate(makeMutableArrayRef(reinterpret_cast<int32_t*>(buf.data()), tableByteSize / sizeof(int32_t)));
+
+    foldedBytes.fetch_add(tableByteSize, std::memory_order_relaxed);
+}
+
 //
 // ContentAttr::getBaseContent
 //
@@ -192,7 +254,11 @@ vpux::NDTypeInterface vpux::Const::ContentAttr::getType() const {
 //
 
 void vpux::Const::ContentAttr::print(mlir::AsmPrinter& printer) const {
-    printer.printAttribute(getBaseContent());
+    if (const auto shared = getBaseContent().dyn_cast<Const::SharedElementsAttr>()) {
+        shared.printAsDense(printer);
+    } else {
+        printer.printAttribute(getBaseContent());
+    }
     if (const auto transformations = getImpl()->transformations) {
         printer << ", ";
         printer.printAttribute(transformations);
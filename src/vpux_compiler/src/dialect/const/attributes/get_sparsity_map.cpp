@@ -3,6 +3,7 @@
 
 #include "vpux/compiler/dialect/VPU/nce_sparsity.hpp"
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/dialect/const/utils/sparsity.hpp"
 #include "vpux/compiler/utils/quantization.hpp"
 #include "vpux/compiler/utils/subspaces.hpp"
 #include "vpux/compiler/utils/types.hpp"
@@ -14,44 +15,32 @@
 
 #include <mlir/Dialect/Quant/QuantTypes.h>
 
+#include <climits>
 #include <numeric>
+#include <vector>
 
 using namespace vpux;
 
 namespace {
 
 template <typename StorageType>
-Const::Content generateSparsityMap(const Const::Content& content, int64_t sparsifyValue, NDTypeInterface inputType,
+Const::Content generateSparsityMap(const Const::Content& content, int64_t sparsifyValue, mlir::Type inputElementType,
                                    NDTypeInterface outputType, mlir::MLIRContext* context) {
-    const auto inputBuffer = content.getValues<StorageType>();
+    std::vector<StorageType> tempBuf;
+    const auto inputValues = Const::getDenseValues<StorageType>(content, inputElementType, tempBuf);
 
     const auto sparsityMapElementType = mlir::IntegerType::get(context, 1, mlir::IntegerType::Unsigned);
     auto output = Const::Content::allocTempBuffer(outputType, sparsityMapElementType, false);
     output.fillWithZero();
     auto outputBuffer = output.getRawTempBuf();
 
-    const auto inputShape = inputType.getShape().raw();
     const auto outputShape = outputType.getShape().raw();
-    const auto inputWorkloadSize = checked_cast<size_t>(std::accumulate(
-            inputShape.begin() + 1, inputShape.end(), static_cast<int64_t>(1), std::multiplies<int64_t>()));
-    const auto outputWorkloadSize = checked_cast<size_t>(std::accumulate(
-            outputShape.begin() + 1, outputShape.end(), static_cast<int64_t>(1), std::multiplies<int64_t>()));
-    const size_t numOC = outputShape[0];
-
-    for (size_t oc = 0; oc < numOC; ++oc) {
-        const size_t inStartIdx = oc * inputWorkloadSize;
-        size_t outIdx = oc * outputWorkloadSize / CHAR_BIT;
-        for (size_t inIdx = 0; inIdx < inputWorkloadSize; inIdx += CHAR_BIT) {
-            const size_t byteStart = inStartIdx + inIdx;
-            uint8_t byteValue = 0;
-            for (size_t bitShift = 0; bitShift < CHAR_BIT; ++bitShift) {
-                if (inputBuffer[byteStart + bitShift] != StorageType(sparsifyValue)) {
-                    byteValue |= (1 << bitShift);
-                }
-            }
-            outputBuffer[outIdx++] = byteValue;
-        }
-    }
+    const auto outputWorkloadSize = std::accumulate(outputShape.begin() + 1, outputShape.end(),
+                                                    static_cast<int64_t>(1), std::multiplies<int64_t>());
+    const auto numOC = outputShape[0];
+
+    Const::buildSparsityMap(inputValues, numOC, StorageType(sparsifyValue),
+                            outputWorkloadSize / CHAR_BIT, outputBuffer);
 
     return output;
 }
@@ -93,15 +82,15 @@ Const::Content vpux::Const::GetSparsityMapAttr::transform(vpux::Const::Content&
     }
 
     if (inputElementType.isSignedInteger(8)) {
-        return generateSparsityMap<int8_t>(input, sparsifyValue, input.getType(), outputType, getContext());
+        return generateSparsityMap<int8_t>(input, sparsifyValue, inputElementType, outputType, getContext());
     } else if (inputElementType.isUnsignedInteger(8)) {
-        return generateSparsityMap<uint8_t>(input, sparsifyValue, input.getType(), outputType, getContext());
+        return generateSparsityMap<uint8_t>(input, sparsifyValue, inputElementType, outputType, getContext());
     } else if (inputElementType.isF16()) {
-        return generateSparsityMap<float16>(input, sparsifyValue, input.getType(), outputType, getContext());
+        return generateSparsityMap<float16>(input, sparsifyValue, inputElementType, outputType, getContext());
     } else if (inputElementType.isBF16()) {
-        return generateSparsityMap<bfloat16>(input, sparsifyValue, input.getType(), outputType, getContext());
+        return generateSparsityMap<bfloat16>(input, sparsifyValue, inputElementType, outputType, getContext());
     } else if (inputElementType.isF32()) {
-        return generateSparsityMap<float>(input, sparsifyValue, input.getType(), outputType, getContext());
+        return generateSparsityMap<float>(input, sparsifyValue, inputElementType, outputType, getContext());
     }
     VPUX_THROW("Unexpected weights data type: {0}", inputElementType);
 }
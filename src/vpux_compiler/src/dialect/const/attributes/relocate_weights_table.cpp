@@ -16,6 +16,8 @@
 
 #include <mlir/IR/DialectImplementation.h>
 
+#include <cstring>
+
 using namespace vpux;
 
 //
@@ -132,15 +134,48 @@ vpux::NDTypeInterface vpux::Const::RelocateWeightsTableAttr::inferOutputType(vpu
 // RelocateWeightsTableAttr::transform
 //
 
-Const::Content vpux::Const::RelocateWeightsTableAttr::transform(vpux::Const::Content& input) const {
-    constexpr auto numElemPerOC = static_cast<size_t>(VPU::NCEInvariant::WEIGHT_TABLE_NUM_ELEMENTS_PER_OC);
+namespace {
 
-    auto output =
-            Const::Content::allocTempBuffer(inferOutputType(input.getType()),
-                                            mlir::IntegerType::get(getContext(), 32, mlir::IntegerType::Signed), false);
+// Returns the content with the int32 table, which can be patched in place. The input buffer is reused,
+// if the input owns it and it already has the int32 storage, so the table is not copied.
+Const::Content getMutableTable(vpux::NDTypeInterface outputType, vpux::Const::Content& input,
+                               mlir::MLIRContext* ctx) {
+    const auto isInt32Storage = input.getStorageElemType().isSignedInteger(32);
+    if (isInt32Storage && !input.isSplat() && input.hasTempBuf()) {
+        return Const::Content::moveBuffer(outputType, std::move(input));
+    }
 
-    const auto values = input.getValues<int32_t>();
-    auto patchedValues = output.getTempBuf<int32_t>();
+    const auto storageElemType =
+            isInt32Storage ? input.getStorageElemType() : mlir::IntegerType::get(ctx, 32, mlir::IntegerType::Signed);
+    auto output = Const::Content::allocTempBuffer(outputType, storageElemType, false);
+    auto table = output.getTempBuf<int32_t>();
+
+    if (isInt32Storage && !input.isSplat()) {
+        const auto rawBuf = input.getRawStorageBuf();
+        VPUX_THROW_UNLESS(rawBuf.size() == table.size() * sizeof(int32_t),
+                          "Weights table storage of '{0}' bytes doesn't match '{1}' elements", rawBuf.size(),
+                          table.size());
+        std::memcpy(table.data(), rawBuf.data(), rawBuf.size());
+    } else {
+        const auto values = input.getValues<int32_t>();
+        for (size_t i = 0; i < table.size(); ++i) {
+            table[i] = values[i];
+        }
+    }
+
+    return output;
+}
+
+}  // namespace
+
+//
+// RelocateWeightsTableAttr::relocate
+//
+
+// Patches the pointers of the base table in place in a single sweep. It is shared by the transformation and
+// the exporters, which resolve the relocation directly in the blob storage.
+void vpux::Const::RelocateWeightsTableAttr::relocate(MutableArrayRef<int32_t> table) const {
+    constexpr auto numElemPerOC = static_cast<size_t>(VPU::NCEInvariant::WEIGHT_TABLE_NUM_ELEMENTS_PER_OC);
 
     const auto weightsPtr = static_cast<int32_t>(*getWeightsPtr().getValue().getRawData());
     const auto sparsityPtr = static_cast<int32_t>(*getSparsityPtr().getValue().getRawData());
@@ -148,63 +183,57 @@ Const::Content vpux::Const::RelocateWeightsTableAttr::transform(vpux::Const::Con
 
     int32_t weightPtrStep = 0;
     int32_t sparsityPtrStep = 0;
-    if (values.size() >= numElemPerOC * 2) {
-        weightPtrStep = values[1 * numElemPerOC + 0] - values[0 * numElemPerOC + 0];
-        sparsityPtrStep = values[1 * numElemPerOC + 1] - values[0 * numElemPerOC + 1];
+    if (table.size() >= numElemPerOC * 2) {
+        weightPtrStep = table[1 * numElemPerOC + 0] - table[0 * numElemPerOC + 0];
+        sparsityPtrStep = table[1 * numElemPerOC + 1] - table[0 * numElemPerOC + 1];
     }
 
-    const int64_t OC = checked_cast<int64_t>(values.size() / numElemPerOC);
+    const int64_t OC = checked_cast<int64_t>(table.size() / numElemPerOC);
     const int64_t numClusters = checked_cast<int64_t>(offsets.size());
 
-    SmallVector<int64_t> weightsPtrSteps(OC);
+    SmallVector<int64_t> numElems;
+    int64_t weightsElemByteSize = 0;
+    int64_t alignment = 0;
     if (getWeightsCompression() != nullptr) {
-        const auto numElems = to_small_vector(getWeightsCompression().getNumElems().getValues<int64_t>());
+        numElems = to_small_vector(getWeightsCompression().getNumElems().getValues<int64_t>());
         VPUX_THROW_UNLESS(numElems.size() == static_cast<size_t>(OC),
                           "Invalid weights compression with {0} elements for {1} channels", numElems.size(), OC);
         VPUX_THROW_UNLESS(getWeightsElemByteSize() != nullptr, "Missing weights element type attribute");
-        const auto weightsElemByteSize = getWeightsElemByteSize().getInt();
-        const auto alignment = (getWeightsCompression().getAlignment() != nullptr)
-                                       ? getWeightsCompression().getAlignment().getInt()
-                                       : VPU::NCEInvariant::VPU_WEIGHT_SET_BYTE_ALIGNMENT;
-
-        int64_t weightsPtrOffset = 0;
-        for (int64_t oc = 0, clusterIdx = 0; oc < OC; ++oc) {
-            if ((clusterIdx + 1) < numClusters && oc >= offsets[clusterIdx + 1]) {
-                clusterIdx++;
-                weightsPtrOffset = 0;
-            }
-            weightsPtrSteps[oc] = weightsPtrOffset;
-            const auto weightSetSize = (numElems[oc] * weightsElemByteSize);
-            weightsPtrOffset += alignVal<int64_t>(weightSetSize, alignment);
-        }
-    } else {
-        for (int64_t oc = 0, clusterIdx = 0; oc < OC; ++oc) {
-            if ((clusterIdx + 1) < numClusters && oc >= offsets[clusterIdx + 1]) {
-                clusterIdx++;
-            }
-            weightsPtrSteps[oc] = weightPtrStep * (oc - offsets[clusterIdx]);
-        }
+        weightsElemByteSize = getWeightsElemByteSize().getInt();
+        alignment = (getWeightsCompression().getAlignment() != nullptr)
+                            ? getWeightsCompression().getAlignment().getInt()
+                            : VPU::NCEInvariant::VPU_WEIGHT_SET_BYTE_ALIGNMENT;
     }
 
+    // Single sweep over the table, the steps were read from the first two rows before they are patched
+    int64_t weightsPtrOffset = 0;
     for (int64_t oc = 0, clusterIdx = 0; oc < OC; ++oc) {
         if ((clusterIdx + 1) < numClusters && oc >= offsets[clusterIdx + 1]) {
             clusterIdx++;
+            weightsPtrOffset = 0;
+        }
+
+        int64_t weightsPtrStep = 0;
+        if (!numElems.empty()) {
+            weightsPtrStep = weightsPtrOffset;
+            weightsPtrOffset += alignVal<int64_t>(numElems[oc] * weightsElemByteSize, alignment);
+        } else {
+            weightsPtrStep = weightPtrStep * (oc - offsets[clusterIdx]);
         }
 
         const auto wtInd = oc * numElemPerOC;
 
-        patchedValues[wtInd + 0] = checked_cast<int32_t>(weightsPtr + weightsPtrSteps[oc]);
+        table[wtInd + 0] = checked_cast<int32_t>(weightsPtr + weightsPtrStep);
 
-        patchedValues[wtInd + 1] = values[wtInd + 1];
-        if (values[wtInd + 1] != VPU::NCESparsity::SPARSITY_PTR_WHEN_NO_SPARSITY) {
-            patchedValues[wtInd + 1] =
-                    checked_cast<int32_t>(sparsityPtr + (oc - offsets[clusterIdx]) * sparsityPtrStep);
+        if (table[wtInd + 1] != VPU::NCESparsity::SPARSITY_PTR_WHEN_NO_SPARSITY) {
+            table[wtInd + 1] = checked_cast<int32_t>(sparsityPtr + (oc - offsets[clusterIdx]) * sparsityPtrStep);
         }
-
-        patchedValues[wtInd + 2] = values[wtInd + 2];
-        patchedValues[wtInd + 3] = values[wtInd + 3];
     }
+}
 
+Const::Content vpux::Const::RelocateWeightsTableAttr::transform(vpux::Const::Content& input) const {
+    auto output = getMutableTable(inferOutputType(input.getType()), input, getContext());
+    relocate(output.getTempBuf<int32_t>());
     return output;
 }
 
@@ -0,0 +1,140 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/utils/types.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/format.hpp"
+#include "vpux/utils/core/func_ref.hpp"
+
+#include <mlir/IR/DialectImplementation.h>
+
+#include <llvm/ADT/StringExtras.h>
+
+using namespace vpux;
+
+namespace {
+
+void printHexData(llvm::raw_ostream& stream, ArrayRef<char> data) {
+    stream << "\"0x";
+    for (const auto byte : data) {
+        const auto val = static_cast<uint8_t>(byte);
+        stream << llvm::hexdigit(val >> 4) << llvm::hexdigit(val & 0xF);
+    }
+    stream << "\"";
+}
+
+}  // namespace
+
+//
+// SharedElementsAttr::verify
+//
+
+mlir::LogicalResult vpux::Const::SharedElementsAttr::verify(FuncRef<mlir::InFlightDiagnostic()> emitError,
+                                                            mlir::ShapedType type, Const::SharedBufferPtr buffer) {
+    if (type == nullptr) {
+        return printTo(emitError(), "Got NULL 'type' in 'SharedElementsAttr'");
+    }
+    if (buffer == nullptr) {
+        return printTo(emitError(), "Got NULL 'buffer' in 'SharedElementsAttr'");
+    }
+
+    const auto numElems = checked_cast<size_t>(type.getNumElements());
+    const Byte elemTypeSize = vpux::getElemTypeSize(type);
+
+    if (buffer->size() != numElems * elemTypeSize.count()) {
+        return printTo(emitError(), "Size of shared buffer '{0}' in 'SharedElementsAttr' doesn't match its Type '{1}'",
+                       buffer->size(), type);
+    }
+
+    return mlir::success();
+}
+
+//
+// SharedElementsAttr::getRawData
+//
+
+ArrayRef<char> vpux::Const::SharedElementsAttr::getRawData() const {
+    return getBuffer()->getData();
+}
+
+//
+// SharedElementsAttr::getContentHash
+//
+
+llvm::hash_code vpux::Const::SharedElementsAttr::getContentHash() const {
+    return getBuffer()->getContentHash();
+}
+
+//
+// SharedElementsAttr::print
+//
+
+void vpux::Const::SharedElementsAttr::print(mlir::AsmPrinter& printer) const {
+    printer << "<";
+    printer.printType(getType());
+    printer << ", ";
+    printHexData(printer.getStream(), getRawData());
+    printer << ">";
+}
+
+//
+// SharedElementsAttr::printAsDense
+//
+
+void vpux::Const::SharedElementsAttr::printAsDense(mlir::AsmPrinter& printer) const {
+    // The data is printed by the generic printer, so the printed IR can be parsed back and the printing flags,
+    // like the elision of the large elements attributes, are applied to it the same way as to the dense constants.
+    // The copy is made only when the IR is printed.
+    const auto rawData = getRawData();
+
+    bool isSplatBuffer = false;
+    VPUX_THROW_UNLESS(mlir::DenseElementsAttr::isValidRawBuffer(getType(), rawData, isSplatBuffer),
+                      "Shared buffer of '{0}' bytes doesn't match the type '{1}'", rawData.size(), getType());
+
+    printer.printAttribute(mlir::DenseElementsAttr::getFromRawBuffer(getType(), rawData, isSplatBuffer));
+}
+
+//
+// SharedElementsAttr::parse
+//
+
+mlir::Attribute vpux::Const::SharedElementsAttr::parse(mlir::AsmParser& parser, mlir::Type) {
+    if (mlir::failed(parser.parseLess())) {
+        return nullptr;
+    }
+
+    mlir::ShapedType type;
+    if (mlir::failed(parser.parseType(type))) {
+        return nullptr;
+    }
+
+    if (mlir::failed(parser.parseComma())) {
+        return nullptr;
+    }
+
+    std::string hexData;
+    if (mlir::failed(parser.parseString(&hexData))) {
+        return nullptr;
+    }
+
+    if (mlir::failed(parser.parseGreater())) {
+        return nullptr;
+    }
+
+    const auto hexDigits = StringRef(hexData);
+    if (!hexDigits.startswith("0x") || hexDigits.size() % 2 != 0 ||
+        !llvm::all_of(hexDigits.drop_front(2), llvm::isHexDigit)) {
+        parser.emitError(parser.getCurrentLocation(), "Got invalid hexadecimal data for 'SharedElementsAttr'");
+        return nullptr;
+    }
+
+    const auto data = llvm::fromHex(hexDigits.drop_front(2));
+    const auto buffer = Const::SharedBuffer::copy(makeArrayRef(data.data(), data.size()));
+    return parser.getChecked<Const::SharedElementsAttr>(type, buffer);
+}
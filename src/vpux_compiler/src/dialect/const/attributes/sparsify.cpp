@@ -4,13 +4,14 @@
 #include "vpux/compiler/dialect/VPU/nce_invariant.hpp"
 #include "vpux/compiler/dialect/VPUIP/attributes.hpp"
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/dialect/const/utils/sparsity.hpp"
 
-#include "vpux/utils/IE/loop.hpp"
 #include "vpux/utils/core/numeric.hpp"
 
 #include <mlir/IR/DialectImplementation.h>
 
 #include <numeric>
+#include <vector>
 
 using namespace vpux;
 
@@ -127,45 +128,24 @@ int64_t getSparsifyValue(mlir::Type& inputElementType) {
 }
 
 template <typename StorageType>
-Const::Content sparsify(const Const::Content& content, int64_t sparsifyValue, NDTypeInterface inputType,
+Const::Content sparsify(const Const::Content& content, int64_t sparsifyValue, mlir::Type inputElementType,
                         NDTypeInterface outputType) {
     auto output = Const::Content::allocTempBuffer(outputType, outputType.getElementType(), false);
     output.fillWithZero();
     auto outBuf = output.getRawTempBuf();
-    auto outBlobPtr = reinterpret_cast<StorageType*>(outBuf.data());
 
-    auto inputValues = content.getValues<StorageType>();
+    std::vector<StorageType> tempBuf;
+    const auto inputValues = Const::getDenseValues<StorageType>(content, inputElementType, tempBuf);
 
-    auto inputShape = inputType.getShape();
+    auto inputShape = content.getType().getShape();
     VPUX_THROW_UNLESS(inputShape.size() == 4, "Expected 4D input shape. Got {0}", inputShape);
 
     const auto OC = inputShape[Dims4D::Filter::OC];
-    const auto IC = inputShape[Dims4D::Filter::IC];
-    const auto KY = inputShape[Dims4D::Filter::KY];
-    const auto KX = inputShape[Dims4D::Filter::KX];
-    const auto workloadSize = IC * KY * KX;
-
     const auto castedSparsifyValue = checked_cast<StorageType>(sparsifyValue);
-    constexpr auto byteSize = sizeof(castedSparsifyValue);
-
-    int64_t outputIndex = 0;
-    for (int64_t oc = 0; oc < OC; ++oc) {
-        auto begin = oc * workloadSize;
-        auto end = (oc + 1) * workloadSize;
-        for (auto inputIndex = begin; inputIndex < end; ++inputIndex) {
-            const auto inputValue = inputValues[inputIndex];
-            if (inputValue == castedSparsifyValue) {
-                continue;
-            }
-            outBlobPtr[outputIndex++] = inputValue;
-        }
-        const auto outputIndexByte = outputIndex * byteSize;
-        if (outputIndexByte % VPU::NCEInvariant::VPU_WEIGHT_SET_BYTE_ALIGNMENT != 0) {
-            const auto alignedOutputIndexByte =
-                    alignVal<int64_t>(outputIndexByte, VPU::NCEInvariant::VPU_WEIGHT_SET_BYTE_ALIGNMENT);
-            outputIndex = alignedOutputIndexByte / byteSize;
-        }
-    }
+
+    Const::compactWeights(inputValues, OC, castedSparsifyValue, VPU::NCEInvariant::VPU_WEIGHT_SET_BYTE_ALIGNMENT,
+                          outBuf);
+
     return output;
 }
 
@@ -183,15 +163,15 @@ Const::Content Const::SparsifyAttr::transform(Const::Content& input) const {
     int64_t sparsifyValue = getSparsifyValue(inputElementType);
 
     if (inputElementType.isSignedInteger(8)) {
-        return sparsify<int8_t>(input, sparsifyValue, inputType, outputType);
+        return sparsify<int8_t>(input, sparsifyValue, inputElementType, outputType);
     } else if (inputElementType.isUnsignedInteger(8)) {
-        return sparsify<uint8_t>(input, sparsifyValue, inputType, outputType);
+        return sparsify<uint8_t>(input, sparsifyValue, inputElementType, outputType);
     } else if (inputElementType.isF16()) {
-        return sparsify<float16>(input, sparsifyValue, inputType, outputType);
+        return sparsify<float16>(input, sparsifyValue, inputElementType, outputType);
     } else if (inputElementType.isBF16()) {
-        return sparsify<bfloat16>(input, sparsifyValue, inputType, outputType);
+        return sparsify<bfloat16>(input, sparsifyValue, inputElementType, outputType);
     } else if (inputElementType.isF32()) {
-        return sparsify<float>(input, sparsifyValue, inputType, outputType);
+        return sparsify<float>(input, sparsifyValue, inputElementType, outputType);
     }
     VPUX_THROW("Unexpected weights data type: {0}", inputElementType);
 }
@@ -205,31 +185,17 @@ Const::details::PositionRequirement Const::SparsifyAttr::getPositionRequirement(
 }
 
 template <typename StorageType>
-SmallVector<int64_t> countValue(int64_t sparsifyValue, Const::Content& content) {
-    auto inputValues = content.getValues<StorageType>();
+SmallVector<int64_t> countValue(int64_t sparsifyValue, mlir::Type elementType, Const::Content& content) {
     auto shape = content.getType().getShape();
     VPUX_THROW_UNLESS(shape.size() == 4, "Const::Content::sparsify: got unxpected content shape {0}", shape.size());
 
-    const auto OC = shape[Dims4D::Filter::OC];
-    const auto IC = shape[Dims4D::Filter::IC];
-    const auto KY = shape[Dims4D::Filter::KY];
-    const auto KX = shape[Dims4D::Filter::KX];
-    const auto workloadSize = IC * KY * KX;
+    std::vector<StorageType> tempBuf;
+    const auto inputValues = Const::getDenseValues<StorageType>(content, elementType, tempBuf);
 
+    const auto OC = shape[Dims4D::Filter::OC];
     const auto castedSparsifyValue = checked_cast<StorageType>(sparsifyValue);
 
-    SmallVector<int64_t> elems(OC, 0);
-    loop_1d(LoopExecPolicy::Parallel, elems.size(), [&](size_t oc) {
-        const auto begin = oc * workloadSize;
-        const auto end = (oc + 1) * workloadSize;
-        for (auto inputIndex = begin; inputIndex < end; ++inputIndex) {
-            if (inputValues[inputIndex] == castedSparsifyValue) {
-                continue;
-            }
-            elems[oc]++;
-        }
-    });
-    return elems;
+    return Const::countNonSparseElements(inputValues, OC, castedSparsifyValue);
 }
 
 Const::TransformAttrInterface Const::SparsifyAttr::updateAttributes(mlir::ElementsAttr& baseContent,
@@ -253,15 +219,15 @@ Const::TransformAttrInterface Const::SparsifyAttr::updateAttributes(mlir::Elemen
 
     SmallVector<int64_t> numActualElements;
     if (elementType.isSignedInteger(8)) {
-        numActualElements = countValue<int8_t>(sparsifyValue, content);
+        numActualElements = countValue<int8_t>(sparsifyValue, elementType, content);
     } else if (elementType.isUnsignedInteger(8)) {
-        numActualElements = countValue<uint8_t>(sparsifyValue, content);
+        numActualElements = countValue<uint8_t>(sparsifyValue, elementType, content);
     } else if (elementType.isF16()) {
-        numActualElements = countValue<float16>(sparsifyValue, content);
+        numActualElements = countValue<float16>(sparsifyValue, elementType, content);
     } else if (elementType.isBF16()) {
-        numActualElements = countValue<bfloat16>(sparsifyValue, content);
+        numActualElements = countValue<bfloat16>(sparsifyValue, elementType, content);
     } else if (elementType.isF32()) {
-        numActualElements = countValue<float>(sparsifyValue, content);
+        numActualElements = countValue<float>(sparsifyValue, elementType, content);
     } else {
         VPUX_THROW("Unexpected weights data type: {0}", elementType);
     }
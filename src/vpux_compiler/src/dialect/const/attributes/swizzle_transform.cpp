@@ -13,6 +13,11 @@
 #include "vpux/compiler/utils/swizzling_utils.hpp"
 
 #include <mlir/IR/DialectImplementation.h>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
 #include <numeric>
 #include "vpux/utils/IE/loop.hpp"
 #include "vpux/utils/core/func_ref.hpp"
@@ -24,7 +29,7 @@ using namespace vpux::BufferTransform;
 // vpux::BufferTransform::BufferSwizzleTransform
 //
 BufferSwizzleTransform::BufferSwizzleTransform(uint32_t swizzleKey, VPU::ArchKind archKind)
-        : _addressTransform(swizzleKey, archKind) {
+        : _addressTransform(swizzleKey, archKind), _pattern(SwizzlePattern::get(swizzleKey, archKind)) {
 }
 
 //
@@ -80,6 +85,132 @@ uint32_t AddressTransform::getPhysicalAddress(uint32_t dpuAddr) {
     return phyAddr;
 }
 
+//
+// vpux::BufferTransform::SwizzlePattern::get
+//
+
+namespace {
+
+// The stagger is taken from the address bits above the RAM cut, so the transformation repeats itself
+// every 2^MAX_SWIZZLE_KEY RAM cuts for any swizzle key
+constexpr uint32_t SWIZZLE_STRIPE_SIZE = 1u << (LOG2_RAM_CUT_BYTES + MAX_SWIZZLE_KEY);
+
+std::shared_ptr<const SwizzlePattern> buildSwizzlePattern(uint32_t swizzleKey, VPU::ArchKind archKind) {
+    AddressTransform addressTransform(swizzleKey, archKind);
+    const auto chunkSize = 1u << addressTransform.getLog2RamCutDataWidth();
+
+    auto pattern = std::make_shared<SwizzlePattern>();
+    pattern->stripeSize = SWIZZLE_STRIPE_SIZE;
+
+    for (uint32_t dpuAddr = 0; dpuAddr < SWIZZLE_STRIPE_SIZE; dpuAddr += chunkSize) {
+        const auto phyAddr = addressTransform.getPhysicalAddress(dpuAddr);
+        VPUX_THROW_UNLESS(phyAddr + chunkSize <= SWIZZLE_STRIPE_SIZE,
+                          "Swizzled address '{0}' of the chunk '{1}' is out of the swizzle stripe", phyAddr, dpuAddr);
+
+        if (!pattern->runs.empty()) {
+            auto& lastRun = pattern->runs.back();
+            if (lastRun.dpuOffset + lastRun.size == dpuAddr && lastRun.phyOffset + lastRun.size == phyAddr) {
+                lastRun.size += chunkSize;
+                continue;
+            }
+        }
+
+        pattern->runs.push_back({dpuAddr, phyAddr, chunkSize});
+    }
+
+    return pattern;
+}
+
+}  // namespace
+
+std::shared_ptr<const SwizzlePattern> SwizzlePattern::get(uint32_t swizzleKey, VPU::ArchKind archKind) {
+    static std::mutex mutex;
+    static std::map<std::pair<uint32_t, VPU::ArchKind>, std::shared_ptr<const SwizzlePattern>> cache;
+
+    const auto key = std::make_pair(swizzleKey, archKind);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto& pattern = cache[key];
+    if (pattern == nullptr) {
+        pattern = buildSwizzlePattern(swizzleKey, archKind);
+    }
+
+    return pattern;
+}
+
+//
+// vpux::BufferTransform::BufferSwizzleTransform::swizzleRaw
+//
+
+namespace {
+
+// Copies the data of the runs, which start in the first dataSize bytes of the DPU address space.
+// The full stripes are processed by the worker threads, the last one is clipped to the data size.
+template <class CopyRun>
+void forEachRun(const SwizzlePattern& pattern, size_t dataSize, CopyRun&& copyRun) {
+    const auto numFullStripes = dataSize / pattern.stripeSize;
+
+    loop_1d(LoopExecPolicy::Parallel, checked_cast<int64_t>(numFullStripes), [&](int64_t stripe) {
+        const auto stripeOffset = static_cast<size_t>(stripe) * pattern.stripeSize;
+        for (const auto& run : pattern.runs) {
+            copyRun(stripeOffset + run.dpuOffset, stripeOffset + run.phyOffset, run.size);
+        }
+    });
+
+    const auto stripeOffset = numFullStripes * pattern.stripeSize;
+    for (const auto& run : pattern.runs) {
+        const auto dpuAddr = stripeOffset + run.dpuOffset;
+        if (dpuAddr >= dataSize) {
+            continue;
+        }
+
+        copyRun(dpuAddr, stripeOffset + run.phyOffset, std::min<size_t>(run.size, dataSize - dpuAddr));
+    }
+}
+
+}  // namespace
+
+void BufferSwizzleTransform::swizzleRaw(ArrayRef<char> in, MutableArrayRef<char> out) const {
+    const auto chunkSize = size_t(1) << LOG2_RAM_CUT_DATA_WIDTH;
+    const auto dataSize = alignVal(in.size(), chunkSize);
+    const auto numFullStripes = dataSize / _pattern->stripeSize;
+    VPUX_THROW_UNLESS(out.size() >= numFullStripes * _pattern->stripeSize,
+                      "Swizzled buffer of '{0}' bytes is too small for the input of '{1}' bytes", out.size(),
+                      in.size());
+
+    forEachRun(*_pattern, dataSize, [&](size_t dpuAddr, size_t phyAddr, size_t size) {
+        // The last chunk of the input, which isn't aligned to the chunk size, is copied partially.
+        // The checks never fail for the full stripes, which are verified in advance.
+        const auto copySize = std::min(size, in.size() - dpuAddr);
+        VPUX_THROW_UNLESS(phyAddr + copySize <= out.size(),
+                          "Swizzled address '{0}' is out of the buffer of '{1}' bytes", phyAddr, out.size());
+        std::memcpy(out.data() + phyAddr, in.data() + dpuAddr, copySize);
+    });
+}
+
+//
+// vpux::BufferTransform::BufferSwizzleTransform::deswizzleRaw
+//
+
+void BufferSwizzleTransform::deswizzleRaw(ArrayRef<char> in, MutableArrayRef<char> out) const {
+    const auto chunkSize = size_t(1) << LOG2_RAM_CUT_DATA_WIDTH;
+    const auto dataSize = alignVal(in.size(), chunkSize);
+    const auto numFullStripes = dataSize / _pattern->stripeSize;
+    VPUX_THROW_UNLESS(out.size() >= numFullStripes * _pattern->stripeSize,
+                      "Deswizzled buffer of '{0}' bytes is too small for the input of '{1}' bytes", out.size(),
+                      in.size());
+
+    forEachRun(*_pattern, dataSize, [&](size_t dpuAddr, size_t phyAddr, size_t size) {
+        VPUX_THROW_UNLESS(phyAddr < in.size(), "Swizzled address '{0}' is out of the buffer of '{1}' bytes", phyAddr,
+                          in.size());
+        const auto copySize = std::min(size, in.size() - phyAddr);
+        VPUX_THROW_UNLESS(dpuAddr + copySize <= out.size(), "Address '{0}' is out of the buffer of '{1}' bytes",
+                          dpuAddr, out.size());
+        std::memcpy(out.data() + dpuAddr, in.data() + phyAddr, copySize);
+    });
+}
+
 //
 // SwizzleConstantAttr::walkImmediateSubElements
 //
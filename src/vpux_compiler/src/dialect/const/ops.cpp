@@ -15,6 +15,8 @@
 #include "vpux/compiler/utils/error.hpp"
 #include "vpux/compiler/utils/types.hpp"
 
+#include "vpux/utils/core/checked_cast.hpp"
+
 #include <mlir/Dialect/MemRef/IR/MemRef.h>
 #include <mlir/Dialect/StandardOps/IR/Ops.h>
 #include <mlir/IR/DialectImplementation.h>
@@ -96,16 +98,15 @@ mlir::OpFoldResult vpux::Const::DeclareOp::fold(ArrayRef<mlir::Attribute> operan
 //
 
 void vpux::Const::DeclareOp::serialize(elf::writer::BinaryDataSection<uint8_t>& binDataSection) {
-    vpux::Const::Content cnt = content();
-    // int64_t typeTotalSize = cnt.getRawStorageBuf().size();
+    const auto totalByteSize = contentAttr().getType().getTotalAllocSize().count();
 
-    auto tmpBuf = std::make_unique<char[]>(cnt.getType().getTotalAllocSize().count());
+    auto tmpBuf = std::make_unique<char[]>(totalByteSize);
 
-    MutableArrayRef<char> buf(tmpBuf.get(), cnt.getType().getTotalAllocSize().count());
-    cnt.copyTo(buf);
+    MutableArrayRef<char> buf(tmpBuf.get(), totalByteSize);
+    contentAttr().copyFoldedTo(buf);
 
     auto ptrCharTmp = reinterpret_cast<uint8_t*>(tmpBuf.get());
-    binDataSection.appendData(ptrCharTmp, getBinarySize());
+    binDataSection.appendData(ptrCharTmp, buf.size());
 }
 
 //
@@ -113,9 +114,8 @@ void vpux::Const::DeclareOp::serialize(elf::writer::BinaryDataSection<uint8_t>&
 //
 
 size_t vpux::Const::DeclareOp::getBinarySize() {
-    vpux::Const::Content cnt = content();
-
-    return cnt.getType().getTotalAllocSize().count();
+    // The resulting type is inferred from the transformations, the content is not folded for that
+    return checked_cast<size_t>(contentAttr().getType().getTotalAllocSize().count());
 }
 
 //
@@ -34,37 +34,61 @@ private:
     void safeRunOnFunc() final;
 };
 
-void ConstantFoldingPass::safeRunOnFunc() {
-    auto func = getFunction();
+mlir::DenseElementsAttr foldToDenseAttr(Const::ContentAttr contentAttr, mlir::Location loc) {
+    const auto content = contentAttr.fold();
+    const auto contentType = content.getType();
+    const auto contentElemType = contentType.getElementType();
 
-    func.walk([&](Const::DeclareOp origOp) {
-        _log.trace("Folding constant at location '{0}'", origOp.getLoc());
+    const auto bufSize = checked_cast<size_t>(contentType.getTotalAllocSize().count());
+    std::vector<char> tempBuf(bufSize);
+    content.copyTo(makeMutableArrayRef(tempBuf.data(), bufSize));
 
-        mlir::OpBuilder builder(origOp);
+    auto rankedTensorType = contentType.cast<mlir::RankedTensorType>();
 
-        const auto content = origOp.content();
-        const auto contentType = content.getType();
-        const auto contentElemType = contentType.getElementType();
+    if (auto qtype = contentElemType.dyn_cast<mlir::quant::QuantizedType>()) {
+        rankedTensorType = contentType.changeElemType(normalizeQuantStorageType(qtype)).cast<mlir::RankedTensorType>();
+    }
 
-        const auto bufSize = checked_cast<size_t>(contentType.getTotalAllocSize().count());
-        std::vector<char> tempBuf(bufSize);
-        content.copyTo(makeMutableArrayRef(tempBuf.data(), bufSize));
+    bool isSplatBuffer = false;
+    VPUX_THROW_UNLESS(mlir::DenseElementsAttr::isValidRawBuffer(rankedTensorType, tempBuf, isSplatBuffer),
+                      "Constant node '{0}' has invalid buffer", loc);
 
-        auto rankedTensorType = contentType.cast<mlir::RankedTensorType>();
+    return mlir::DenseElementsAttr::getFromRawBuffer(rankedTensorType, tempBuf, isSplatBuffer);
+}
 
-        if (auto qtype = contentElemType.dyn_cast<mlir::quant::QuantizedType>()) {
-            rankedTensorType =
-                    contentType.changeElemType(normalizeQuantStorageType(qtype)).cast<mlir::RankedTensorType>();
-        }
+void ConstantFoldingPass::safeRunOnFunc() {
+    auto func = getFunction();
 
-        bool isSplatBuffer = false;
-        VPUX_THROW_UNLESS(mlir::DenseElementsAttr::isValidRawBuffer(rankedTensorType, tempBuf, isSplatBuffer),
-                          "Constant node '{0}' has invalid buffer", origOp.getLoc());
+    func.walk([&](Const::DeclareOp origOp) {
+        _log.trace("Folding constant at location '{0}'", origOp.getLoc());
 
-        const auto denseAttr = mlir::DenseElementsAttr::getFromRawBuffer(rankedTensorType, tempBuf, isSplatBuffer);
+        const auto contentAttr = origOp.contentAttr();
+
+        // The weights table is kept as the folded base table and the relocation record, the exporters resolve
+        // the relocation directly in the blob storage
+        Const::ContentAttr newContentAttr;
+        if (const auto relocation = contentAttr.getWeightsTableRelocation()) {
+            const auto transformations = contentAttr.getTransformations();
+            if (transformations.size() == 1 && contentAttr.getBaseContent().isa<mlir::DenseElementsAttr>()) {
+                _log.nest().trace("Weights table is already folded");
+                return;
+            }
+
+            auto baseAttr = Const::ContentAttr::get(contentAttr.getBaseContent());
+            for (const auto attr : makeArrayRef(transformations).drop_back()) {
+                baseAttr = Const::ContentAttr::addTransformation(baseAttr, attr);
+            }
+
+            _log.nest().trace("Folding base weights table, relocation '{0}' is resolved by the exporter", relocation);
+            const auto foldedBaseAttr = Const::ContentAttr::get(foldToDenseAttr(baseAttr, origOp.getLoc()));
+            newContentAttr = Const::ContentAttr::addTransformation(
+                    foldedBaseAttr, relocation.cast<Const::TransformAttrInterface>());
+        } else {
+            newContentAttr = Const::ContentAttr::get(foldToDenseAttr(contentAttr, origOp.getLoc()));
+        }
 
-        const auto newOp =
-                builder.create<Const::DeclareOp>(origOp.getLoc(), origOp.getType(), Const::ContentAttr::get(denseAttr));
+        mlir::OpBuilder builder(origOp);
+        const auto newOp = builder.create<Const::DeclareOp>(origOp.getLoc(), origOp.getType(), newContentAttr);
         origOp.replaceAllUsesWith(newOp);
 
         origOp.erase();
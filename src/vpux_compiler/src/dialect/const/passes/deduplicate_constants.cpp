@@ -0,0 +1,249 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/const/passes.hpp"
+
+#include "vpux/compiler/dialect/const/ops.hpp"
+
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/optional.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <mlir/IR/Dominance.h>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/Hashing.h>
+#include <llvm/ADT/STLExtras.h>
+
+#include <unordered_map>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+//
+// FoldedData
+//
+// The folded content of the constant. The base content without transformations is referred directly,
+// so only the constants with transformations are folded into the temporary buffer.
+//
+
+struct FoldedData final {
+    std::vector<char> storage;
+    ArrayRef<char> data;
+    Const::SharedElementsAttr shared;
+};
+
+FoldedData getFoldedData(Const::DeclareOp constOp) {
+    FoldedData res;
+
+    const auto contentAttr = constOp.contentAttr();
+    if (contentAttr.getTransformations().empty()) {
+        const auto baseContent = contentAttr.getBaseContent();
+
+        if (const auto shared = baseContent.dyn_cast<Const::SharedElementsAttr>()) {
+            res.data = shared.getRawData();
+            res.shared = shared;
+            return res;
+        }
+        if (const auto dense = baseContent.dyn_cast<mlir::DenseElementsAttr>()) {
+            if (!dense.isSplat()) {
+                res.data = dense.getRawData();
+                return res;
+            }
+        }
+    }
+
+    const auto content = contentAttr.fold();
+    res.storage.resize(checked_cast<size_t>(content.getType().getTotalAllocSize().count()));
+    content.copyTo(makeMutableArrayRef(res.storage.data(), res.storage.size()));
+    res.data = makeArrayRef(res.storage.data(), res.storage.size());
+    return res;
+}
+
+llvm::hash_code getContentHash(const FoldedData& folded) {
+    // The hash of the shared buffer is computed once and cached, it uses the same hash function
+    if (folded.shared != nullptr) {
+        return folded.shared.getContentHash();
+    }
+
+    return llvm::hash_value(StringRef(folded.data.data(), folded.data.size()));
+}
+
+// The constant folding creates the uniqued dense attributes, so the folded constants with the same content
+// share the same attribute. The weights tables are folded to the base table with the relocation record,
+// which is uniqued as well.
+bool isFolded(Const::DeclareOp constOp) {
+    const auto contentAttr = constOp.contentAttr();
+    const auto numTransformations = contentAttr.getTransformations().size();
+    const auto isFoldedWeightsTable = numTransformations == 1 && contentAttr.getWeightsTableRelocation() != nullptr;
+    return (numTransformations == 0 || isFoldedWeightsTable) &&
+           contentAttr.getBaseContent().isa<mlir::DenseElementsAttr>();
+}
+
+//
+// ConstantGroups
+//
+// The constants are fingerprinted by the folded content and the result type. The declarations with the same
+// content attribute are matched without folding. If all the constants were already folded, they are matched
+// by the attribute only and their content isn't read at all, which is the case in the compilation pipelines.
+//
+// Otherwise the constants with the same fingerprint are compared byte-wise, their folded data is kept
+// for the further comparisons, so each constant is folded at most twice: for its own fingerprint and once more,
+// if it is the first one with the given fingerprint.
+//
+
+class ConstantGroups final {
+public:
+    ConstantGroups(mlir::FuncOp func, bool compareContent): _domInfo(func), _compareContent(compareContent) {
+    }
+
+public:
+    // Returns the declaration with the same content, which dominates the given one, or NULL
+    Const::DeclareOp findDuplicate(Const::DeclareOp constOp);
+
+private:
+    struct AttrKey final {
+        Const::ContentAttr content;
+        mlir::Type type;
+    };
+
+    struct AttrKeyInfo final {
+        static AttrKey getEmptyKey() {
+            return {llvm::DenseMapInfo<Const::ContentAttr>::getEmptyKey(), nullptr};
+        }
+        static AttrKey getTombstoneKey() {
+            return {llvm::DenseMapInfo<Const::ContentAttr>::getTombstoneKey(), nullptr};
+        }
+        static unsigned getHashValue(const AttrKey& key) {
+            return static_cast<unsigned>(llvm::hash_combine(key.content, key.type));
+        }
+        static bool isEqual(const AttrKey& lhs, const AttrKey& rhs) {
+            return lhs.content == rhs.content && lhs.type == rhs.type;
+        }
+    };
+
+    struct Candidate final {
+        Const::DeclareOp constOp;
+        Optional<FoldedData> folded;
+    };
+
+private:
+    mlir::DominanceInfo _domInfo;
+    bool _compareContent = true;
+
+    llvm::DenseMap<AttrKey, SmallVector<Const::DeclareOp>, AttrKeyInfo> _byAttr;
+    std::unordered_map<size_t, std::vector<Candidate>> _byContent;
+};
+
+Const::DeclareOp ConstantGroups::findDuplicate(Const::DeclareOp constOp) {
+    const auto type = constOp.getType();
+
+    // The duplicates are erased by the caller, so only the unique constants are added to the groups
+    auto& sameAttr = _byAttr[AttrKey{constOp.contentAttr(), type}];
+    for (auto candidate : sameAttr) {
+        if (_domInfo.properlyDominates(candidate.getOperation(), constOp.getOperation())) {
+            return candidate;
+        }
+    }
+
+    if (!_compareContent) {
+        sameAttr.push_back(constOp);
+        return nullptr;
+    }
+
+    auto folded = getFoldedData(constOp);
+    const auto hash = static_cast<size_t>(llvm::hash_combine(type, getContentHash(folded)));
+
+    auto& sameContent = _byContent[hash];
+    for (auto& candidate : sameContent) {
+        if (candidate.constOp.getType() != type) {
+            continue;
+        }
+        if (!_domInfo.properlyDominates(candidate.constOp.getOperation(), constOp.getOperation())) {
+            continue;
+        }
+
+        // Hash collisions are possible, so the data is compared as well
+        if (!candidate.folded.hasValue()) {
+            candidate.folded = getFoldedData(candidate.constOp);
+        }
+        if (candidate.folded->data == folded.data) {
+            return candidate.constOp;
+        }
+    }
+
+    sameAttr.push_back(constOp);
+
+    // The data of the first constant with the given fingerprint is dropped, the most of them are unique
+    if (sameContent.empty()) {
+        sameContent.push_back(Candidate{constOp, None});
+    } else {
+        sameContent.push_back(Candidate{constOp, std::move(folded)});
+    }
+
+    return nullptr;
+}
+
+//
+// DeduplicateConstantsPass
+//
+
+class DeduplicateConstantsPass final : public Const::DeduplicateConstantsBase<DeduplicateConstantsPass> {
+public:
+    explicit DeduplicateConstantsPass(Logger log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnModule() final;
+};
+
+void DeduplicateConstantsPass::safeRunOnModule() {
+    auto module = getOperation();
+
+    size_t numRemoved = 0;
+    int64_t removedBytes = 0;
+
+    for (auto func : module.getOps<mlir::FuncOp>()) {
+        SmallVector<Const::DeclareOp> constOps;
+        func.walk([&](Const::DeclareOp constOp) {
+            constOps.push_back(constOp);
+        });
+
+        const auto compareContent = llvm::any_of(constOps, [](Const::DeclareOp constOp) {
+            return !isFolded(constOp);
+        });
+        ConstantGroups groups(func, compareContent);
+
+        for (auto constOp : constOps) {
+            const auto origOp = groups.findDuplicate(constOp);
+            if (origOp == nullptr) {
+                continue;
+            }
+
+            _log.trace("Constant at '{0}' duplicates the constant at '{1}'", constOp->getLoc(), origOp->getLoc());
+
+            ++numRemoved;
+            removedBytes += constOp.getType().cast<vpux::NDTypeInterface>().getTotalAllocSize().count();
+
+            constOp.replaceAllUsesWith(origOp.output());
+            constOp.erase();
+        }
+    }
+
+    _log.debug("Removed {0} duplicated constants, saved {1} bytes", numRemoved, removedBytes);
+}
+
+}  // namespace
+
+//
+// createDeduplicateConstantsPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::Const::createDeduplicateConstantsPass(Logger log) {
+    return std::make_unique<DeduplicateConstantsPass>(log);
+}
@@ -196,3 +196,11 @@ void vpux::Const::Content::fillWithZero() {
 void vpux::Const::Content::setStorageElemType(mlir::Type newStorageElemType) {
     _storageElemType = newStorageElemType;
 }
+
+//
+// getFoldingExecPolicy
+//
+
+LoopExecPolicy vpux::Const::getFoldingExecPolicy(mlir::MLIRContext* ctx) {
+    return ctx->isMultithreadingEnabled() ? LoopExecPolicy::Parallel : LoopExecPolicy::Sequential;
+}
@@ -0,0 +1,42 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/dialect/const/utils/shared_buffer.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <vector>
+
+using namespace vpux;
+
+//
+// SharedBuffer
+//
+
+vpux::Const::SharedBuffer::SharedBuffer(ArrayRef<char> data, Owner owner): _data(data), _owner(std::move(owner)) {
+    VPUX_THROW_WHEN(_data.data() == nullptr && !_data.empty(), "Got NULL data for non-empty SharedBuffer");
+}
+
+Const::SharedBufferPtr vpux::Const::SharedBuffer::create(ArrayRef<char> data, Owner owner) {
+    return std::make_shared<const SharedBuffer>(data, std::move(owner));
+}
+
+Const::SharedBufferPtr vpux::Const::SharedBuffer::copy(ArrayRef<char> data) {
+    auto storage = std::make_shared<std::vector<char>>(data.begin(), data.end());
+    const auto copiedData = makeArrayRef(storage->data(), storage->size());
+    return create(copiedData, std::move(storage));
+}
+
+llvm::hash_code vpux::Const::SharedBuffer::getContentHash() const {
+    std::call_once(_hashFlag, [this]() {
+        _hash = llvm::hash_value(StringRef(_data.data(), _data.size()));
+        _hashReady.store(true, std::memory_order_release);
+    });
+
+    return _hash;
+}
@@ -0,0 +1,232 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/dialect/const/utils/sparsity.hpp"
+
+#include "vpux/utils/IE/float16.hpp"
+#include "vpux/utils/IE/loop.hpp"
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/numeric.hpp"
+#include "vpux/utils/core/range.hpp"
+
+#include <climits>
+#include <cstring>
+#include <type_traits>
+
+using namespace vpux;
+
+namespace {
+
+//
+// RawValue
+//
+// The bit pattern of the storage type and the mask of the significant bits, the elements are sparse,
+// if their masked bit pattern is equal to the key.
+//
+
+template <size_t Size>
+struct RawType;
+
+template <>
+struct RawType<1> final {
+    using type = uint8_t;
+};
+
+template <>
+struct RawType<2> final {
+    using type = uint16_t;
+};
+
+template <>
+struct RawType<4> final {
+    using type = uint32_t;
+};
+
+template <typename StorageType>
+struct RawValue final {
+    using Raw = typename RawType<sizeof(StorageType)>::type;
+
+    static constexpr bool IS_FLOAT = std::is_floating_point<StorageType>::value ||
+                                     std::is_same<StorageType, float16>::value ||
+                                     std::is_same<StorageType, bfloat16>::value;
+
+    explicit RawValue(StorageType value) {
+        std::memcpy(&key, &value, sizeof(Raw));
+
+        // Both positive and negative zeros are equal to the floating point zero
+        if (IS_FLOAT && static_cast<float>(value) == 0.0f) {
+            mask = static_cast<Raw>(~(Raw(1) << (sizeof(Raw) * CHAR_BIT - 1)));
+            key &= mask;
+        }
+    }
+
+    bool isNonSparse(Raw value) const {
+        return (value & mask) != key;
+    }
+
+    Raw key = 0;
+    Raw mask = static_cast<Raw>(~Raw(0));
+};
+
+template <typename StorageType>
+const typename RawValue<StorageType>::Raw* getRawData(ArrayRef<StorageType> weights) {
+    return reinterpret_cast<const typename RawValue<StorageType>::Raw*>(weights.data());
+}
+
+template <typename StorageType>
+size_t getWorkloadSize(ArrayRef<StorageType> weights, int64_t numOC) {
+    VPUX_THROW_UNLESS(numOC > 0 && weights.size() % static_cast<size_t>(numOC) == 0,
+                      "Weights of '{0}' elements can't be split into '{1}' output channels", weights.size(), numOC);
+    return weights.size() / static_cast<size_t>(numOC);
+}
+
+// Fixed trip count without the early exits, so the loop is unrolled and vectorized
+template <typename StorageType>
+uint8_t getByteMask(const typename RawValue<StorageType>::Raw* data, const RawValue<StorageType>& sparseValue) {
+    uint8_t byteValue = 0;
+    for (size_t bitShift = 0; bitShift < CHAR_BIT; ++bitShift) {
+        byteValue |= static_cast<uint8_t>(sparseValue.isNonSparse(data[bitShift])) << bitShift;
+    }
+    return byteValue;
+}
+
+}  // namespace
+
+//
+// countNonSparseElements
+//
+
+template <typename StorageType>
+SmallVector<int64_t> vpux::Const::countNonSparseElements(ArrayRef<StorageType> weights, int64_t numOC,
+                                                         StorageType sparsifyValue) {
+    const auto workloadSize = getWorkloadSize(weights, numOC);
+    const auto data = getRawData(weights);
+    const RawValue<StorageType> sparseValue(sparsifyValue);
+
+    SmallVector<int64_t> elems(numOC, 0);
+    loop_1d(LoopExecPolicy::Parallel, numOC, [&](int64_t oc) {
+        const auto ocData = data + static_cast<size_t>(oc) * workloadSize;
+
+        size_t count = 0;
+        for (size_t i = 0; i < workloadSize; ++i) {
+            count += sparseValue.isNonSparse(ocData[i]) ? 1 : 0;
+        }
+
+        elems[oc] = checked_cast<int64_t>(count);
+    });
+
+    return elems;
+}
+
+//
+// buildSparsityMap
+//
+
+template <typename StorageType>
+void vpux::Const::buildSparsityMap(ArrayRef<StorageType> weights, int64_t numOC, StorageType sparsifyValue,
+                                   int64_t mapSizePerOC, MutableArrayRef<char> map) {
+    const auto workloadSize = getWorkloadSize(weights, numOC);
+    const auto data = getRawData(weights);
+    const RawValue<StorageType> sparseValue(sparsifyValue);
+
+    const auto numFullBytes = workloadSize / CHAR_BIT;
+    const auto numUsedBytes = divUp(workloadSize, static_cast<size_t>(CHAR_BIT));
+    VPUX_THROW_UNLESS(numUsedBytes <= static_cast<size_t>(mapSizePerOC) &&
+                              static_cast<size_t>(numOC * mapSizePerOC) <= map.size(),
+                      "Sparsity map of '{0}' bytes is too small for '{1}' output channels with '{2}' elements",
+                      map.size(), numOC, workloadSize);
+
+    auto mapData = reinterpret_cast<uint8_t*>(map.data());
+
+    loop_1d(LoopExecPolicy::Parallel, numOC, [&](int64_t oc) {
+        const auto inStartIdx = static_cast<size_t>(oc) * workloadSize;
+        const auto ocData = data + inStartIdx;
+        const auto ocMap = mapData + static_cast<size_t>(oc * mapSizePerOC);
+
+        for (size_t byteIdx = 0; byteIdx < numFullBytes; ++byteIdx) {
+            ocMap[byteIdx] = getByteMask(ocData + byteIdx * CHAR_BIT, sparseValue);
+        }
+
+        // The last partial byte takes the bits of the elements following the workload,
+        // the elements past the end of the weights are treated as sparse
+        if (numFullBytes != numUsedBytes) {
+            uint8_t byteValue = 0;
+            for (size_t bitShift = 0; bitShift < CHAR_BIT; ++bitShift) {
+                const auto inIdx = inStartIdx + numFullBytes * CHAR_BIT + bitShift;
+                if (inIdx < weights.size() && sparseValue.isNonSparse(data[inIdx])) {
+                    byteValue |= static_cast<uint8_t>(1 << bitShift);
+                }
+            }
+            ocMap[numFullBytes] = byteValue;
+        }
+    });
+}
+
+//
+// compactWeights
+//
+
+template <typename StorageType>
+void vpux::Const::compactWeights(ArrayRef<StorageType> weights, int64_t numOC, StorageType sparsifyValue,
+                                 int64_t alignment, MutableArrayRef<char> output) {
+    using Raw = typename RawValue<StorageType>::Raw;
+
+    const auto workloadSize = getWorkloadSize(weights, numOC);
+    const auto data = getRawData(weights);
+    const RawValue<StorageType> sparseValue(sparsifyValue);
+
+    // The offsets of the output channels depend on the number of the elements in all previous ones,
+    // so the elements are counted first and the channels are compacted independently after that
+    const auto numElems = countNonSparseElements(weights, numOC, sparsifyValue);
+
+    SmallVector<size_t> offsets(numOC + 1, 0);
+    for (auto oc : irange(numOC)) {
+        const auto byteSize = checked_cast<size_t>(numElems[oc]) * sizeof(StorageType);
+        offsets[oc + 1] = offsets[oc] + alignVal(byteSize, checked_cast<size_t>(alignment));
+    }
+    VPUX_THROW_UNLESS(offsets.back() <= output.size(),
+                      "Compacted weights of '{0}' bytes don't fit into the output buffer of '{1}' bytes",
+                      offsets.back(), output.size());
+
+    loop_1d(LoopExecPolicy::Parallel, numOC, [&](int64_t oc) {
+        const auto ocData = data + static_cast<size_t>(oc) * workloadSize;
+        const auto ocNumElems = static_cast<size_t>(numElems[oc]);
+
+        const auto outData = reinterpret_cast<Raw*>(output.data() + offsets[oc]);
+
+        // The element is always stored and the output position is advanced only for the non-sparse ones, which
+        // avoids the unpredictable branches. The loop stops after the last non-sparse element, so nothing
+        // is written past the data of the output channel.
+        size_t outIdx = 0;
+        for (size_t i = 0; i < workloadSize && outIdx < ocNumElems; ++i) {
+            const auto value = ocData[i];
+            outData[outIdx] = value;
+            outIdx += sparseValue.isNonSparse(value) ? 1 : 0;
+        }
+    });
+}
+
+//
+// Explicit instantiations
+//
+
+#define INSTANTIATE_SPARSITY_KERNELS(StorageType)                                                                  \
+    template SmallVector<int64_t> vpux::Const::countNonSparseElements<StorageType>(ArrayRef<StorageType>, int64_t, \
+                                                                                   StorageType);                   \
+    template void vpux::Const::buildSparsityMap<StorageType>(ArrayRef<StorageType>, int64_t, StorageType, int64_t, \
+                                                             MutableArrayRef<char>);                               \
+    template void vpux::Const::compactWeights<StorageType>(ArrayRef<StorageType>, int64_t, StorageType, int64_t,   \
+                                                           MutableArrayRef<char>);
+
+INSTANTIATE_SPARSITY_KERNELS(int8_t)
+INSTANTIATE_SPARSITY_KERNELS(uint8_t)
+INSTANTIATE_SPARSITY_KERNELS(float16)
+INSTANTIATE_SPARSITY_KERNELS(bfloat16)
+INSTANTIATE_SPARSITY_KERNELS(float)
+
+#undef INSTANTIATE_SPARSITY_KERNELS
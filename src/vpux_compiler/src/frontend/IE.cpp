@@ -633,11 +633,10 @@ void NGraphImporter::parseNode(mlir::OpBuilder& builder, const std::shared_ptr<o
 
     mlir::ElementsAttr value;
     if (_sharedConstants) {
-        auto* dialect = _ctx->getLoadedDialect<IE::IEDialect>();
-        VPUX_THROW_UNLESS(dialect != nullptr, "Got NULL pointer for IEDialect");
-
-        const auto rawBuffer = StringRef(origNode->get_data_ptr<char>(), numElems * elemTypeSize.count());
-        value = mlir::OpaqueElementsAttr::get(dialect, tensorType, rawBuffer);
+        // The buffer holds the reference to the nGraph node, so the weights are neither copied nor hashed here
+        // and stay valid even if the network is released before the compilation is finished
+        const auto rawBuffer = makeArrayRef(origNode->get_data_ptr<char>(), numElems * elemTypeSize.count());
+        value = Const::SharedElementsAttr::get(tensorType, Const::SharedBuffer::create(rawBuffer, origNode));
     } else {
         const auto rawBuffer = makeArrayRef(origNode->get_data_ptr<char>(), numElems * elemTypeSize.count());
 
@@ -152,6 +152,7 @@ void vpux::buildReferenceSWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(VPURT::createBarrierSimulationPass(log));
     pm.addPass(VPUIP::createDumpStatisticsOfTaskOpsPass(options.enableCompressWeightsBTC, log));
     pm.addPass(Const::createConstantFoldingPass());
+    pm.addPass(Const::createDeduplicateConstantsPass(log));
 }
 
 //
@@ -456,6 +457,7 @@ void vpux::buildReferenceHWModePipeline(mlir::OpPassManager& pm, const Reference
     pm.addPass(VPURT::createBarrierSimulationPass(log));
     pm.addPass(VPUIP::createDumpStatisticsOfTaskOpsPass(options.enableCompressWeightsBTC, log));
     pm.addPass(Const::createConstantFoldingPass());
+    pm.addPass(Const::createDeduplicateConstantsPass(log));
 }
 
 //
@@ -773,6 +775,7 @@ void vpux::buildDefaultHWModePipeline(mlir::OpPassManager& pm, const DefaultHWOp
     pm.addPass(VPURT::createBarrierSimulationPass(log));
     pm.addPass(VPUIP::createDumpStatisticsOfTaskOpsPass(options.enableCompressWeightsBTC, log));
     pm.addPass(Const::createConstantFoldingPass());
+    pm.addPass(Const::createDeduplicateConstantsPass(log));
 }
 
 //
@@ -0,0 +1,266 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/utils/compile_telemetry.hpp"
+
+#include "vpux/compiler/core/type_interfaces.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/dialect/const/utils/content.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <mlir/Pass/Pass.h>
+#include <mlir/Pass/PassInstrumentation.h>
+
+#include <llvm/Support/JSON.h>
+
+#include <map>
+
+using namespace vpux;
+
+namespace {
+
+double getElapsedMs(std::chrono::steady_clock::time_point start) {
+    using namespace std::chrono;
+    return duration_cast<duration<double, std::milli>>(steady_clock::now() - start).count();
+}
+
+// llvm::json supports only signed integers
+int64_t toJson(uint64_t val) {
+    return static_cast<int64_t>(val);
+}
+
+int64_t getDelta(uint64_t before, uint64_t after) {
+    return toJson(after) - toJson(before);
+}
+
+}  // namespace
+
+//
+// IRSize
+//
+
+IRSize vpux::getIRSize(mlir::Operation* root) {
+    IRSize size;
+    if (root == nullptr) {
+        return size;
+    }
+
+    root->walk([&](mlir::Operation* op) {
+        ++size.numOps;
+
+        if (auto declareOp = mlir::dyn_cast<Const::DeclareOp>(op)) {
+            ++size.numConstants;
+            size.constBytes += declareOp.output().getType().cast<vpux::NDTypeInterface>().getTotalAllocSize().count();
+        }
+    });
+
+    return size;
+}
+
+//
+// CompileTelemetry
+//
+
+vpux::CompileTelemetry::CompileTelemetry()
+        : _startTime(std::chrono::steady_clock::now()), _initialMemory(getProcessMemoryUsage()) {
+}
+
+void vpux::CompileTelemetry::addRecord(TelemetryRecord record) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _records.push_back(std::move(record));
+}
+
+std::vector<TelemetryRecord> vpux::CompileTelemetry::getRecords() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _records;
+}
+
+void vpux::CompileTelemetry::printAsJson(llvm::raw_ostream& stream) const {
+    const auto records = getRecords();
+    const auto finalMemory = getProcessMemoryUsage();
+
+    llvm::json::OStream json(stream, 2);
+    json.object([&]() {
+        json.attribute("total_wall_time_ms", getElapsedMs(_startTime));
+        json.attribute("initial_rss", toJson(_initialMemory.rss));
+        json.attribute("final_rss", toJson(finalMemory.rss));
+        json.attribute("peak_rss", toJson(finalMemory.peakRss));
+
+        json.attributeArray("records", [&]() {
+            for (const auto& record : records) {
+                json.object([&]() {
+                    json.attribute("name", record.name);
+                    json.attribute("kind", record.kind);
+                    json.attribute("anchor", record.anchor);
+                    json.attribute("wall_time_ms", record.wallTimeMs);
+                    json.attribute("failed", record.failed);
+
+                    json.attribute("ops_before", toJson(record.before.numOps));
+                    json.attribute("ops_after", toJson(record.after.numOps));
+                    json.attribute("constants_before", toJson(record.before.numConstants));
+                    json.attribute("constants_after", toJson(record.after.numConstants));
+                    json.attribute("const_bytes_before", record.before.constBytes);
+                    json.attribute("const_bytes_after", record.after.constBytes);
+                    json.attribute("const_bytes_folded", toJson(record.foldedBytes));
+
+                    json.attribute("rss_after", toJson(record.memAfter.rss));
+                    json.attribute("rss_delta", getDelta(record.memBefore.rss, record.memAfter.rss));
+                    json.attribute("peak_rss", toJson(record.memAfter.peakRss));
+                    json.attribute("peak_rss_delta", getDelta(record.memBefore.peakRss, record.memAfter.peakRss));
+                    json.attribute("heap_delta", getDelta(record.memBefore.heapSize, record.memAfter.heapSize));
+                });
+            }
+        });
+    });
+
+    stream << "\n";
+}
+
+void vpux::CompileTelemetry::writeToFile(StringRef fileName) const {
+    std::error_code err;
+    llvm::raw_fd_ostream stream(fileName, err);
+    VPUX_THROW_WHEN(err, "Failed to open file '{0}' for write : {1}", fileName, err.message());
+
+    printAsJson(stream);
+}
+
+//
+// PassTelemetry
+//
+
+namespace {
+
+class PassTelemetry final : public mlir::PassInstrumentation {
+public:
+    explicit PassTelemetry(std::shared_ptr<CompileTelemetry> telemetry): _telemetry(std::move(telemetry)) {
+    }
+
+    void runBeforePass(mlir::Pass* pass, mlir::Operation* op) final;
+    void runAfterPass(mlir::Pass* pass, mlir::Operation* op) final;
+    void runAfterPassFailed(mlir::Pass* pass, mlir::Operation* op) final;
+
+private:
+    // The adaptors just run the nested pipelines, which are recorded on their own
+    static bool isAdaptor(mlir::Pass* pass) {
+        return pass->getArgument().empty() && pass->getName().contains("OpToOpPassAdaptor");
+    }
+
+    void finish(mlir::Pass* pass, mlir::Operation* op, bool failed);
+
+private:
+    struct ActivePass final {
+        TelemetryRecord record;
+        std::chrono::steady_clock::time_point startTime;
+        uint64_t foldedBytesBefore = 0;
+    };
+
+    std::shared_ptr<CompileTelemetry> _telemetry;
+
+    // The nested passes might be run on several operations in parallel
+    std::mutex _mutex;
+    std::map<std::pair<mlir::Pass*, mlir::Operation*>, ActivePass> _activePasses;
+};
+
+void PassTelemetry::runBeforePass(mlir::Pass* pass, mlir::Operation* op) {
+    if (isAdaptor(pass)) {
+        return;
+    }
+
+    ActivePass active;
+    active.record.name = pass->getArgument().empty() ? pass->getName().str() : pass->getArgument().str();
+    active.record.kind = "pass";
+    active.record.anchor = op->getName().getStringRef().str();
+    active.record.before = getIRSize(op);
+    active.record.memBefore = getProcessMemoryUsage();
+    active.foldedBytesBefore = Const::getFoldedBytes();
+
+    // Start the timer last, the IR walk above is not a part of the pass
+    active.startTime = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _activePasses[std::make_pair(pass, op)] = std::move(active);
+}
+
+void PassTelemetry::runAfterPass(mlir::Pass* pass, mlir::Operation* op) {
+    finish(pass, op, false);
+}
+
+void PassTelemetry::runAfterPassFailed(mlir::Pass* pass, mlir::Operation* op) {
+    finish(pass, op, true);
+}
+
+void PassTelemetry::finish(mlir::Pass* pass, mlir::Operation* op, bool failed) {
+    if (isAdaptor(pass)) {
+        return;
+    }
+
+    const auto endTime = std::chrono::steady_clock::now();
+
+    ActivePass active;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto it = _activePasses.find(std::make_pair(pass, op));
+        if (it == _activePasses.end()) {
+            return;
+        }
+
+        active = std::move(it->second);
+        _activePasses.erase(it);
+    }
+
+    active.record.wallTimeMs =
+            std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(endTime - active.startTime).count();
+    active.record.foldedBytes = Const::getFoldedBytes() - active.foldedBytesBefore;
+    active.record.memAfter = getProcessMemoryUsage();
+    active.record.after = getIRSize(op);
+    active.record.failed = failed;
+
+    _telemetry->addRecord(std::move(active.record));
+}
+
+}  // namespace
+
+void vpux::addTelemetry(mlir::PassManager& pm, const std::shared_ptr<CompileTelemetry>& telemetry) {
+    VPUX_THROW_UNLESS(telemetry != nullptr, "Got NULL telemetry");
+    pm.addInstrumentation(std::make_unique<PassTelemetry>(telemetry));
+}
+
+//
+// TelemetryScope
+//
+
+vpux::TelemetryScope::TelemetryScope(CompileTelemetry* telemetry, StringRef name, mlir::Operation* op)
+        : _telemetry(telemetry), _op(op) {
+    if (_telemetry == nullptr) {
+        return;
+    }
+
+    _record.name = name.str();
+    _record.kind = "stage";
+    _record.before = getIRSize(_op);
+    _record.memBefore = getProcessMemoryUsage();
+    _foldedBytesBefore = Const::getFoldedBytes();
+    _startTime = std::chrono::steady_clock::now();
+}
+
+vpux::TelemetryScope::~TelemetryScope() {
+    if (_telemetry == nullptr) {
+        return;
+    }
+
+    _record.wallTimeMs = getElapsedMs(_startTime);
+    _record.foldedBytes = Const::getFoldedBytes() - _foldedBytesBefore;
+    _record.memAfter = getProcessMemoryUsage();
+
+    if (_op != nullptr) {
+        _record.anchor = _op->getName().getStringRef().str();
+        _record.after = getIRSize(_op);
+    }
+
+    _telemetry->addRecord(std::move(_record));
+}
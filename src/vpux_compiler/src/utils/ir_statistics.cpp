@@ -0,0 +1,259 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/utils/ir_statistics.hpp"
+
+#include "vpux/compiler/core/type_interfaces.hpp"
+#include "vpux/compiler/dialect/VPUIP/ops.hpp"
+#include "vpux/compiler/dialect/VPURT/ops.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <mlir/Dialect/MemRef/IR/MemRef.h>
+
+#include <llvm/ADT/Hashing.h>
+#include <llvm/Support/JSON.h>
+
+#include <unordered_map>
+
+using namespace vpux;
+
+namespace {
+
+// llvm::json supports only signed integers
+int64_t toJson(uint64_t val) {
+    return static_cast<int64_t>(val);
+}
+
+ArrayRef<char> getBaseRawData(mlir::ElementsAttr baseContent) {
+    if (const auto dense = baseContent.dyn_cast<mlir::DenseElementsAttr>()) {
+        return dense.getRawData();
+    }
+    if (const auto shared = baseContent.dyn_cast<Const::SharedElementsAttr>()) {
+        return shared.getRawData();
+    }
+
+    const auto opaque = baseContent.cast<mlir::OpaqueElementsAttr>();
+    const auto bytes = opaque.getValue();
+    return makeArrayRef(bytes.data(), bytes.size());
+}
+
+//
+// ConstantGroups
+//
+// Constants are grouped by the hash of the base content, base type and transformations.
+// The base content of the dense attributes is uniqued by MLIR, but the opaque buffers are not,
+// so the candidates with the same hash are compared by the content as well.
+//
+// Nothing is folded, so only the constants with the same base and the same chain of transformations are
+// detected as duplicates. The constants, which are folded into the same data from the different bases or by
+// the different chains (e.g. Reorder + Reshape vs Reshape + Reorder), or which were already folded into
+// the separate base contents, are counted as distinct. The duplicate counters are the lower bound.
+//
+
+class ConstantGroups final {
+public:
+    void add(Const::ContentAttr content, int64_t foldedBytes);
+    void fillStatistics(IRStatistics& stats) const;
+
+private:
+    struct Group final {
+        Const::ContentAttr representative;
+        size_t count;
+        int64_t foldedBytes;
+    };
+
+    static bool isSameContent(Const::ContentAttr lhs, Const::ContentAttr rhs);
+
+private:
+    std::unordered_map<size_t, SmallVector<Group>> _groups;
+};
+
+bool ConstantGroups::isSameContent(Const::ContentAttr lhs, Const::ContentAttr rhs) {
+    if (lhs == rhs) {
+        return true;
+    }
+
+    const auto lhsBase = lhs.getBaseContent();
+    const auto rhsBase = rhs.getBaseContent();
+    if (lhsBase.getType() != rhsBase.getType() || lhs.getTransformations() != rhs.getTransformations()) {
+        return false;
+    }
+
+    return getBaseRawData(lhsBase) == getBaseRawData(rhsBase);
+}
+
+void ConstantGroups::add(Const::ContentAttr content, int64_t foldedBytes) {
+    const auto baseContent = content.getBaseContent();
+    const auto rawData = getBaseRawData(baseContent);
+
+    auto hash = llvm::hash_combine(llvm::hash_value(StringRef(rawData.data(), rawData.size())),
+                                   mlir::hash_value(baseContent.getType()));
+    for (const auto& transformation : content.getTransformations()) {
+        hash = llvm::hash_combine(hash, mlir::hash_value(transformation));
+    }
+
+    auto& candidates = _groups[static_cast<size_t>(hash)];
+    for (auto& group : candidates) {
+        if (isSameContent(group.representative, content)) {
+            ++group.count;
+            return;
+        }
+    }
+
+    candidates.push_back({content, 1, foldedBytes});
+}
+
+void ConstantGroups::fillStatistics(IRStatistics& stats) const {
+    for (const auto& candidates : _groups) {
+        for (const auto& group : candidates.second) {
+            if (group.count < 2) {
+                continue;
+            }
+
+            ++stats.numDuplicateGroups;
+            stats.numDuplicateConstants += group.count - 1;
+            stats.duplicateFoldedBytes += group.foldedBytes * checked_cast<int64_t>(group.count - 1);
+        }
+    }
+}
+
+void addBuffer(IRStatistics& stats, StringRef memory, mlir::Value buffer, Optional<int64_t> byteOffset = None) {
+    const auto type = buffer.getType().dyn_cast<vpux::NDTypeInterface>();
+    if (type == nullptr) {
+        return;
+    }
+
+    const auto size = type.getTotalAllocSize().count();
+
+    auto& bufferStats = stats.buffersPerMemory[memory.str()];
+    ++bufferStats.count;
+    bufferStats.bytes += size;
+    if (byteOffset.hasValue()) {
+        bufferStats.extentBytes = std::max(bufferStats.extentBytes, byteOffset.getValue() + size);
+    }
+}
+
+void addAllocatedBuffer(IRStatistics& stats, mlir::Value buffer, Optional<int64_t> byteOffset = None) {
+    const auto type = buffer.getType().dyn_cast<vpux::NDTypeInterface>();
+    if (type == nullptr) {
+        return;
+    }
+
+    addBuffer(stats, stringifyEnum(type.getMemoryKind()), buffer, byteOffset);
+}
+
+}  // namespace
+
+//
+// getIRStatistics
+//
+
+IRStatistics vpux::getIRStatistics(mlir::Operation* root) {
+    IRStatistics stats;
+    if (root == nullptr) {
+        return stats;
+    }
+
+    ConstantGroups constants;
+
+    root->walk([&](mlir::Operation* op) {
+        ++stats.numOps;
+
+        const auto dialect = op->getName().getDialectNamespace();
+        ++stats.opsPerDialect[dialect.empty() ? "builtin" : dialect.str()];
+
+        if (auto declareOp = mlir::dyn_cast<Const::DeclareOp>(op)) {
+            const auto content = declareOp.contentAttr();
+            const auto numTransformations = content.getTransformations().size();
+            const auto foldedBytes = content.getType().getTotalAllocSize().count();
+
+            ++stats.numConstants;
+            stats.constBaseBytes += checked_cast<int64_t>(getBaseRawData(content.getBaseContent()).size());
+            stats.constFoldedBytes += foldedBytes;
+            stats.maxTransformations = std::max(stats.maxTransformations, numTransformations);
+            stats.totalTransformations += numTransformations;
+            ++stats.transformationsHistogram[numTransformations];
+
+            constants.add(content, foldedBytes);
+        } else if (auto declareBufferOp = mlir::dyn_cast<VPURT::DeclareBufferOp>(op)) {
+            addBuffer(stats, stringifyEnum(declareBufferOp.section()), declareBufferOp.buffer(),
+                      checked_cast<int64_t>(declareBufferOp.byteOffset()));
+        } else if (auto allocOp = mlir::dyn_cast<mlir::memref::AllocOp>(op)) {
+            addAllocatedBuffer(stats, allocOp.memref());
+        } else if (auto allocOp = mlir::dyn_cast<VPURT::Alloc>(op)) {
+            addAllocatedBuffer(stats, allocOp.buffer());
+        } else if (auto allocOp = mlir::dyn_cast<VPURT::AllocDistributed>(op)) {
+            addAllocatedBuffer(stats, allocOp.buffer());
+        } else if (auto staticAllocOp = mlir::dyn_cast<VPUIP::StaticAllocOp>(op)) {
+            addAllocatedBuffer(stats, staticAllocOp.memory(), checked_cast<int64_t>(staticAllocOp.offset()));
+        } else if (mlir::isa<VPURT::DeclareVirtualBarrierOp>(op)) {
+            ++stats.numVirtualBarriers;
+        } else if (mlir::isa<VPURT::ConfigureBarrierOp>(op)) {
+            ++stats.numPhysicalBarriers;
+        }
+    });
+
+    constants.fillStatistics(stats);
+    return stats;
+}
+
+//
+// printIRStatisticsAsJson
+//
+
+void vpux::printIRStatisticsAsJson(const IRStatistics& stats, StringRef afterPass, llvm::raw_ostream& stream) {
+    llvm::json::OStream json(stream);
+    json.object([&]() {
+        if (!afterPass.empty()) {
+            json.attribute("after_pass", afterPass);
+        }
+
+        json.attribute("ops", toJson(stats.numOps));
+        json.attributeObject("ops_per_dialect", [&]() {
+            for (const auto& dialect : stats.opsPerDialect) {
+                json.attribute(dialect.first, toJson(dialect.second));
+            }
+        });
+
+        json.attributeObject("constants", [&]() {
+            json.attribute("count", toJson(stats.numConstants));
+            json.attribute("base_bytes", stats.constBaseBytes);
+            json.attribute("folded_bytes", stats.constFoldedBytes);
+            json.attribute("max_transformations", toJson(stats.maxTransformations));
+            json.attribute("total_transformations", toJson(stats.totalTransformations));
+            json.attributeObject("transformations_histogram", [&]() {
+                for (const auto& bin : stats.transformationsHistogram) {
+                    json.attribute(std::to_string(bin.first), toJson(bin.second));
+                }
+            });
+            json.attribute("duplicate_groups", toJson(stats.numDuplicateGroups));
+            json.attribute("duplicates", toJson(stats.numDuplicateConstants));
+            json.attribute("duplicate_folded_bytes", stats.duplicateFoldedBytes);
+        });
+
+        json.attributeObject("buffers", [&]() {
+            for (const auto& memory : stats.buffersPerMemory) {
+                json.attributeObject(memory.first, [&]() {
+                    json.attribute("count", toJson(memory.second.count));
+                    json.attribute("bytes", memory.second.bytes);
+                    json.attribute("extent_bytes", memory.second.extentBytes);
+                });
+            }
+        });
+
+        json.attributeObject("barriers", [&]() {
+            json.attribute("virtual", toJson(stats.numVirtualBarriers));
+            json.attribute("physical", toJson(stats.numPhysicalBarriers));
+        });
+    });
+
+    stream << "\n";
+}
@@ -8,6 +8,8 @@
 #include <ngraph/pass/manager.hpp>
 #include <ngraph/pass/serialize.hpp>
 
+#include <utility>
+
 namespace vpux {
 namespace driverCompilerAdapter {
 namespace ngraphTransformations {
@@ -41,7 +43,7 @@ IR serializeToIR(const std::shared_ptr<ngraph::Function>& netGraph) {
     xmlStream.read(xmlBlob.data(), xmlSize);
     weightsStream.read(weightsBlob.data(), weightsSize);
 
-    return {xmlBlob, weightsBlob};
+    return {std::move(xmlBlob), std::move(weightsBlob)};
 }
 
 }  // namespace ngraphTransformations
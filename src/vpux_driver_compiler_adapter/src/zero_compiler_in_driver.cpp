@@ -7,6 +7,8 @@
 #include "vpux/al/config/common.hpp"
 #include "vpux/utils/IE/itt.hpp"
 
+#include <tuple>
+
 namespace vpux {
 namespace driverCompilerAdapter {
 
@@ -223,9 +225,27 @@ LevelZeroCompilerInDriver::~LevelZeroCompilerInDriver() {
 }
 
 using SerializedIR = std::vector<uint8_t>;
+
+// Contract between adapter and compiler in driver, must be in sync with vcl_weights_desc_t
+struct WeightsDescriptor final {
+    const uint8_t* data;
+    uint64_t size;
+};
+
+// Weights can be passed by reference starting from compiler in driver 2.2
+constexpr uint32_t WEIGHTS_BY_REFERENCE_FLAG = 0x80000000u;
+constexpr uint16_t WEIGHTS_BY_REFERENCE_MAJOR = 2;
+constexpr uint16_t WEIGHTS_BY_REFERENCE_MINOR = 2;
+
 /**
  * @brief Place xml + weights in sequential memory
  * @details Format of the memory:
+ *  1. Compiler version
+ *  2. Number of data elements (xml + weights = 2), may be combined with the weights by reference flag
+ *  3. Size of xml, xml
+ *  4. Size of weights, weights
+ * If the compiler supports weights by reference, the 4th item is the size of the descriptor and the descriptor
+ * itself, so the weights are not copied. The weights must stay valid until the graph is created.
  */
 SerializedIR LevelZeroCompilerInDriver::serializeIR(const std::vector<char>& xml, const std::vector<char>& weights) {
     // Contract between adapter and compiler in driver
@@ -242,6 +262,12 @@ SerializedIR LevelZeroCompilerInDriver::serializeIR(const std::vector<char>& xml
 
     const auto compilerVersion = device_graph_properties.compilerVersion;
 
+    const bool weightsByReference =
+            std::make_tuple(compilerVersion.major, compilerVersion.minor) >=
+            std::make_tuple(WEIGHTS_BY_REFERENCE_MAJOR, WEIGHTS_BY_REFERENCE_MINOR);
+    _logger.debug("Compiler version {0}.{1}, weights are passed by {2}", compilerVersion.major, compilerVersion.minor,
+                  weightsByReference ? "reference" : "copy");
+
     const uint32_t numberOfInputData = 2;
     const uint64_t xmlSize = static_cast<uint64_t>(xml.size());
     const uint64_t weightsSize = static_cast<uint64_t>(weights.size());
@@ -254,8 +280,16 @@ SerializedIR LevelZeroCompilerInDriver::serializeIR(const std::vector<char>& xml
         IE_THROW() << "Bin file is too big to process.";
     }
 
-    const uint64_t sizeOfSerializedIR = sizeof(compilerVersion) + sizeof(numberOfInputData) + sizeof(xmlSize) +
-                                        xml.size() + sizeof(weightsSize) + weights.size();
+    const uint32_t inputDataHeader = weightsByReference ? (numberOfInputData | WEIGHTS_BY_REFERENCE_FLAG)
+                                                        : numberOfInputData;
+
+    const WeightsDescriptor weightsDesc{reinterpret_cast<const uint8_t*>(weights.data()), weightsSize};
+    const void* weightsData = weightsByReference ? static_cast<const void*>(&weightsDesc)
+                                                 : static_cast<const void*>(weights.data());
+    const uint64_t weightsDataSize = weightsByReference ? sizeof(weightsDesc) : weightsSize;
+
+    const uint64_t sizeOfSerializedIR = sizeof(compilerVersion) + sizeof(inputDataHeader) + sizeof(xmlSize) +
+                                        xml.size() + sizeof(weightsDataSize) + weightsDataSize;
 
     std::vector<uint8_t> serializedIR;
     serializedIR.resize(sizeOfSerializedIR);
@@ -264,16 +298,16 @@ SerializedIR LevelZeroCompilerInDriver::serializeIR(const std::vector<char>& xml
     ie_memcpy(serializedIR.data() + offset, sizeOfSerializedIR - offset, &compilerVersion, sizeof(compilerVersion));
     offset += sizeof(compilerVersion);
 
-    ie_memcpy(serializedIR.data() + offset, sizeOfSerializedIR - offset, &numberOfInputData, sizeof(numberOfInputData));
-    offset += sizeof(numberOfInputData);
+    ie_memcpy(serializedIR.data() + offset, sizeOfSerializedIR - offset, &inputDataHeader, sizeof(inputDataHeader));
+    offset += sizeof(inputDataHeader);
     ie_memcpy(serializedIR.data() + offset, sizeOfSerializedIR - offset, &xmlSize, sizeof(xmlSize));
     offset += sizeof(xmlSize);
     ie_memcpy(serializedIR.data() + offset, sizeOfSerializedIR - offset, xml.data(), xmlSize);
     offset += xmlSize;
-    ie_memcpy(serializedIR.data() + offset, sizeOfSerializedIR - offset, &weightsSize, sizeof(weightsSize));
-    offset += sizeof(weightsSize);
-    ie_memcpy(serializedIR.data() + offset, sizeOfSerializedIR - offset, weights.data(), weightsSize);
-    offset += weightsSize;
+    ie_memcpy(serializedIR.data() + offset, sizeOfSerializedIR - offset, &weightsDataSize, sizeof(weightsDataSize));
+    offset += sizeof(weightsDataSize);
+    ie_memcpy(serializedIR.data() + offset, sizeOfSerializedIR - offset, weightsData, weightsDataSize);
+    offset += weightsDataSize;
 
     IE_ASSERT(offset == sizeOfSerializedIR);
 
@@ -0,0 +1,107 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+// System
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+
+// IE
+#include <cpp/ie_cnn_network.h>
+
+// Plugin
+#include "vpux/utils/IE/config.hpp"
+#include "vpux/utils/core/logger.hpp"
+
+namespace vpux {
+
+/**
+ * @brief Read-only view of a blob stored in the compiled network cache.
+ * The memory is mapped from the cache file and stays valid until the object is destroyed,
+ * even if the file itself is evicted in the meantime. The object can be used as a seekable
+ * stream buffer to import the network without reading the file into an intermediate buffer.
+ */
+class CachedBlob final : public std::streambuf {
+public:
+    using Ptr = std::shared_ptr<CachedBlob>;
+
+    CachedBlob(char* data, size_t size);
+    ~CachedBlob() override;
+
+    CachedBlob(const CachedBlob&) = delete;
+    CachedBlob& operator=(const CachedBlob&) = delete;
+
+    const char* data() const {
+        return _data;
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+private:
+    char* _data;
+    size_t _size;
+};
+
+/**
+ * @brief On-disk cache of compiled networks shared between processes.
+ * Entries are keyed by a stable hash of the serialized model, the compile-time config options
+ * and the plugin version. Entries are published atomically and evicted in LRU order once the
+ * total size of the cache directory exceeds the configured capacity.
+ */
+class CompiledBlobCache final {
+public:
+    struct Statistics final {
+        std::atomic<uint64_t> hits{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> bytes{0};
+    };
+
+    using BlobWriter = std::function<void(std::ostream&)>;
+
+    CompiledBlobCache(std::string cacheDir, uint64_t capacityBytes, Statistics& stats, Logger log);
+
+    /**
+     * @brief Computes the cache key for the network compiled with the given config
+     * @param network network to be compiled
+     * @param config config object, which must already contain the resolved compilation platform
+     * @return hexadecimal string, suitable to be used as file name
+     */
+    static std::string computeKey(const InferenceEngine::CNNNetwork& network, const Config& config);
+
+    /**
+     * @brief Maps the cached blob into memory
+     * @return pointer to the mapped blob or nullptr, if there is no entry for the key
+     */
+    CachedBlob::Ptr load(const std::string& key);
+
+    /**
+     * @brief Publishes the blob produced by the writer callback under the key and evicts the least
+     * recently used entries, if the cache exceeds its capacity
+     */
+    void store(const std::string& key, const BlobWriter& writer);
+
+private:
+    std::string getEntryPath(const std::string& key) const;
+    void evict(const std::string& keptEntry);
+
+    std::string _cacheDir;
+    uint64_t _capacityBytes;
+    Statistics& _stats;
+    Logger _logger;
+};
+
+}  // namespace vpux
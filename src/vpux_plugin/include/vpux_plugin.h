@@ -18,6 +18,7 @@
 // Plugin
 #include "vpux.hpp"
 #include "vpux_backends.h"
+#include "vpux_compiled_blob_cache.h"
 #include "vpux_compiler.hpp"
 #include "vpux_metrics.h"
 
@@ -69,11 +70,16 @@ private:
                                                                     std::shared_ptr<Device>& device,
                                                                     const Config& networkConfig);
 
+    InferenceEngine::IExecutableNetworkInternal::Ptr LoadCachedExeNetwork(const InferenceEngine::CNNNetwork& network,
+                                                                          std::shared_ptr<Device>& device,
+                                                                          const Config& networkConfig);
+
 private:
     std::shared_ptr<OptionsDesc> _options;
     Config _globalConfig;
     VPUXBackends::Ptr _backends;
     std::unique_ptr<Metrics> _metrics;
+    CompiledBlobCache::Statistics _blobCacheStats;
     Logger _logger;
 };
 
@@ -0,0 +1,354 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux_compiled_blob_cache.h"
+
+// System
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+// IE
+#include <ngraph/pass/manager.hpp>
+#include <ngraph/pass/serialize.hpp>
+
+// Plugin
+#include "version.hpp"
+#include "vpux/al/config/common.hpp"
+#include "vpux/al/config/compiler.hpp"
+#include "vpux/utils/IE/itt.hpp"
+#include "vpux/utils/core/error.hpp"
+
+namespace vpux {
+namespace IE = InferenceEngine;
+
+//------------------------------------------------------------------------------
+//      Helpers
+//------------------------------------------------------------------------------
+namespace {
+
+constexpr StringLiteral CACHE_ENTRY_EXTENSION = ".blob";
+
+// 64-bit FNV-1a is used instead of std::hash since the key has to be stable across processes and builds
+class StableHash final {
+public:
+    void update(const char* data, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            _value ^= static_cast<uint8_t>(data[i]);
+            _value *= 0x100000001b3ULL;
+        }
+        _size += size;
+    }
+
+    void update(StringRef str) {
+        update(str.data(), str.size());
+        // Separator makes sure that ("ab", "c") and ("a", "bc") produce different hashes
+        const char separator = '\0';
+        update(&separator, 1);
+    }
+
+    uint64_t value() const {
+        return _value;
+    }
+
+    uint64_t size() const {
+        return _size;
+    }
+
+private:
+    uint64_t _value = 0xcbf29ce484222325ULL;
+    uint64_t _size = 0;
+};
+
+// Output stream buffer, which hashes the serialized model on the fly instead of keeping it in memory
+class HashingStreamBuf final : public std::streambuf {
+public:
+    explicit HashingStreamBuf(StableHash& hash): _hash(hash) {
+    }
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            const auto c = traits_type::to_char_type(ch);
+            _hash.update(&c, 1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize count) override {
+        _hash.update(s, static_cast<size_t>(count));
+        return count;
+    }
+
+private:
+    StableHash& _hash;
+};
+
+std::string toHexString(uint64_t value) {
+    std::stringstream stream;
+    stream << std::hex << std::setfill('0') << std::setw(16) << value;
+    return stream.str();
+}
+
+}  // namespace
+
+//------------------------------------------------------------------------------
+//      CachedBlob
+//------------------------------------------------------------------------------
+CachedBlob::CachedBlob(char* data, size_t size): _data(data), _size(size) {
+    setg(_data, _data, _data + _size);
+}
+
+CachedBlob::~CachedBlob() {
+#ifndef _WIN32
+    munmap(_data, _size);
+#endif
+}
+
+CachedBlob::pos_type CachedBlob::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) {
+    if ((which & std::ios_base::in) == 0) {
+        return pos_type(off_type(-1));
+    }
+
+    off_type base = 0;
+    if (dir == std::ios_base::cur) {
+        base = gptr() - eback();
+    } else if (dir == std::ios_base::end) {
+        base = static_cast<off_type>(_size);
+    }
+
+    const auto pos = base + off;
+    if (pos < 0 || pos > static_cast<off_type>(_size)) {
+        return pos_type(off_type(-1));
+    }
+
+    setg(_data, _data + pos, _data + _size);
+    return pos_type(pos);
+}
+
+CachedBlob::pos_type CachedBlob::seekpos(pos_type pos, std::ios_base::openmode which) {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+//------------------------------------------------------------------------------
+//      CompiledBlobCache
+//------------------------------------------------------------------------------
+CompiledBlobCache::CompiledBlobCache(std::string cacheDir, uint64_t capacityBytes, Statistics& stats, Logger log)
+        : _cacheDir(std::move(cacheDir)), _capacityBytes(capacityBytes), _stats(stats), _logger(log) {
+#ifdef _WIN32
+    VPUX_THROW("Compiled blob cache is not supported on this platform");
+#else
+    if (mkdir(_cacheDir.c_str(), 0755) != 0 && errno != EEXIST) {
+        VPUX_THROW("Failed to create compiled blob cache directory '{0}' : {1}", _cacheDir, std::strerror(errno));
+    }
+#endif
+}
+
+std::string CompiledBlobCache::computeKey(const IE::CNNNetwork& network, const Config& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "CompiledBlobCache::computeKey");
+
+    StableHash modelHash;
+    {
+        HashingStreamBuf hashingBuf(modelHash);
+        std::ostream xmlStream(&hashingBuf);
+        std::ostream binStream(&hashingBuf);
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::Serialize>(xmlStream, binStream);
+        // Serialize pass doesn't modify the function, the cast is needed only to satisfy run_passes signature
+        manager.run_passes(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
+    }
+
+    StableHash keyHash;
+    keyHash.update(VPUX_PLUGIN_VERSION);
+    keyHash.update(toHexString(modelHash.value()));
+    keyHash.update(std::to_string(modelHash.size()));
+
+    for (const auto& input : network.getInputsInfo()) {
+        std::stringstream stream;
+        stream << input.first << ":" << input.second->getPrecision() << ":" << input.second->getLayout();
+        keyHash.update(stream.str());
+    }
+    for (const auto& output : network.getOutputsInfo()) {
+        std::stringstream stream;
+        stream << output.first << ":" << output.second->getPrecision() << ":" << output.second->getLayout();
+        keyHash.update(stream.str());
+    }
+
+    // Options below don't affect the compiled network
+    const SmallVector<StringRef> excludedKeys = {LOG_LEVEL::key(), LOG_ASYNC::key(), DEVICE_ID::key(),
+                                                 COMPILED_BLOB_CACHE_DIR::key(), COMPILED_BLOB_CACHE_SIZE_MB::key(),
+                                                 COMPILER_TELEMETRY_FILE::key()};
+    keyHash.update(config.toStableString(OptionMode::CompileTime, excludedKeys));
+
+    return toHexString(keyHash.value());
+}
+
+std::string CompiledBlobCache::getEntryPath(const std::string& key) const {
+    return _cacheDir + "/" + key + CACHE_ENTRY_EXTENSION.str();
+}
+
+#ifndef _WIN32
+
+CachedBlob::Ptr CompiledBlobCache::load(const std::string& key) {
+    OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "CompiledBlobCache::load");
+
+    const auto path = getEntryPath(key);
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        _logger.debug("Compiled blob cache miss for key '{0}'", key);
+        ++_stats.misses;
+        return nullptr;
+    }
+
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+        close(fd);
+        _logger.warning("Compiled blob cache entry '{0}' is broken, it will be recompiled", path);
+        ++_stats.misses;
+        return nullptr;
+    }
+
+    const auto size = static_cast<size_t>(fileStat.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file, so the descriptor isn't needed anymore
+    close(fd);
+    if (data == MAP_FAILED) {
+        _logger.warning("Failed to map compiled blob cache entry '{0}' : {1}", path, std::strerror(errno));
+        ++_stats.misses;
+        return nullptr;
+    }
+
+    // Modification time is used as the last access time for LRU eviction
+    utime(path.c_str(), nullptr);
+
+    _logger.debug("Compiled blob cache hit for key '{0}', {1} bytes", key, size);
+    ++_stats.hits;
+    _stats.bytes += size;
+    return std::make_shared<CachedBlob>(static_cast<char*>(data), size);
+}
+
+void CompiledBlobCache::store(const std::string& key, const BlobWriter& writer) {
+    OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "CompiledBlobCache::store");
+
+    const auto path = getEntryPath(key);
+
+    // Temporary file is unique per process and thread, so concurrent writers never share it,
+    // and rename() makes the complete entry visible to other processes at once
+    std::stringstream tmpPath;
+    tmpPath << _cacheDir << "/." << key << "." << getpid() << "." << std::this_thread::get_id() << ".tmp";
+
+    {
+        std::ofstream stream(tmpPath.str(), std::ios::binary);
+        if (!stream.is_open()) {
+            _logger.warning("Failed to create compiled blob cache entry '{0}'", tmpPath.str());
+            return;
+        }
+
+        writer(stream);
+
+        if (!stream.good()) {
+            stream.close();
+            std::remove(tmpPath.str().c_str());
+            _logger.warning("Failed to write compiled blob cache entry '{0}'", tmpPath.str());
+            return;
+        }
+    }
+
+    if (std::rename(tmpPath.str().c_str(), path.c_str()) != 0) {
+        std::remove(tmpPath.str().c_str());
+        _logger.warning("Failed to publish compiled blob cache entry '{0}' : {1}", path, std::strerror(errno));
+        return;
+    }
+
+    _logger.debug("Stored compiled blob cache entry '{0}'", path);
+    evict(path);
+}
+
+void CompiledBlobCache::evict(const std::string& keptEntry) {
+    struct Entry final {
+        std::string path;
+        uint64_t size;
+        time_t lastAccess;
+    };
+
+    DIR* dir = opendir(_cacheDir.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    while (const auto* dirEntry = readdir(dir)) {
+        const StringRef name = dirEntry->d_name;
+        if (name.startswith(".") || !name.endswith(CACHE_ENTRY_EXTENSION)) {
+            continue;
+        }
+
+        const auto path = _cacheDir + "/" + name.str();
+        struct stat fileStat = {};
+        if (stat(path.c_str(), &fileStat) != 0) {
+            continue;
+        }
+
+        entries.push_back({path, static_cast<uint64_t>(fileStat.st_size), fileStat.st_mtime});
+        totalSize += static_cast<uint64_t>(fileStat.st_size);
+    }
+    closedir(dir);
+
+    if (totalSize <= _capacityBytes) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return lhs.lastAccess < rhs.lastAccess;
+    });
+
+    for (const auto& entry : entries) {
+        if (totalSize <= _capacityBytes) {
+            break;
+        }
+        if (entry.path == keptEntry) {
+            continue;
+        }
+
+        // Processes, which already mapped the entry, keep using it after unlink
+        if (std::remove(entry.path.c_str()) == 0) {
+            _logger.debug("Evicted compiled blob cache entry '{0}', {1} bytes", entry.path, entry.size);
+            totalSize -= entry.size;
+        }
+    }
+}
+
+#else
+
+CachedBlob::Ptr CompiledBlobCache::load(const std::string&) {
+    VPUX_THROW("Compiled blob cache is not supported on this platform");
+}
+
+void CompiledBlobCache::store(const std::string&, const BlobWriter&) {
+    VPUX_THROW("Compiled blob cache is not supported on this platform");
+}
+
+void CompiledBlobCache::evict(const std::string&) {
+}
+
+#endif
+
+}  // namespace vpux
@@ -22,6 +22,7 @@
 #include "vpux_async_infer_request.h"
 #include "vpux_exceptions.h"
 #include "vpux_executable_network.h"
+#include "vpux_private_metrics.hpp"
 
 // Abstraction layer
 #include "vpux.hpp"
@@ -78,7 +79,8 @@ ExecutableNetwork::ExecutableNetwork(const Config& config, const Device::Ptr& de
           _device(device),
           _compiler(Compiler::create(config)),
           _supportedMetrics({METRIC_KEY(NETWORK_NAME), METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
-                             METRIC_KEY(SUPPORTED_CONFIG_KEYS), METRIC_KEY(SUPPORTED_METRICS)}) {
+                             METRIC_KEY(SUPPORTED_CONFIG_KEYS), METRIC_KEY(SUPPORTED_METRICS),
+                             VPUX_METRIC_KEY(PROFILING_STATISTICS), VPUX_METRIC_KEY(HOST_OVERHEAD_STATISTICS)}) {
 }
 //------------------------------------------------------------------------------
 //      Load network
@@ -280,7 +282,7 @@ std::uint32_t hash(const std::vector<char>& data) {
 }  // namespace
 
 void ExecutableNetwork::Export(std::ostream& model) {
-    auto graphBlob = _networkPtr->getCompiledNetwork();
+    const auto& graphBlob = _networkPtr->getCompiledNetwork();
     model.write(graphBlob.data(), graphBlob.size());
     std::stringstream str;
     str << "Blob hash: " << std::hex << hash(graphBlob);
@@ -322,6 +324,10 @@ IE::Parameter ExecutableNetwork::GetConfigValue(const std::string& name) const {
         return _config.get<PRINT_PROFILING>();
     } else if (name == ov::intel_vpux::profiling_output_file) {
         return _config.get<PROFILING_OUTPUT_FILE>();
+    } else if (name == ov::intel_vpux::collect_profiling_statistics) {
+        return _config.get<COLLECT_PROFILING_STATISTICS>();
+    } else if (name == ov::intel_vpux::collect_host_overhead_statistics) {
+        return _config.get<COLLECT_HOST_OVERHEAD_STATISTICS>();
     } else if (name == ov::intel_vpux::use_sipp) {
         return _config.get<USE_SIPP>();
     } else if (name == ov::intel_vpux::vpux_platform) {
@@ -369,6 +375,8 @@ IE::Parameter ExecutableNetwork::GetMetric(const std::string& name) const {
                     RO_property(ov::intel_vpux::preprocessing_shaves.name()),
                     RO_property(ov::intel_vpux::print_profiling.name()),
                     RO_property(ov::intel_vpux::profiling_output_file.name()),
+                    RO_property(ov::intel_vpux::collect_profiling_statistics.name()),
+                    RO_property(ov::intel_vpux::collect_host_overhead_statistics.name()),
                     RO_property(ov::intel_vpux::use_sipp.name()),
                     RO_property(ov::intel_vpux::vpux_platform.name()),
                     RO_property(ov::intel_vpux::use_elf_compiler_backend.name()),
@@ -401,6 +409,19 @@ IE::Parameter ExecutableNetwork::GetMetric(const std::string& name) const {
         // TODO implement retrieval the actual config keys collection
         std::vector<std::string> keys;
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, keys);
+    } else if (name == VPUX_METRIC_KEY(PROFILING_STATISTICS)) {
+        VPUX_THROW_WHEN(_executorPtr == nullptr, "GetMetric: executor is not initialized");
+        const auto statistics = _executorPtr->getParameter(name);
+        VPUX_THROW_WHEN(statistics.empty(), "GetMetric: profiling statistics are not supported by the backend");
+        IE_SET_METRIC_RETURN(VPUX_PROFILING_STATISTICS, statistics.as<std::string>());
+    } else if (name == VPUX_METRIC_KEY(HOST_OVERHEAD_STATISTICS)) {
+        VPUX_THROW_WHEN(_executorPtr == nullptr, "GetMetric: executor is not initialized");
+        const auto statistics = _executorPtr->getParameter(name);
+        VPUX_THROW_WHEN(statistics.empty(),
+                        "GetMetric: host overhead statistics are not supported by the backend or are not collected, "
+                        "the network must be loaded with {0} enabled",
+                        ov::intel_vpux::collect_host_overhead_statistics.name());
+        IE_SET_METRIC_RETURN(VPUX_HOST_OVERHEAD_STATISTICS, statistics.as<std::string>());
     }
 
     VPUX_THROW("Unsupported metric {0}", name);
@@ -105,6 +105,7 @@ Engine::Engine()
     OV_ITT_TASK_NEXT(ENGINE, "parseEnvVars");
     _globalConfig.parseEnvVars();
     Logger::global().setLevel(_globalConfig.get<LOG_LEVEL>());
+    Logger::setAsync(_globalConfig.get<LOG_ASYNC>());
 }
 
 //------------------------------------------------------------------------------
@@ -115,6 +116,9 @@ IE::IExecutableNetworkInternal::Ptr Engine::LoadExeNetwork(const IE::CNNNetwork&
                                                            const Config& networkConfig) {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "Engine::LoadExeNetwork");
     try {
+        if (!networkConfig.get<COMPILED_BLOB_CACHE_DIR>().empty()) {
+            return LoadCachedExeNetwork(network, device, networkConfig);
+        }
         return std::make_shared<ExecutableNetwork>(network, device, networkConfig);
     } catch (const std::exception& ex) {
         IE_THROW(Unexpected) << ex.what();
@@ -123,6 +127,49 @@ IE::IExecutableNetworkInternal::Ptr Engine::LoadExeNetwork(const IE::CNNNetwork&
     }
 }
 
+IE::IExecutableNetworkInternal::Ptr Engine::LoadCachedExeNetwork(const IE::CNNNetwork& network,
+                                                                 std::shared_ptr<Device>& device,
+                                                                 const Config& networkConfig) {
+    OV_ITT_TASK_CHAIN(LOAD_CACHED, itt::domains::VPUXPlugin, "Engine::LoadCachedExeNetwork", "computeKey");
+
+    // Cache failures must never break the network loading, the network is compiled as usual in that case
+    std::unique_ptr<CompiledBlobCache> cache;
+    std::string key;
+    try {
+        const auto capacity = static_cast<uint64_t>(networkConfig.get<COMPILED_BLOB_CACHE_SIZE_MB>()) * 1024 * 1024;
+        cache = std::make_unique<CompiledBlobCache>(networkConfig.get<COMPILED_BLOB_CACHE_DIR>(), capacity,
+                                                    _blobCacheStats, _logger.nest("CompiledBlobCache"));
+        key = CompiledBlobCache::computeKey(network, networkConfig);
+
+        OV_ITT_TASK_NEXT(LOAD_CACHED, "load");
+        if (const auto cachedBlob = cache->load(key)) {
+            OV_ITT_TASK_NEXT(LOAD_CACHED, "import");
+            std::istream blobStream(cachedBlob.get());
+            return std::make_shared<ExecutableNetwork>(blobStream, device, networkConfig);
+        }
+    } catch (const std::exception& ex) {
+        _logger.warning("Compiled blob cache lookup failed, the network will be compiled : {0}", ex.what());
+        cache.reset();
+    }
+
+    OV_ITT_TASK_NEXT(LOAD_CACHED, "compile");
+    const auto executableNetwork = std::make_shared<ExecutableNetwork>(network, device, networkConfig);
+
+    if (cache != nullptr) {
+        OV_ITT_TASK_NEXT(LOAD_CACHED, "store");
+        try {
+            cache->store(key, [&](std::ostream& stream) {
+                executableNetwork->Export(stream);
+            });
+        } catch (const std::exception& ex) {
+            _logger.warning("Failed to store the network in compiled blob cache : {0}", ex.what());
+        }
+    }
+
+    OV_ITT_TASK_SKIP(LOAD_CACHED);
+    return executableNetwork;
+}
+
 IE::IExecutableNetworkInternal::Ptr Engine::LoadExeNetworkImpl(const IE::CNNNetwork& network,
                                                                const std::map<std::string, std::string>& config) {
     auto localConfig = mergeConfigs(_globalConfig, config);
@@ -202,6 +249,7 @@ IE::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istream& networkM
 void Engine::SetConfig(const std::map<std::string, std::string>& config) {
     _globalConfig.update(config);
     Logger::global().setLevel(_globalConfig.get<LOG_LEVEL>());
+    Logger::setAsync(_globalConfig.get<LOG_ASYNC>());
 
     if (_backends != nullptr) {
         _backends->setup(_globalConfig);
@@ -287,6 +335,10 @@ IE::Parameter Engine::GetConfig(const std::string& name,
             return _globalConfig.get<PRINT_PROFILING>();
         } else if (name == ov::intel_vpux::profiling_output_file) {
             return _globalConfig.get<PROFILING_OUTPUT_FILE>();
+        } else if (name == ov::intel_vpux::collect_profiling_statistics) {
+            return _globalConfig.get<COLLECT_PROFILING_STATISTICS>();
+        } else if (name == ov::intel_vpux::collect_host_overhead_statistics) {
+            return _globalConfig.get<COLLECT_HOST_OVERHEAD_STATISTICS>();
         } else if (name == ov::intel_vpux::use_sipp) {
             return _globalConfig.get<USE_SIPP>();
         } else if (name == ov::intel_vpux::vpux_platform) {
@@ -376,6 +428,8 @@ IE::Parameter Engine::GetMetric(const std::string& name, const std::map<std::str
                     RW_property(ov::intel_vpux::preprocessing_shaves.name()),                    //
                     RW_property(ov::intel_vpux::print_profiling.name()),                         //
                     RW_property(ov::intel_vpux::profiling_output_file.name()),                   //
+                    RW_property(ov::intel_vpux::collect_profiling_statistics.name()),            //
+                    RW_property(ov::intel_vpux::collect_host_overhead_statistics.name()),        //
                     RW_property(ov::intel_vpux::use_sipp.name()),                                //
                     RW_property(ov::intel_vpux::vpux_platform.name()),                           //
                     RW_property(ov::intel_vpux::use_elf_compiler_backend.name()),                //
@@ -434,6 +488,12 @@ IE::Parameter Engine::GetMetric(const std::string& name, const std::map<std::str
         IE_SET_METRIC_RETURN(DEVICE_ARCHITECTURE, _metrics->GetDeviceArchitecture(specifiedDeviceName));
     } else if (name == VPUX_METRIC_KEY(BACKEND_NAME)) {
         IE_SET_METRIC_RETURN(VPUX_BACKEND_NAME, _metrics->GetBackendName());
+    } else if (name == VPUX_METRIC_KEY(COMPILED_BLOB_CACHE_HITS)) {
+        IE_SET_METRIC_RETURN(VPUX_COMPILED_BLOB_CACHE_HITS, _blobCacheStats.hits.load());
+    } else if (name == VPUX_METRIC_KEY(COMPILED_BLOB_CACHE_MISSES)) {
+        IE_SET_METRIC_RETURN(VPUX_COMPILED_BLOB_CACHE_MISSES, _blobCacheStats.misses.load());
+    } else if (name == VPUX_METRIC_KEY(COMPILED_BLOB_CACHE_BYTES)) {
+        IE_SET_METRIC_RETURN(VPUX_COMPILED_BLOB_CACHE_BYTES, _blobCacheStats.bytes.load());
     }
 
     VPUX_THROW("Unsupported metric {0}", name);
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "vpux/utils/core/array_ref.hpp"
 #include "vpux/utils/core/enums.hpp"
 #include "vpux/utils/core/error.hpp"
 #include "vpux/utils/core/func_ref.hpp"
@@ -339,6 +340,9 @@ public:
 
     std::string toString() const;
 
+    // Prints the options applicable to `mode` in key order, so the result does not depend on the update history.
+    std::string toStableString(OptionMode mode, ArrayRef<StringRef> excludedKeys = {}) const;
+
 private:
     std::shared_ptr<const OptionsDesc> _desc;
     ImplMap _impl;
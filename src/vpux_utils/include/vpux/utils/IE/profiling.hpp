@@ -13,7 +13,7 @@
 namespace vpux {
 namespace profiling {
 
-enum class OutputType { NONE, TEXT, JSON, DEBUG };
+enum class OutputType { NONE, TEXT, JSON, TRACE, DEBUG };
 
 // This function decodes profiling buffer into readable format.
 // Format can be either regular text or TraceEvent json.
@@ -25,6 +25,13 @@ void outputWriter(const OutputType profilingType, const std::pair<const uint8_t*
 void printProfilingAsTraceEvent(const std::vector<TaskInfo>& taskProfiling,
                                 const std::vector<LayerInfo>& layerProfiling, std::ostream& out_stream);
 
+// Detailed TraceEvent json: a track per DMA port, DPU cluster and ACT SHAVE, barrier dependencies are shown as flows.
+// schedule must be decoded together with taskProfiling, see ProfilingIndex::decode. The events are written
+// as they are produced, but the decoded tasks are held in memory as a whole.
+void printProfilingAsChromeTrace(const std::vector<TaskInfo>& taskProfiling,
+                                 const std::vector<TaskScheduleInfo>& schedule,
+                                 const std::vector<LayerInfo>& layerProfiling, std::ostream& out_stream);
+
 void printProfilingAsText(const std::vector<TaskInfo>& taskProfiling, const std::vector<LayerInfo>& layerProfiling,
                           std::ostream& out_stream);
 
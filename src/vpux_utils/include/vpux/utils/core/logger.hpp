@@ -92,6 +92,19 @@ public:
 
     bool isActive(LogLevel msgLevel) const;
 
+public:
+    // The synchronous backend (default) prints each message on the calling thread under a global lock.
+    // The asynchronous backend puts the formatted messages into bounded per-thread lock-free queues,
+    // which are printed by a background thread. The messages are dropped if the queue of the thread is full.
+    // The initial backend is selected by the IE_VPUX_LOG_ASYNC environment variable.
+    static void setAsync(bool enable);
+    static bool isAsync();
+
+    // Waits until all messages, enqueued by the asynchronous backend, are printed
+    static void flush();
+
+    static uint64_t getNumDroppedEntries();
+
 public:
     static llvm::raw_ostream& getBaseStream();
     static llvm::WithColor getLevelStream(LogLevel msgLevel);
@@ -0,0 +1,25 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+// Process memory usage queries.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace vpux {
+
+struct MemoryUsage final {
+    uint64_t rss = 0;       // Current resident set size in bytes
+    uint64_t peakRss = 0;   // Peak resident set size in bytes since the process start
+    uint64_t heapSize = 0;  // Bytes allocated by malloc, 0 if it is not supported on the host
+};
+
+// Fields which are not supported on the host platform are set to 0
+MemoryUsage getProcessMemoryUsage();
+
+}  // namespace vpux
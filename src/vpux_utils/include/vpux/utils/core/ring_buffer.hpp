@@ -9,7 +9,9 @@
 
 #include "vpux/utils/core/small_vector.hpp"
 
+#include <atomic>
 #include <cassert>
+#include <vector>
 
 namespace vpux {
 
@@ -89,4 +91,75 @@ private:
     size_t _size = 0;
 };
 
+//
+// SpscRingBuffer
+//
+
+// Bounded lock-free queue for exactly one producer thread and one consumer thread.
+// The producer and the consumer indices are kept on separate cache lines to avoid false sharing.
+
+template <typename T>
+class SpscRingBuffer final {
+public:
+    // One slot is always kept empty to distinguish full and empty states
+    explicit SpscRingBuffer(size_t capacity): _storage(capacity + 1) {
+    }
+
+public:
+    // Producer side, returns false if the buffer is full
+    template <typename T1>
+    bool tryPush(T1&& val) {
+        const auto putInd = _put.value.load(std::memory_order_relaxed);
+        const auto nextInd = increment(putInd);
+
+        if (nextInd == _get.value.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        _storage[putInd] = std::forward<T1>(val);
+        _put.value.store(nextInd, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, returns false if the buffer is empty
+    bool tryPop(T& val) {
+        const auto getInd = _get.value.load(std::memory_order_relaxed);
+
+        if (getInd == _put.value.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        val = std::move(_storage[getInd]);
+        _get.value.store(increment(getInd), std::memory_order_release);
+        return true;
+    }
+
+public:
+    bool empty() const {
+        return _get.value.load(std::memory_order_acquire) == _put.value.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const {
+        return _storage.size() - 1;
+    }
+
+private:
+    size_t increment(size_t ind) const {
+        return ind + 1 < _storage.size() ? ind + 1 : 0;
+    }
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    struct PaddedIndex final {
+        std::atomic<size_t> value{0};
+        char padding[CACHE_LINE_SIZE - sizeof(std::atomic<size_t>)];
+    };
+
+private:
+    std::vector<T> _storage;
+    PaddedIndex _put;
+    PaddedIndex _get;
+};
+
 }  // namespace vpux
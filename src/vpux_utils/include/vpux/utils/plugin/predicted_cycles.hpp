@@ -0,0 +1,114 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/utils/plugin/profiling_parser.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace vpux {
+namespace profiling {
+
+//
+// Predicted cycles segment
+//
+// Compile-time cost model estimates of the tasks, appended to the graph-schema blob as a trailing segment.
+// The tasks are identified by the same names, which are reported by the profiling parser, so the estimates
+// can be joined with the measured durations without any changes in the profiling metadata of the blob.
+//
+// Layout:
+//   [entry 0][entry 1]...[padding][footer]
+// Entry:
+//   uint64_t cycles, uint32_t execType, uint32_t nameSize, uint32_t opTypeSize, name, opType
+//
+// The segment may be followed by the weights segment, so it is padded up to the requested alignment.
+//
+
+struct PredictedCyclesFooter final {
+    char magic[8];
+    uint32_t version;
+    uint32_t numEntries;
+    double frequencyMHz;
+    uint64_t segmentSize;
+};
+
+static_assert(sizeof(PredictedCyclesFooter) == 32, "PredictedCyclesFooter must not contain padding");
+
+constexpr char PREDICTED_CYCLES_MAGIC[] = "VPUXPCYC";
+constexpr uint32_t PREDICTED_CYCLES_VERSION = 1;
+
+struct PredictedTaskCycles {
+    std::string name;
+    std::string opType;
+    TaskInfo::ExecType execType{TaskInfo::ExecType::NONE};
+    uint64_t cycles{};
+};
+
+struct PredictedCycles {
+    double frequencyMHz{};  ///< Frequency of the cost model cycles
+    std::vector<PredictedTaskCycles> tasks;
+};
+
+std::vector<char> serializePredictedCycles(const PredictedCycles& predicted, uint32_t alignment = 1);
+
+/**
+ * @brief Find the predicted cycles segment among the trailing segments of the graph-schema blob.
+ * @return false if the blob doesn't contain the segment
+ */
+bool findPredictedCycles(const uint8_t* blobData, size_t blobSize, PredictedCycles& predicted);
+
+//
+// Predicted vs measured correlation
+//
+
+struct CycleCorrelationEntry {
+    std::string name;
+    std::string opType;
+    TaskInfo::ExecType execType{TaskInfo::ExecType::NONE};
+    uint64_t predictedNs{};
+    uint64_t measuredNs{};
+
+    // (predicted - measured) / measured, positive when the cost model overestimates the task
+    double relativeError() const;
+};
+
+struct CycleCorrelationStatistics {
+    std::string opType;
+    TaskInfo::ExecType execType{TaskInfo::ExecType::NONE};
+    size_t count{};
+    uint64_t predictedNs{};
+    uint64_t measuredNs{};
+    double medianError{};   ///< Signed relative error
+    double meanAbsError{};  ///< Relative
+    double p90AbsError{};   ///< Relative
+};
+
+struct CycleCorrelationReport {
+    std::vector<CycleCorrelationEntry> entries;       ///< Sorted by absolute error in time, the worst first
+    std::vector<CycleCorrelationStatistics> opTypes;  ///< Sorted by measured time, the most expensive first
+    size_t numUnmatchedPredicted{};
+    size_t numUnmatchedMeasured{};
+};
+
+/**
+ * @brief Join the predicted cycles with the measured tasks by task name and execution engine.
+ * Several tasks with the same name and engine are summed on both sides. measured are expected to be
+ * decoded with the lowest verbosity, so the cluster and variant level tasks aren't present.
+ */
+CycleCorrelationReport correlatePredictedCycles(const PredictedCycles& predicted,
+                                                const std::vector<TaskInfo>& measured);
+
+void printCycleCorrelationAsText(const CycleCorrelationReport& report, size_t numWorst, std::ostream& outStream);
+
+void printCycleCorrelationAsJson(const CycleCorrelationReport& report, size_t numWorst, std::ostream& outStream);
+
+}  // namespace profiling
+}  // namespace vpux
@@ -0,0 +1,223 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/utils/plugin/profiling_parser.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vpux {
+namespace profiling {
+
+/**
+ * @class DurationHistogram
+ * @brief Fixed-memory log-linear histogram of durations in nanoseconds (HDR-style).
+ * Each power-of-two range of values is split into SUB_BUCKET_COUNT linear sub-buckets, so the relative
+ * error of the reported percentiles is bounded by 1 / SUB_BUCKET_COUNT regardless of the value magnitude.
+ * Minimum, maximum and sum are tracked exactly. The buckets are allocated up to the largest recorded value,
+ * so the memory never exceeds BUCKET_COUNT counters.
+ */
+class DurationHistogram final {
+public:
+    static constexpr uint32_t SUB_BUCKET_BITS = 6;
+    static constexpr uint64_t SUB_BUCKET_COUNT = 1ull << SUB_BUCKET_BITS;
+    // Larger values are clamped, it is about 18 minutes for nanoseconds
+    static constexpr uint32_t MAX_VALUE_BITS = 40;
+    static constexpr uint64_t MAX_VALUE = (1ull << MAX_VALUE_BITS) - 1;
+    static constexpr size_t BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+public:
+    void record(uint64_t value);
+    void merge(const DurationHistogram& other);
+    void reset();
+
+    uint64_t count() const {
+        return _count;
+    }
+
+    uint64_t min() const {
+        return _count != 0 ? _min : 0;
+    }
+
+    uint64_t max() const {
+        return _max;
+    }
+
+    double mean() const {
+        return _count != 0 ? static_cast<double>(_sum) / static_cast<double>(_count) : 0.0;
+    }
+
+    // Returns the highest value, equivalent to the value at the given percentile in range [0, 100]
+    uint64_t percentile(double percent) const;
+
+private:
+    static size_t getBucketIndex(uint64_t value);
+    static uint64_t getBucketUpperBound(size_t index);
+
+private:
+    std::vector<uint64_t> _buckets;
+    uint64_t _count = 0;
+    uint64_t _min = 0;
+    uint64_t _max = 0;
+    uint64_t _sum = 0;
+};
+
+struct DurationStatistics {
+    uint64_t count{};
+    uint64_t min_ns{};
+    uint64_t p50_ns{};
+    uint64_t p90_ns{};
+    uint64_t p99_ns{};
+    uint64_t max_ns{};
+    double mean_ns{};
+};
+
+DurationStatistics getDurationStatistics(const DurationHistogram& histogram);
+
+struct AggregatedEntry {
+    std::string name;
+    std::string layer_type;
+    TaskInfo::ExecType exec_type{TaskInfo::ExecType::NONE};  ///< NONE for layers
+    DurationStatistics duration;
+};
+
+struct AggregatedProfilingInfo {
+    uint64_t num_inferences{};
+    DurationStatistics inference;  ///< From the first task start until the last task finish
+
+    // Fraction of the inference time, when at least one task of the engine was running
+    double dpu_utilization{};
+    double sw_utilization{};
+    double dma_utilization{};
+
+    std::vector<AggregatedEntry> layers;  ///< In order of the first appearance
+    std::vector<AggregatedEntry> tasks;   ///< In order of the first appearance
+};
+
+/**
+ * @class ProfilingAggregator
+ * @brief Accumulates per-task and per-layer durations over many inferences of the same network.
+ * The memory is bounded by the number of distinct tasks and layers, it doesn't grow with the number
+ * of inferences. All methods are thread-safe, so a single aggregator may be fed by several infer requests.
+ */
+class ProfilingAggregator final {
+public:
+    void addInference(const std::vector<TaskInfo>& tasks, const std::vector<LayerInfo>& layers);
+    void reset();
+
+    uint64_t getNumInferences() const;
+    AggregatedProfilingInfo getAggregatedInfo() const;
+
+private:
+    struct Entry final {
+        std::string name;
+        std::string layerType;
+        TaskInfo::ExecType execType;
+        DurationHistogram histogram;
+    };
+
+    using EntryMap = std::unordered_map<std::string, size_t>;
+
+    static Entry& getEntry(std::vector<Entry>& entries, EntryMap& index, const char* name, const char* layerType,
+                           TaskInfo::ExecType execType);
+
+private:
+    mutable std::mutex _mutex;
+
+    uint64_t _numInferences = 0;
+    DurationHistogram _inferenceHistogram;
+
+    uint64_t _totalInferenceNs = 0;
+    uint64_t _dpuBusyNs = 0;
+    uint64_t _swBusyNs = 0;
+    uint64_t _dmaBusyNs = 0;
+
+    std::vector<Entry> _layers;
+    EntryMap _layersIndex;
+    std::vector<Entry> _tasks;
+    EntryMap _tasksIndex;
+};
+
+void printAggregatedProfilingAsText(const AggregatedProfilingInfo& info, std::ostream& outStream);
+
+void printAggregatedProfilingAsJson(const AggregatedProfilingInfo& info, std::ostream& outStream);
+
+//
+// Host overhead
+//
+
+// Host-side stages of the inference. Push and Pull cover the whole executor calls including Repack,
+// Repack is recorded once per push or pull call, which converted at least one blob to the other layout or precision.
+enum class HostOverheadStage : size_t { Preprocessing, Repack, Push, Pull, COUNT };
+
+const char* stringifyHostOverheadStage(HostOverheadStage stage);
+
+struct AggregatedHostOverhead {
+    std::array<DurationStatistics, static_cast<size_t>(HostOverheadStage::COUNT)> stages;
+};
+
+/**
+ * @class HostOverheadAggregator
+ * @brief Accumulates durations of the host-side inference stages over all infer requests of the network.
+ * All methods are thread-safe.
+ */
+class HostOverheadAggregator final {
+public:
+    void record(HostOverheadStage stage, uint64_t durationNs);
+    void reset();
+
+    AggregatedHostOverhead getAggregatedInfo() const;
+
+private:
+    mutable std::mutex _mutex;
+    std::array<DurationHistogram, static_cast<size_t>(HostOverheadStage::COUNT)> _stages;
+};
+
+/**
+ * @class HostOverheadScope
+ * @brief Records the duration of the enclosing scope as the host stage. Does nothing for nullptr aggregator,
+ * so the backends which don't collect the host overhead aren't affected.
+ */
+class HostOverheadScope final {
+public:
+    HostOverheadScope(HostOverheadAggregator* aggregator, HostOverheadStage stage)
+            : _aggregator(aggregator), _stage(stage) {
+        if (_aggregator != nullptr) {
+            _start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~HostOverheadScope() {
+        if (_aggregator != nullptr) {
+            const auto duration = std::chrono::steady_clock::now() - _start;
+            _aggregator->record(_stage, std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+        }
+    }
+
+    HostOverheadScope(const HostOverheadScope&) = delete;
+    HostOverheadScope& operator=(const HostOverheadScope&) = delete;
+
+private:
+    HostOverheadAggregator* _aggregator;
+    HostOverheadStage _stage;
+    std::chrono::steady_clock::time_point _start;
+};
+
+void printHostOverheadAsText(const AggregatedHostOverhead& info, std::ostream& outStream);
+
+void printHostOverheadAsJson(const AggregatedHostOverhead& info, std::ostream& outStream);
+
+}  // namespace profiling
+}  // namespace vpux
@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include <cstdint>
 #include <iomanip>
 #include <ostream>
 #include <string>
+#include <vector>
 
 namespace vpux {
 namespace profiling {
@@ -35,5 +37,43 @@ static inline std::ostream& operator<<(std::ostream& os, const struct TracingEve
     return os;
 }
 
+// Streaming writer of the Trace Event Format, understood by chrome://tracing and Perfetto UI.
+// Events are written to the stream immediately, only the track names are kept until finish(),
+// so the memory doesn't depend on the number of events.
+class TraceEventWriter final {
+public:
+    TraceEventWriter(std::ostream& outStream, int pid, std::string processName);
+
+    TraceEventWriter(const TraceEventWriter&) = delete;
+    TraceEventWriter& operator=(const TraceEventWriter&) = delete;
+
+    // Tracks are displayed in the order of registration, the returned value is the tid of the track
+    int addTrack(std::string name);
+
+    // "X" event - slice of the given track, nested slices are displayed one under another
+    void writeComplete(const std::string& name, const std::string& category, int tid, uint64_t startNs,
+                       uint64_t durationNs);
+
+    // "s" and "f" events - arrow from the slice enclosing srcNs on srcTid to the slice starting at dstNs on dstTid
+    void writeFlow(const std::string& name, const std::string& category, uint64_t id, int srcTid, uint64_t srcNs,
+                   int dstTid, uint64_t dstNs);
+
+    // Writes the tracks metadata and closes the JSON, must be called once after all events
+    void finish();
+
+private:
+    void writeEventPrefix(const std::string& name, const std::string& category, const char* phase, int tid,
+                          uint64_t timestampNs);
+
+private:
+    std::ostream& _outStream;
+    int _pid;
+    std::string _processName;
+    std::vector<std::string> _trackNames;
+    bool _finished = false;
+};
+
+std::string escapeJsonString(const std::string& str);
+
 }  // namespace profiling
 }  // namespace vpux
@@ -90,6 +90,18 @@ struct TaskInfo {
     uint32_t parent_layer_id{};  ///< Not used
 };
 
+/**
+ * @struct TaskScheduleInfo
+ * @brief Scheduling details of the task, which are not a part of TaskInfo.
+ * Describes the TaskInfo with the same index in the decoded tasks list. Barriers are provided for
+ * the tasks of the lowest verbosity only, cluster and variant level tasks inherit them from the parent.
+ */
+struct TaskScheduleInfo {
+    std::vector<uint32_t> wait_barriers;
+    std::vector<uint32_t> update_barriers;
+    uint32_t dma_port{};  ///< DMA engine port, DMA tasks only
+};
+
 enum class RecordType { DMA20, DMA27, DPU_SW, DPU_HWP27, SW_UPA, SW_ACT, NONE };
 
 struct ActShaveData_t {
@@ -225,22 +237,6 @@ protected:
               _updateBarriers(uBarriers) {
     }
 
-    RawProfilingRecord(RecordType recordType, ExecutorType executorType, const std::string& cleanName,
-                       const MVCNN::Task* task)
-            : _recordType(recordType), _executorType(executorType), _name(cleanName) {
-        VPUX_THROW_WHEN(task == nullptr, "Task must be non-nullptr value");
-        VPUX_THROW_WHEN(task->name() == nullptr, "Task name must be non-nullptr value");
-        VPUX_THROW_WHEN(task->associated_barriers() == nullptr, "Task should have associated barriers");
-
-        auto barriers = task->associated_barriers();
-        if (auto wBarriers = barriers->wait_barriers()) {
-            _waitBarriers = BarriersSet(wBarriers->cbegin(), wBarriers->cend());
-        }
-        if (auto uBarriers = barriers->update_barriers()) {
-            _updateBarriers = BarriersSet(uBarriers->cbegin(), uBarriers->cend());
-        }
-    }
-
 public:
     bool isDirectPredecessor(const RawProfilingRecord& other) const {
         return !isSetIntersectionEmpty(_updateBarriers, other._waitBarriers);
@@ -422,9 +418,9 @@ protected:
 
 class RawProfilingDPURecord : public RawProfilingRecord, public ClusteredAndTiledMixin, public ThrowableAssertMixin {
 protected:
-    explicit RawProfilingDPURecord(const std::string& name, RecordType recordType, const MVCNN::Task* task,
-                                   size_t clusterId, size_t variantId)
-            : RawProfilingRecord(recordType, ExecutorType::DPU, name, task),
+    explicit RawProfilingDPURecord(const std::string& name, RecordType recordType, const BarriersSet& waitBarriers,
+                                   const BarriersSet& updateBarriers, size_t clusterId, size_t variantId)
+            : RawProfilingRecord(name, recordType, ExecutorType::DPU, waitBarriers, updateBarriers),
               ClusteredAndTiledMixin(clusterId, variantId) {
     }
 
@@ -451,9 +447,10 @@ public:
 
 class RawProfilingDPUSWRecord : public RawProfilingDPURecord {
 public:
-    explicit RawProfilingDPUSWRecord(SwDpuData_t timestamps, const std::string& name, const MVCNN::Task* task,
-                                     size_t clusterId, size_t variantId)
-            : RawProfilingDPURecord(name, RecordType::DPU_SW, task, clusterId, variantId), _timestamps(timestamps) {
+    explicit RawProfilingDPUSWRecord(SwDpuData_t timestamps, const std::string& name, const BarriersSet& waitBarriers,
+                                     const BarriersSet& updateBarriers, size_t clusterId, size_t variantId)
+            : RawProfilingDPURecord(name, RecordType::DPU_SW, waitBarriers, updateBarriers, clusterId, variantId),
+              _timestamps(timestamps) {
     }
 
     void checkDataOrDie() const override {
@@ -475,9 +472,11 @@ private:
 
 class RawProfilingDPUHW27Record : public RawProfilingDPURecord {
 public:
-    explicit RawProfilingDPUHW27Record(HwpDpuMode0Data_t timestamps, const std::string& name, const MVCNN::Task* task,
+    explicit RawProfilingDPUHW27Record(HwpDpuMode0Data_t timestamps, const std::string& name,
+                                       const BarriersSet& waitBarriers, const BarriersSet& updateBarriers,
                                        size_t clusterId, size_t variantId)
-            : RawProfilingDPURecord(name, RecordType::DPU_HWP27, task, clusterId, variantId), _timestamps(timestamps) {
+            : RawProfilingDPURecord(name, RecordType::DPU_HWP27, waitBarriers, updateBarriers, clusterId, variantId),
+              _timestamps(timestamps) {
     }
 
     void checkDataOrDie() const override {
@@ -505,9 +504,9 @@ private:
 
 class RawProfilingUPARecord : public RawProfilingRecord, public ThrowableAssertMixin {
 public:
-    explicit RawProfilingUPARecord(UpaData_t data, const std::string& name, const MVCNN::Task* task,
-                                   const std::string& layerType)
-            : RawProfilingRecord(RecordType::SW_UPA, ExecutorType::UPA, name, task),
+    explicit RawProfilingUPARecord(UpaData_t data, const std::string& name, const BarriersSet& waitBarriers,
+                                   const BarriersSet& updateBarriers, const std::string& layerType)
+            : RawProfilingRecord(name, RecordType::SW_UPA, ExecutorType::UPA, waitBarriers, updateBarriers),
               _data(data),
               _layerType(layerType) {
     }
@@ -543,9 +542,9 @@ private:
 
 class RawProfilingACTRecord : public RawProfilingRecord, public ClusteredAndTiledMixin, public ThrowableAssertMixin {
 public:
-    explicit RawProfilingACTRecord(ActShaveData_t data, const std::string& name, const MVCNN::Task* task,
-                                   size_t clusterId, size_t variantId)
-            : RawProfilingRecord(RecordType::SW_ACT, ExecutorType::ACTSHAVE, name, task),
+    explicit RawProfilingACTRecord(ActShaveData_t data, const std::string& name, const BarriersSet& waitBarriers,
+                                   const BarriersSet& updateBarriers, size_t clusterId, size_t variantId)
+            : RawProfilingRecord(name, RecordType::SW_ACT, ExecutorType::ACTSHAVE, waitBarriers, updateBarriers),
               ClusteredAndTiledMixin(clusterId, variantId),
               _data(data) {
     }
@@ -627,6 +626,47 @@ private:
     size_t _clusterId;
 };
 
+/**
+ * @class ProfilingIndex
+ * @brief Blob metadata required to decode the raw profiling output.
+ * Task lists of the blob are walked once: profiling task names are parsed, raw records are laid out
+ * in the profiling buffer, grouped into clusters/tasks and barrier synchronization points are found.
+ * Decoding of a profiling buffer is a linear pass over the raw records after that, so the index is
+ * expected to be built once per network and reused for every inference. The index doesn't reference
+ * the blob memory after construction and may be used from several threads at once.
+ */
+class ProfilingIndex final {
+public:
+    using Ptr = std::shared_ptr<const ProfilingIndex>;
+
+public:
+    ProfilingIndex(const uint8_t* blobData, size_t blobSize);
+    ~ProfilingIndex();
+
+    ProfilingIndex(const ProfilingIndex&) = delete;
+    ProfilingIndex& operator=(const ProfilingIndex&) = delete;
+
+    /**
+     * @brief Decode raw profiling output to get per-tasks info.
+     * @param schedule optional output for the scheduling details of the decoded tasks
+     * @see getTaskInfo
+     */
+    std::vector<TaskInfo> decode(const uint8_t* profData, size_t profSize, TaskType type, VerbosityLevel verbosity,
+                                 bool fpga = false, std::vector<TaskScheduleInfo>* schedule = nullptr) const;
+
+    /**
+     * @brief Size of the raw profiling output of a single inference, expected by decode.
+     */
+    size_t getProfilingBufferSize() const;
+
+public:
+    // Defined in the parser implementation
+    struct Layout;
+
+private:
+    std::unique_ptr<const Layout> _layout;
+};
+
 /**
  * @fn getTaskInfo
  * @brief Parse raw profiling output to get per-tasks info.
@@ -673,6 +713,18 @@ SummaryInfo getSummary(const uint8_t* blobData, size_t profSize);
 std::vector<LayerInfo> getLayerInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
                                     bool fpga = false);
 
+/**
+ * @fn getLayerInfo
+ * @brief Parse raw profiling output to get per-layer info. Reuses blob metadata collected by the index.
+ * @param index metadata of the blob, which produced the profiling output
+ * @param profData pointer to the buffer with raw profiling data
+ * @param profSize raw profiling data size
+ * @param fpga whether buffer was obtained from FPGA
+ * @return std::vector of LayerInfo structures
+ */
+std::vector<LayerInfo> getLayerInfo(const ProfilingIndex& index, const uint8_t* profData, size_t profSize,
+                                    bool fpga = false);
+
 /**
  * @fn getLayerInfo
  * @brief Parse raw profiling output to get per-layer info. Reuses precomputed info about tasks.
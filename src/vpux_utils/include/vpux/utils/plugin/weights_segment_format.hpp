@@ -0,0 +1,60 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace vpux {
+
+//
+// Weights segment format
+//
+// Append-only container for the constant content, which is stored out of the graph-schema blob.
+// The segment is either appended to the blob (trailing section) or written into a sidecar file.
+// BinaryData entries of the blob keep only the content length, the content itself is referenced
+// by the entry with the same index in the segment offset table.
+//
+// Layout:
+//   [entry 0][padding][entry 1][padding]...[offset table][footer]
+//
+// All offsets are counted from the segment start and are 64-bit, so the segment isn't bounded
+// by the 2 GB limit of the flatbuffers. The entries are aligned relative to the segment start,
+// so the trailing segment should be placed at the aligned offset inside the blob.
+//
+// The format is shared by the compiler, which writes the segment, and the tools, which skip it
+// to find the other trailing segments of the blob.
+//
+// The segment is produced and read back by vpux-translate only. The plugin compiles the networks into ELF
+// and the runtime takes the constant content from the BinaryData entries, so VPUIP::NetworkDescription
+// rejects the blobs with the out-of-line constants.
+//
+
+struct WeightsSegmentTableEntry final {
+    uint64_t offset;
+    uint64_t size;
+};
+
+struct WeightsSegmentFooter final {
+    char magic[8];
+    uint32_t version;
+    uint32_t alignment;
+    uint64_t numEntries;
+    uint64_t tableOffset;
+    uint64_t segmentSize;
+};
+
+static_assert(sizeof(WeightsSegmentTableEntry) == 16, "WeightsSegmentTableEntry must not contain padding");
+static_assert(sizeof(WeightsSegmentFooter) == 40, "WeightsSegmentFooter must not contain padding");
+
+constexpr char WEIGHTS_SEGMENT_MAGIC[] = "VPUXWSEG";
+constexpr uint32_t WEIGHTS_SEGMENT_VERSION = 1;
+
+static_assert(sizeof(WEIGHTS_SEGMENT_MAGIC) - 1 == sizeof(WeightsSegmentFooter::magic),
+              "WEIGHTS_SEGMENT_MAGIC must fill the magic of the footer");
+
+}  // namespace vpux
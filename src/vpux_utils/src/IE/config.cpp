@@ -13,6 +13,8 @@
 #include <ie_common.h>
 #include <ie_plugin_config.hpp>
 
+#include <map>
+
 using namespace vpux;
 
 //
@@ -211,6 +213,33 @@ std::string vpux::Config::toString() const {
     return resultStream.str();
 }
 
+std::string vpux::Config::toStableString(OptionMode mode, ArrayRef<StringRef> excludedKeys) const {
+    std::map<std::string, std::string> sortedOptions;
+    for (const auto& p : _impl) {
+        if (llvm::is_contained(excludedKeys, p.first)) {
+            continue;
+        }
+
+        const auto optMode = _desc->get(p.first, OptionMode::Both).mode();
+        if ((mode == OptionMode::CompileTime && optMode == OptionMode::RunTime) ||
+            (mode == OptionMode::RunTime && optMode == OptionMode::CompileTime)) {
+            continue;
+        }
+
+        sortedOptions.emplace(p.first.str(), p.second->toString());
+    }
+
+    std::stringstream resultStream;
+    for (auto it = sortedOptions.cbegin(); it != sortedOptions.cend(); ++it) {
+        resultStream << it->first << "=\"" << it->second << "\"";
+        if (std::next(it) != sortedOptions.cend()) {
+            resultStream << " ";
+        }
+    }
+
+    return resultStream.str();
+}
+
 //
 // envVarStrToBool
 //
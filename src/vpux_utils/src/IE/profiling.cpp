@@ -8,6 +8,7 @@
 #include "vpux/utils/IE/profiling.hpp"
 #include "vpux/utils/IE/prefix.hpp"
 
+#include "vpux/utils/core/error.hpp"
 #include "vpux/utils/plugin/profiling_json.hpp"
 
 #include <cstring>
@@ -16,6 +17,8 @@
 #include <iostream>
 #include <map>
 #include <set>
+#include <tuple>
+#include <unordered_map>
 
 using namespace vpux;
 using namespace vpux::profiling;
@@ -104,6 +107,70 @@ bool isTileLevelProfilingTask(const TaskInfo& task) {
     return isSwTask(task) && hasTileInName == true;
 }
 
+std::string getTileFromName(const std::string& name) {
+    return name.substr(name.rfind(TILE_LEVEL_PROFILING_SUFFIX) + TILE_LEVEL_PROFILING_SUFFIX.size());
+}
+
+//
+// Chrome trace tracks
+//
+
+enum TraceTrackGroup { DMA_PORT_TRACK, DPU_TRACK, DPU_CLUSTER_TRACK, SW_TRACK, SW_CLUSTER_TRACK, LAYER_TRACK };
+
+constexpr int NO_TRACK_UNIT = -1;
+
+// Group, cluster or DMA port and SHAVE, tracks are sorted by this key
+using TraceTrackKey = std::tuple<int, int, int>;
+
+TraceTrackKey getTraceTrackKey(const TaskInfo& task, const TaskScheduleInfo& schedule) {
+    if (task.exec_type == TaskInfo::ExecType::DMA) {
+        return TraceTrackKey(DMA_PORT_TRACK, static_cast<int>(schedule.dma_port), NO_TRACK_UNIT);
+    }
+
+    const auto isSwExecType = isSwTask(task);
+    if (isTileLevelProfilingTask(task)) {
+        return TraceTrackKey(SW_CLUSTER_TRACK, std::stoi(getClusterFromName(task.name)),
+                             std::stoi(getTileFromName(task.name)));
+    }
+    // Variants are nested into the slice of their cluster
+    if (isClusterLevelProfilingTask(task) || isVariantLevelProfilingTask(task)) {
+        return TraceTrackKey(isSwExecType ? SW_CLUSTER_TRACK : DPU_CLUSTER_TRACK,
+                             std::stoi(getClusterFromName(task.name)), NO_TRACK_UNIT);
+    }
+    return TraceTrackKey(isSwExecType ? SW_TRACK : DPU_TRACK, NO_TRACK_UNIT, NO_TRACK_UNIT);
+}
+
+std::string getTraceTrackName(const TraceTrackKey& key) {
+    const auto group = std::get<0>(key);
+    const auto cluster = std::get<1>(key);
+    const auto unit = std::get<2>(key);
+    switch (group) {
+    case DMA_PORT_TRACK:
+        return DMA_THREAD_NAME + " Port[" + std::to_string(cluster) + "]";
+    case DPU_TRACK:
+        return DPU_THREAD_NAME;
+    case SW_TRACK:
+        return SW_THREAD_NAME;
+    case DPU_CLUSTER_TRACK:
+    case SW_CLUSTER_TRACK: {
+        auto name = createClusterThreadName(std::to_string(cluster), group == SW_CLUSTER_TRACK);
+        if (unit != NO_TRACK_UNIT) {
+            name += " Shave[" + std::to_string(unit) + "]";
+        }
+        return name;
+    }
+    default:
+        return LAYER_THREAD_NAME;
+    }
+}
+
+// The producer, which is the last to finish, releases the barrier
+struct BarrierRelease {
+    uint64_t startNs;
+    uint64_t endNs;
+    int tid;
+};
+
 };  // namespace
 
 bool vpux::profiling::isClusterLevelProfilingTask(const TaskInfo& task) {
@@ -127,11 +194,16 @@ static void streamWriter(const OutputType profilingType, const std::pair<const u
     std::vector<TaskInfo> taskProfiling;
     std::vector<LayerInfo> layerProfiling;
     std::vector<DebugInfo> debugProfiling;
+    std::vector<TaskScheduleInfo> schedule;
     SummaryInfo summary;
 
     if (profilingType == OutputType::DEBUG) {
         debugProfiling = getTaskInfoInDebugMode(blobData, blobSize, profilingData, profilingSize, TaskType::ALL);
         summary = getSummary(blobData, profilingSize);
+    } else if (profilingType == OutputType::TRACE) {
+        const ProfilingIndex index(blobData, blobSize);
+        taskProfiling = index.decode(profilingData, profilingSize, TaskType::ALL, verbosity, fpga, &schedule);
+        layerProfiling = getLayerInfo(taskProfiling);
     } else {
         taskProfiling = getTaskInfo(blobData, blobSize, profilingData, profilingSize, TaskType::ALL, verbosity, fpga);
         layerProfiling = getLayerInfo(taskProfiling);
@@ -144,6 +216,9 @@ static void streamWriter(const OutputType profilingType, const std::pair<const u
     case OutputType::JSON:
         printProfilingAsTraceEvent(taskProfiling, layerProfiling, output);
         break;
+    case OutputType::TRACE:
+        printProfilingAsChromeTrace(taskProfiling, schedule, layerProfiling, output);
+        break;
     case OutputType::DEBUG:
         printDebugProfilingInfo(debugProfiling, output);
         printSummary(summary, output);
@@ -265,6 +340,68 @@ void vpux::profiling::printProfilingAsTraceEvent(const std::vector<TaskInfo>& ta
               << "}" << std::endl;
 }
 
+void vpux::profiling::printProfilingAsChromeTrace(const std::vector<TaskInfo>& taskProfiling,
+                                                  const std::vector<TaskScheduleInfo>& schedule,
+                                                  const std::vector<LayerInfo>& layerProfiling,
+                                                  std::ostream& outStream) {
+    VPUX_THROW_UNLESS(schedule.size() == taskProfiling.size(),
+                      "Scheduling details of {0} tasks were provided for {1} tasks", schedule.size(),
+                      taskProfiling.size());
+
+    // The first pass finds the tracks and the barrier producers
+    std::map<TraceTrackKey, int> tracks;
+    for (size_t ind = 0; ind < taskProfiling.size(); ++ind) {
+        tracks.emplace(getTraceTrackKey(taskProfiling[ind], schedule[ind]), 0);
+    }
+    if (!layerProfiling.empty()) {
+        tracks.emplace(TraceTrackKey(LAYER_TRACK, NO_TRACK_UNIT, NO_TRACK_UNIT), 0);
+    }
+
+    TraceEventWriter writer(outStream, PID, "Inference");
+    for (auto& track : tracks) {
+        track.second = writer.addTrack(getTraceTrackName(track.first));
+    }
+
+    std::unordered_map<uint32_t, BarrierRelease> barrierReleases;
+    for (size_t ind = 0; ind < taskProfiling.size(); ++ind) {
+        const auto& task = taskProfiling[ind];
+        const auto taskEndNs = task.start_time_ns + task.duration_ns;
+        const auto tid = tracks.at(getTraceTrackKey(task, schedule[ind]));
+        for (const auto barrier : schedule[ind].update_barriers) {
+            auto release = barrierReleases.emplace(barrier, BarrierRelease{task.start_time_ns, taskEndNs, tid});
+            if (!release.second && release.first->second.endNs < taskEndNs) {
+                release.first->second = BarrierRelease{task.start_time_ns, taskEndNs, tid};
+            }
+        }
+    }
+
+    // The second pass writes the events
+    uint64_t flowId = 0;
+    for (size_t ind = 0; ind < taskProfiling.size(); ++ind) {
+        const auto& task = taskProfiling[ind];
+        const auto tid = tracks.at(getTraceTrackKey(task, schedule[ind]));
+        writer.writeComplete(task.name, enumToStr.at(task.exec_type), tid, task.start_time_ns, task.duration_ns);
+
+        for (const auto barrier : schedule[ind].wait_barriers) {
+            const auto release = barrierReleases.find(barrier);
+            if (release == barrierReleases.end()) {
+                continue;
+            }
+            writer.writeFlow("Barrier " + std::to_string(barrier), "Barrier", flowId++, release->second.tid,
+                             release->second.startNs, tid, task.start_time_ns);
+        }
+    }
+
+    if (!layerProfiling.empty()) {
+        const auto layersTid = tracks.at(TraceTrackKey(LAYER_TRACK, NO_TRACK_UNIT, NO_TRACK_UNIT));
+        for (const auto& layer : layerProfiling) {
+            writer.writeComplete(layer.name, "Layer", layersTid, layer.start_time_ns, layer.duration_ns);
+        }
+    }
+
+    writer.finish();
+}
+
 static std::string rtToString(const RecordType rt) {
     static const std::map<RecordType, std::string> dict{
             {RecordType::DMA20, "DMA 2.0"}, {RecordType::DMA27, "DMA 2.7"}, {RecordType::DPU_HWP27, "HWP DPU"},
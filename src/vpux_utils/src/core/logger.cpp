@@ -8,16 +8,25 @@
 #include "vpux/utils/core/logger.hpp"
 
 #include "vpux/utils/core/optional.hpp"
+#include "vpux/utils/core/ring_buffer.hpp"
 
 #include <llvm/ADT/SmallString.h>
 #include <llvm/Support/Debug.h>
 #include <llvm/Support/Regex.h>
 #include <llvm/Support/raw_ostream.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <cstdlib>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace vpux;
 
@@ -152,15 +161,26 @@ llvm::WithColor vpux::Logger::getLevelStream(LogLevel msgLevel) {
     return llvm::WithColor(getBaseStream(), color, true, false, llvm::ColorMode::Auto);
 }
 
-void vpux::Logger::addEntryPacked(LogLevel msgLevel, const formatv_object_base& msg) const {
-    if (!isActive(msgLevel)) {
-        return;
-    }
+namespace {
 
-    llvm::SmallString<512> tempBuf;
-    llvm::raw_svector_ostream tempStream(tempBuf);
+std::mutex& getStreamMutex() {
+    static std::mutex logMtx;
+    return logMtx;
+}
 
-    time_t now = time(nullptr);
+using LogClock = std::chrono::system_clock;
+
+// Binary timestamp in nanoseconds since epoch, it is converted to text only when the message is printed
+uint64_t getTimestamp() {
+    using namespace std::chrono;
+    return static_cast<uint64_t>(duration_cast<nanoseconds>(LogClock::now().time_since_epoch()).count());
+}
+
+void printTimestamp(llvm::raw_ostream& stream, uint64_t timestamp) {
+    using namespace std::chrono;
+    const auto timePoint = LogClock::time_point(duration_cast<LogClock::duration>(nanoseconds(timestamp)));
+
+    time_t now = LogClock::to_time_t(timePoint);
     struct tm tstruct;
     char timeStr[10];
     struct tm* tstruct_ptr = localtime(&now);
@@ -169,10 +189,267 @@ void vpux::Logger::addEntryPacked(LogLevel msgLevel, const formatv_object_base&
     }
     strftime(timeStr, sizeof(timeStr), "%H:%M:%S", &tstruct);
 
-    using namespace std::chrono;
-    uint32_t ms = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count() % 1000;
+    uint32_t ms = (timestamp / 1000000) % 1000;
 
-    printTo(tempStream, "{0}.{1,0+3} [{2}]", timeStr, ms, _name);
+    printTo(stream, "{0}.{1,0+3} ", timeStr, ms);
+}
+
+void printEntry(LogLevel msgLevel, StringRef entry) {
+    auto colorStream = Logger::getLevelStream(msgLevel);
+    auto& stream = colorStream.get();
+    stream << entry;
+    stream.flush();
+}
+
+//
+// AsyncLogBackend
+//
+
+bool isAsyncRequestedByEnv() {
+    if (const auto env = std::getenv("IE_VPUX_LOG_ASYNC")) {
+        return StringRef(env) == "YES";
+    }
+
+    return false;
+}
+
+std::atomic<bool> asyncLogEnabled(isAsyncRequestedByEnv());
+
+class AsyncLogBackend final {
+public:
+    // Per-thread queue capacity in messages
+    static constexpr size_t QUEUE_CAPACITY = 4096;
+    static constexpr auto IDLE_PERIOD = std::chrono::milliseconds(2);
+
+    struct Entry final {
+        uint64_t timestamp = 0;
+        LogLevel level = LogLevel::None;
+        std::string text;
+    };
+
+    struct Queue final {
+        Queue(): entries(QUEUE_CAPACITY) {
+        }
+
+        SpscRingBuffer<Entry> entries;
+        std::atomic<bool> closed{false};
+    };
+
+public:
+    // The backend is never destroyed, it is stopped by atexit handler instead, so the messages from
+    // the static destructors are still handled by the synchronous path
+    static AsyncLogBackend* get() {
+        static const auto backend = new AsyncLogBackend;
+        return backend;
+    }
+
+    static void shutdown() {
+        asyncLogEnabled = false;
+        get()->stop();
+    }
+
+public:
+    void push(LogLevel msgLevel, uint64_t timestamp, std::string text) {
+        auto& queue = getThreadQueue();
+
+        Entry entry;
+        entry.timestamp = timestamp;
+        entry.level = msgLevel;
+        entry.text = std::move(text);
+
+        if (!queue.entries.tryPush(std::move(entry))) {
+            _numDropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void flush() {
+        while (drain()) {
+        }
+    }
+
+    uint64_t getNumDropped() const {
+        return _numDropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    AsyncLogBackend() {
+        // Make sure the output stream outlives the backend
+        Logger::getBaseStream();
+
+        _thread = std::thread([this]() {
+            while (!_stopRequested.load()) {
+                if (!drain()) {
+                    std::unique_lock<std::mutex> lock(_stopMtx);
+                    _stopCv.wait_for(lock, IDLE_PERIOD, [this]() {
+                        return _stopRequested.load();
+                    });
+                }
+            }
+        });
+
+        std::atexit(&AsyncLogBackend::shutdown);
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(_stopMtx);
+            _stopRequested = true;
+        }
+        _stopCv.notify_one();
+
+        if (_thread.joinable()) {
+            _thread.join();
+        }
+
+        flush();
+    }
+
+    Queue& getThreadQueue() {
+        struct ThreadQueueHolder final {
+            ~ThreadQueueHolder() {
+                if (queue != nullptr) {
+                    queue->closed = true;
+                }
+            }
+
+            std::shared_ptr<Queue> queue;
+        };
+
+        static thread_local ThreadQueueHolder holder;
+
+        if (holder.queue == nullptr) {
+            holder.queue = std::make_shared<Queue>();
+
+            std::lock_guard<std::mutex> lock(_queuesMtx);
+            _queues.push_back(holder.queue);
+        }
+
+        return *holder.queue;
+    }
+
+    // Prints the messages from all queues in the order of their timestamps.
+    // Both the background thread and flush might consume the queues, so the consumers are serialized.
+    bool drain() {
+        std::lock_guard<std::mutex> drainLock(_drainMtx);
+
+        std::vector<std::shared_ptr<Queue>> queues;
+        {
+            std::lock_guard<std::mutex> lock(_queuesMtx);
+            queues = _queues;
+        }
+
+        _batch.clear();
+
+        Entry entry;
+        for (const auto& queue : queues) {
+            // Check before consuming, so the last messages of the finished thread are not lost
+            const auto closed = queue->closed.load();
+
+            while (queue->entries.tryPop(entry)) {
+                _batch.push_back(std::move(entry));
+            }
+
+            if (closed) {
+                std::lock_guard<std::mutex> lock(_queuesMtx);
+                _queues.erase(std::remove(_queues.begin(), _queues.end(), queue), _queues.end());
+            }
+        }
+
+        std::stable_sort(_batch.begin(), _batch.end(), [](const Entry& a, const Entry& b) {
+            return a.timestamp < b.timestamp;
+        });
+
+        const auto numDropped = getNumDropped();
+        const auto hasDropped = numDropped != _numReportedDropped;
+
+        if (_batch.empty() && !hasDropped) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> streamLock(getStreamMutex());
+
+        llvm::SmallString<512> tempBuf;
+        llvm::raw_svector_ostream tempStream(tempBuf);
+
+        for (const auto& batchEntry : _batch) {
+            tempBuf.clear();
+            printTimestamp(tempStream, batchEntry.timestamp);
+            tempStream << batchEntry.text;
+            printEntry(batchEntry.level, tempStream.str());
+        }
+
+        if (hasDropped) {
+            tempBuf.clear();
+            printTimestamp(tempStream, getTimestamp());
+            printTo(tempStream, "[Logger] {0} messages were dropped, the logging queue is full\n",
+                    numDropped - _numReportedDropped);
+            printEntry(LogLevel::Warning, tempStream.str());
+
+            _numReportedDropped = numDropped;
+        }
+
+        return true;
+    }
+
+private:
+    std::mutex _queuesMtx;
+    std::vector<std::shared_ptr<Queue>> _queues;
+
+    std::atomic<uint64_t> _numDropped{0};
+
+    std::mutex _drainMtx;
+    std::vector<Entry> _batch;
+    uint64_t _numReportedDropped = 0;
+
+    std::mutex _stopMtx;
+    std::condition_variable _stopCv;
+    std::atomic<bool> _stopRequested{false};
+    std::thread _thread;
+};
+
+constexpr size_t AsyncLogBackend::QUEUE_CAPACITY;
+constexpr std::chrono::milliseconds AsyncLogBackend::IDLE_PERIOD;
+
+}  // namespace
+
+void vpux::Logger::setAsync(bool enable) {
+    if (!enable && asyncLogEnabled.load()) {
+        flush();
+    }
+
+    asyncLogEnabled = enable;
+}
+
+bool vpux::Logger::isAsync() {
+    return asyncLogEnabled.load();
+}
+
+void vpux::Logger::flush() {
+    if (asyncLogEnabled.load()) {
+        AsyncLogBackend::get()->flush();
+    }
+}
+
+uint64_t vpux::Logger::getNumDroppedEntries() {
+    return asyncLogEnabled.load() ? AsyncLogBackend::get()->getNumDropped() : 0;
+}
+
+void vpux::Logger::addEntryPacked(LogLevel msgLevel, const formatv_object_base& msg) const {
+    if (!isActive(msgLevel)) {
+        return;
+    }
+
+    const auto timestamp = getTimestamp();
+    const auto async = asyncLogEnabled.load(std::memory_order_relaxed);
+
+    llvm::SmallString<512> tempBuf;
+    llvm::raw_svector_ostream tempStream(tempBuf);
+
+    if (!async) {
+        printTimestamp(tempStream, timestamp);
+    }
+
+    printTo(tempStream, "[{0}]", _name);
 
     for (size_t i = 0; i < _indentLevel; ++i)
         tempStream << "  ";
@@ -180,11 +457,18 @@ void vpux::Logger::addEntryPacked(LogLevel msgLevel, const formatv_object_base&
     msg.format(tempStream);
     tempStream << "\n";
 
-    static std::mutex logMtx;
-    std::lock_guard<std::mutex> logMtxLock(logMtx);
+    if (async) {
+        auto backend = AsyncLogBackend::get();
+        backend->push(msgLevel, timestamp, tempStream.str().str());
 
-    auto colorStream = getLevelStream(msgLevel);
-    auto& stream = colorStream.get();
-    stream << tempStream.str();
-    stream.flush();
+        // The process is likely to be terminated after the fatal error, don't keep the message in the queue
+        if (msgLevel == LogLevel::Fatal) {
+            backend->flush();
+        }
+
+        return;
+    }
+
+    std::lock_guard<std::mutex> logMtxLock(getStreamMutex());
+    printEntry(msgLevel, tempStream.str());
 }
@@ -0,0 +1,71 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/core/memory_usage.hpp"
+
+#include <llvm/Support/Process.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+
+#include <psapi.h>
+#elif defined(__linux__)
+#include <cstdio>
+#include <cstring>
+#endif
+
+using namespace vpux;
+
+namespace {
+
+#if defined(__linux__)
+
+// Parses "VmRSS:     1234 kB" like line of /proc/self/status
+bool parseStatusLine(const char* line, const char* key, uint64_t& bytes) {
+    const auto keyLen = std::strlen(key);
+    if (std::strncmp(line, key, keyLen) != 0 || line[keyLen] != ':') {
+        return false;
+    }
+
+    unsigned long long kbytes = 0;
+    if (std::sscanf(line + keyLen + 1, "%llu", &kbytes) != 1) {
+        return false;
+    }
+
+    bytes = static_cast<uint64_t>(kbytes) * 1024;
+    return true;
+}
+
+#endif
+
+}  // namespace
+
+MemoryUsage vpux::getProcessMemoryUsage() {
+    MemoryUsage usage;
+
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        usage.rss = static_cast<uint64_t>(counters.WorkingSetSize);
+        usage.peakRss = static_cast<uint64_t>(counters.PeakWorkingSetSize);
+    }
+#elif defined(__linux__)
+    if (auto file = std::fopen("/proc/self/status", "r")) {
+        char line[256];
+        while (std::fgets(line, sizeof(line), file) != nullptr) {
+            if (!parseStatusLine(line, "VmRSS", usage.rss)) {
+                parseStatusLine(line, "VmHWM", usage.peakRss);
+            }
+        }
+        std::fclose(file);
+    }
+#endif
+
+    usage.heapSize = static_cast<uint64_t>(llvm::sys::Process::GetMallocUsage());
+
+    return usage;
+}
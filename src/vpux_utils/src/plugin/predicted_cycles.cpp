@@ -0,0 +1,331 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/plugin/predicted_cycles.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/plugin/profiling_json.hpp"
+#include "vpux/utils/plugin/weights_segment_format.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <utility>
+
+using namespace vpux;
+using namespace vpux::profiling;
+
+namespace {
+
+constexpr size_t MAGIC_SIZE = sizeof(PREDICTED_CYCLES_MAGIC) - 1;
+
+static_assert(sizeof(WEIGHTS_SEGMENT_MAGIC) - 1 == MAGIC_SIZE, "Trailing segments must use the same magic size");
+
+// cycles, execType, nameSize and opTypeSize
+constexpr size_t ENTRY_HEADER_SIZE = sizeof(uint64_t) + 3 * sizeof(uint32_t);
+
+std::string execTypeToString(TaskInfo::ExecType execType) {
+    switch (execType) {
+    case TaskInfo::ExecType::DPU:
+        return "DPU";
+    case TaskInfo::ExecType::SW:
+        return "SW";
+    case TaskInfo::ExecType::DMA:
+        return "DMA";
+    default:
+        return "NONE";
+    }
+}
+
+bool hasMagic(const uint8_t* data, const char* magic) {
+    return std::memcmp(data, magic, MAGIC_SIZE) == 0;
+}
+
+void parsePredictedCycles(const uint8_t* segment, const PredictedCyclesFooter& footer, PredictedCycles& predicted) {
+    const auto entriesSize = footer.segmentSize - sizeof(PredictedCyclesFooter);
+
+    predicted.frequencyMHz = footer.frequencyMHz;
+    predicted.tasks.clear();
+    predicted.tasks.reserve(footer.numEntries);
+
+    size_t offset = 0;
+    for (uint32_t ind = 0; ind < footer.numEntries; ++ind) {
+        VPUX_THROW_UNLESS(offset + ENTRY_HEADER_SIZE <= entriesSize, "Predicted cycles entry {0} is out of bounds",
+                          ind);
+        const auto read = [&](auto& value) {
+            std::memcpy(&value, segment + offset, sizeof(value));
+            offset += sizeof(value);
+        };
+
+        PredictedTaskCycles task;
+        uint32_t execType = 0;
+        uint32_t nameSize = 0;
+        uint32_t opTypeSize = 0;
+        read(task.cycles);
+        read(execType);
+        read(nameSize);
+        read(opTypeSize);
+
+        VPUX_THROW_UNLESS(offset + nameSize + opTypeSize <= entriesSize, "Predicted cycles entry {0} is out of bounds",
+                          ind);
+        task.execType = static_cast<TaskInfo::ExecType>(execType);
+        task.name.assign(reinterpret_cast<const char*>(segment + offset), nameSize);
+        offset += nameSize;
+        task.opType.assign(reinterpret_cast<const char*>(segment + offset), opTypeSize);
+        offset += opTypeSize;
+
+        predicted.tasks.push_back(std::move(task));
+    }
+}
+
+double getPercentile(std::vector<double> values, double percent) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    const auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * static_cast<double>(values.size())));
+    const auto ind = std::min(values.size() - 1, rank == 0 ? 0 : rank - 1);
+    std::nth_element(values.begin(), values.begin() + ind, values.end());
+    return values[ind];
+}
+
+}  // namespace
+
+//
+// Predicted cycles segment
+//
+
+std::vector<char> vpux::profiling::serializePredictedCycles(const PredictedCycles& predicted, uint32_t alignment) {
+    VPUX_THROW_UNLESS(alignment != 0, "Got zero alignment of the predicted cycles segment");
+
+    std::vector<char> segment;
+    const auto append = [&](const void* data, size_t size) {
+        const auto ptr = static_cast<const char*>(data);
+        segment.insert(segment.end(), ptr, ptr + size);
+    };
+
+    for (const auto& task : predicted.tasks) {
+        const auto execType = static_cast<uint32_t>(task.execType);
+        const auto nameSize = static_cast<uint32_t>(task.name.size());
+        const auto opTypeSize = static_cast<uint32_t>(task.opType.size());
+        append(&task.cycles, sizeof(task.cycles));
+        append(&execType, sizeof(execType));
+        append(&nameSize, sizeof(nameSize));
+        append(&opTypeSize, sizeof(opTypeSize));
+        append(task.name.data(), task.name.size());
+        append(task.opType.data(), task.opType.size());
+    }
+
+    const auto unalignedSize = segment.size() + sizeof(PredictedCyclesFooter);
+    const auto alignedSize = (unalignedSize + alignment - 1) / alignment * alignment;
+    segment.resize(alignedSize - sizeof(PredictedCyclesFooter), 0);
+
+    PredictedCyclesFooter footer = {};
+    std::memcpy(footer.magic, PREDICTED_CYCLES_MAGIC, MAGIC_SIZE);
+    footer.version = PREDICTED_CYCLES_VERSION;
+    footer.numEntries = static_cast<uint32_t>(predicted.tasks.size());
+    footer.frequencyMHz = predicted.frequencyMHz;
+    footer.segmentSize = alignedSize;
+    append(&footer, sizeof(footer));
+
+    return segment;
+}
+
+bool vpux::profiling::findPredictedCycles(const uint8_t* blobData, size_t blobSize, PredictedCycles& predicted) {
+    // Trailing segments are walked from the end of the blob, each of them stores its own size in the footer
+    auto end = blobSize;
+    while (true) {
+        if (end >= sizeof(PredictedCyclesFooter) &&
+            hasMagic(blobData + end - sizeof(PredictedCyclesFooter), PREDICTED_CYCLES_MAGIC)) {
+            PredictedCyclesFooter footer = {};
+            std::memcpy(&footer, blobData + end - sizeof(footer), sizeof(footer));
+            VPUX_THROW_UNLESS(footer.version == PREDICTED_CYCLES_VERSION,
+                              "Unsupported predicted cycles segment version '{0}'", footer.version);
+            VPUX_THROW_UNLESS(footer.segmentSize >= sizeof(footer) && footer.segmentSize <= end,
+                              "Got invalid predicted cycles segment size '{0}'", footer.segmentSize);
+
+            parsePredictedCycles(blobData + end - footer.segmentSize, footer, predicted);
+            return true;
+        }
+
+        // The weights segment may follow the predicted cycles segment
+        if (end >= sizeof(WeightsSegmentFooter) &&
+            hasMagic(blobData + end - sizeof(WeightsSegmentFooter), WEIGHTS_SEGMENT_MAGIC)) {
+            WeightsSegmentFooter footer = {};
+            std::memcpy(&footer, blobData + end - sizeof(footer), sizeof(footer));
+            if (footer.segmentSize < sizeof(footer) || footer.segmentSize > end) {
+                return false;
+            }
+            end -= static_cast<size_t>(footer.segmentSize);
+            continue;
+        }
+
+        return false;
+    }
+}
+
+//
+// Predicted vs measured correlation
+//
+
+double vpux::profiling::CycleCorrelationEntry::relativeError() const {
+    if (measuredNs == 0) {
+        return predictedNs == 0 ? 0.0 : 1.0;
+    }
+    return (static_cast<double>(predictedNs) - static_cast<double>(measuredNs)) / static_cast<double>(measuredNs);
+}
+
+CycleCorrelationReport vpux::profiling::correlatePredictedCycles(const PredictedCycles& predicted,
+                                                                 const std::vector<TaskInfo>& measured) {
+    VPUX_THROW_UNLESS(predicted.frequencyMHz > 0, "Got invalid frequency of the predicted cycles '{0}'",
+                      predicted.frequencyMHz);
+
+    using TaskKey = std::pair<std::string, TaskInfo::ExecType>;
+
+    std::map<TaskKey, uint64_t> measuredNs;
+    for (const auto& task : measured) {
+        measuredNs[TaskKey(task.name, task.exec_type)] += task.duration_ns;
+    }
+
+    // Predicted tasks are kept in the compilation order
+    std::map<TaskKey, size_t> entryIndex;
+    CycleCorrelationReport report;
+    for (const auto& task : predicted.tasks) {
+        const auto key = TaskKey(task.name, task.execType);
+        const auto predictedNs = static_cast<uint64_t>(std::llround(task.cycles * 1000.0 / predicted.frequencyMHz));
+
+        const auto it = entryIndex.find(key);
+        if (it != entryIndex.end()) {
+            report.entries[it->second].predictedNs += predictedNs;
+            continue;
+        }
+
+        const auto measuredIt = measuredNs.find(key);
+        if (measuredIt == measuredNs.end()) {
+            ++report.numUnmatchedPredicted;
+            continue;
+        }
+
+        CycleCorrelationEntry entry;
+        entry.name = task.name;
+        entry.opType = task.opType;
+        entry.execType = task.execType;
+        entry.predictedNs = predictedNs;
+        entry.measuredNs = measuredIt->second;
+        entryIndex.emplace(key, report.entries.size());
+        report.entries.push_back(std::move(entry));
+    }
+    report.numUnmatchedMeasured = measuredNs.size() - entryIndex.size();
+
+    std::map<std::pair<TaskInfo::ExecType, std::string>, std::vector<const CycleCorrelationEntry*>> opTypes;
+    for (const auto& entry : report.entries) {
+        opTypes[std::make_pair(entry.execType, entry.opType)].push_back(&entry);
+    }
+
+    for (const auto& opType : opTypes) {
+        CycleCorrelationStatistics stats;
+        stats.execType = opType.first.first;
+        stats.opType = opType.first.second;
+        stats.count = opType.second.size();
+
+        std::vector<double> errors;
+        std::vector<double> absErrors;
+        for (const auto* entry : opType.second) {
+            stats.predictedNs += entry->predictedNs;
+            stats.measuredNs += entry->measuredNs;
+            errors.push_back(entry->relativeError());
+            absErrors.push_back(std::abs(entry->relativeError()));
+        }
+
+        double sumAbsErrors = 0.0;
+        for (const auto error : absErrors) {
+            sumAbsErrors += error;
+        }
+        stats.meanAbsError = sumAbsErrors / static_cast<double>(absErrors.size());
+        stats.medianError = getPercentile(std::move(errors), 50.0);
+        stats.p90AbsError = getPercentile(std::move(absErrors), 90.0);
+
+        report.opTypes.push_back(std::move(stats));
+    }
+
+    std::stable_sort(report.opTypes.begin(), report.opTypes.end(),
+                     [](const CycleCorrelationStatistics& a, const CycleCorrelationStatistics& b) {
+                         return a.measuredNs > b.measuredNs;
+                     });
+
+    const auto absTimeError = [](const CycleCorrelationEntry& entry) {
+        return entry.predictedNs > entry.measuredNs ? entry.predictedNs - entry.measuredNs
+                                                    : entry.measuredNs - entry.predictedNs;
+    };
+    std::stable_sort(report.entries.begin(), report.entries.end(),
+                     [&](const CycleCorrelationEntry& a, const CycleCorrelationEntry& b) {
+                         return absTimeError(a) > absTimeError(b);
+                     });
+
+    return report;
+}
+
+void vpux::profiling::printCycleCorrelationAsText(const CycleCorrelationReport& report, size_t numWorst,
+                                                  std::ostream& outStream) {
+    outStream << std::left << std::setprecision(2) << std::fixed;
+
+    outStream << "Error of the predicted time per op type:" << std::endl;
+    for (const auto& stats : report.opTypes) {
+        outStream << "Type(" << execTypeToString(stats.execType) << "): " << std::setw(30) << stats.opType
+                  << "\tCount: " << std::setw(6) << stats.count << "\tPredicted(us): " << std::setw(10)
+                  << stats.predictedNs / 1000. << "\tMeasured(us): " << std::setw(10) << stats.measuredNs / 1000.
+                  << "\tMedian error: " << std::setw(8) << stats.medianError * 100.
+                  << "%\tMean abs error: " << std::setw(8) << stats.meanAbsError * 100.
+                  << "%\tP90 abs error: " << std::setw(8) << stats.p90AbsError * 100. << "%" << std::endl;
+    }
+
+    outStream << "Worst mispredicted tasks:" << std::endl;
+    const auto count = std::min(numWorst, report.entries.size());
+    for (size_t ind = 0; ind < count; ++ind) {
+        const auto& entry = report.entries[ind];
+        outStream << "Task(" << execTypeToString(entry.execType) << "): " << std::setw(60) << entry.name
+                  << "\tType: " << std::setw(20) << entry.opType << "\tPredicted(us): " << std::setw(10)
+                  << entry.predictedNs / 1000. << "\tMeasured(us): " << std::setw(10) << entry.measuredNs / 1000.
+                  << "\tError: " << std::setw(8) << entry.relativeError() * 100. << "%" << std::endl;
+    }
+
+    outStream << "Matched tasks: " << report.entries.size()
+              << ", predicted only: " << report.numUnmatchedPredicted
+              << ", measured only: " << report.numUnmatchedMeasured << std::endl;
+}
+
+void vpux::profiling::printCycleCorrelationAsJson(const CycleCorrelationReport& report, size_t numWorst,
+                                                  std::ostream& outStream) {
+    outStream << std::fixed << std::setprecision(4);
+
+    outStream << "{\"op_types\":[" << std::endl;
+    for (size_t ind = 0; ind < report.opTypes.size(); ++ind) {
+        const auto& stats = report.opTypes[ind];
+        outStream << "{\"type\":\"" << escapeJsonString(stats.opType) << "\", \"exec_type\":\""
+                  << execTypeToString(stats.execType) << "\", \"count\":" << stats.count
+                  << ", \"predicted_ns\":" << stats.predictedNs << ", \"measured_ns\":" << stats.measuredNs
+                  << ", \"median_error\":" << stats.medianError << ", \"mean_abs_error\":" << stats.meanAbsError
+                  << ", \"p90_abs_error\":" << stats.p90AbsError << "}"
+                  << (ind + 1 != report.opTypes.size() ? "," : "") << std::endl;
+    }
+    outStream << "]," << std::endl;
+
+    outStream << "\"worst_tasks\":[" << std::endl;
+    const auto count = std::min(numWorst, report.entries.size());
+    for (size_t ind = 0; ind < count; ++ind) {
+        const auto& entry = report.entries[ind];
+        outStream << "{\"name\":\"" << escapeJsonString(entry.name) << "\", \"type\":\""
+                  << escapeJsonString(entry.opType) << "\", \"exec_type\":\"" << execTypeToString(entry.execType)
+                  << "\", \"predicted_ns\":" << entry.predictedNs << ", \"measured_ns\":" << entry.measuredNs
+                  << ", \"error\":" << entry.relativeError() << "}" << (ind + 1 != count ? "," : "") << std::endl;
+    }
+    outStream << "]," << std::endl;
+
+    outStream << "\"matched\":" << report.entries.size() << ", \"predicted_only\":" << report.numUnmatchedPredicted
+              << ", \"measured_only\":" << report.numUnmatchedMeasured << "}" << std::endl;
+}
@@ -0,0 +1,433 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/plugin/profiling_aggregator.hpp"
+#include "vpux/utils/plugin/profiling_json.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <llvm/Support/MathExtras.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <utility>
+
+using namespace vpux;
+using namespace vpux::profiling;
+
+//
+// DurationHistogram
+//
+
+constexpr uint32_t vpux::profiling::DurationHistogram::SUB_BUCKET_BITS;
+constexpr uint64_t vpux::profiling::DurationHistogram::SUB_BUCKET_COUNT;
+constexpr uint32_t vpux::profiling::DurationHistogram::MAX_VALUE_BITS;
+constexpr uint64_t vpux::profiling::DurationHistogram::MAX_VALUE;
+constexpr size_t vpux::profiling::DurationHistogram::BUCKET_COUNT;
+
+size_t vpux::profiling::DurationHistogram::getBucketIndex(uint64_t value) {
+    value = std::min(value, MAX_VALUE);
+    if (value < SUB_BUCKET_COUNT) {
+        return static_cast<size_t>(value);
+    }
+
+    // The value is represented as [SUB_BUCKET_COUNT + subBucket] << shift
+    const auto shift = llvm::Log2_64(value) - SUB_BUCKET_BITS;
+    const auto subBucket = (value >> shift) - SUB_BUCKET_COUNT;
+    return static_cast<size_t>((shift + 1) * SUB_BUCKET_COUNT + subBucket);
+}
+
+uint64_t vpux::profiling::DurationHistogram::getBucketUpperBound(size_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+
+    const auto shift = index / SUB_BUCKET_COUNT - 1;
+    const auto subBucket = index % SUB_BUCKET_COUNT;
+    const auto lowerBound = (SUB_BUCKET_COUNT + subBucket) << shift;
+    return lowerBound + (1ull << shift) - 1;
+}
+
+void vpux::profiling::DurationHistogram::record(uint64_t value) {
+    const auto index = getBucketIndex(value);
+    if (index >= _buckets.size()) {
+        _buckets.resize(index + 1, 0);
+    }
+    ++_buckets[index];
+
+    _min = _count != 0 ? std::min(_min, value) : value;
+    _max = std::max(_max, value);
+    _sum += value;
+    ++_count;
+}
+
+void vpux::profiling::DurationHistogram::merge(const DurationHistogram& other) {
+    if (other._count == 0) {
+        return;
+    }
+
+    if (other._buckets.size() > _buckets.size()) {
+        _buckets.resize(other._buckets.size(), 0);
+    }
+    for (size_t i = 0; i < other._buckets.size(); ++i) {
+        _buckets[i] += other._buckets[i];
+    }
+
+    _min = _count != 0 ? std::min(_min, other._min) : other._min;
+    _max = std::max(_max, other._max);
+    _sum += other._sum;
+    _count += other._count;
+}
+
+void vpux::profiling::DurationHistogram::reset() {
+    _buckets.clear();
+    _count = 0;
+    _min = 0;
+    _max = 0;
+    _sum = 0;
+}
+
+uint64_t vpux::profiling::DurationHistogram::percentile(double percent) const {
+    if (_count == 0) {
+        return 0;
+    }
+
+    percent = std::min(std::max(percent, 0.0), 100.0);
+    const auto rank =
+            std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percent / 100.0 * static_cast<double>(_count))));
+
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < _buckets.size(); ++i) {
+        accumulated += _buckets[i];
+        if (accumulated == _count) {
+            // The last non-empty bucket contains the maximum, which is known exactly
+            return _max;
+        }
+        if (accumulated >= rank) {
+            // Bucket bounds are approximate, while the extremes are known exactly
+            return std::min(std::max(getBucketUpperBound(i), _min), _max);
+        }
+    }
+
+    return _max;
+}
+
+DurationStatistics vpux::profiling::getDurationStatistics(const DurationHistogram& histogram) {
+    DurationStatistics stats;
+    stats.count = histogram.count();
+    stats.min_ns = histogram.min();
+    stats.p50_ns = histogram.percentile(50.0);
+    stats.p90_ns = histogram.percentile(90.0);
+    stats.p99_ns = histogram.percentile(99.0);
+    stats.max_ns = histogram.max();
+    stats.mean_ns = histogram.mean();
+    return stats;
+}
+
+//
+// ProfilingAggregator
+//
+
+namespace {
+
+using Interval = std::pair<uint64_t, uint64_t>;
+
+// Total length of the union of the intervals, so overlapped tasks of the same engine are counted once
+uint64_t getBusyTime(std::vector<Interval>& intervals) {
+    std::sort(intervals.begin(), intervals.end());
+
+    uint64_t busyTime = 0;
+    uint64_t currentBegin = 0;
+    uint64_t currentEnd = 0;
+    bool hasCurrent = false;
+    for (const auto& interval : intervals) {
+        if (hasCurrent && interval.first <= currentEnd) {
+            currentEnd = std::max(currentEnd, interval.second);
+            continue;
+        }
+        if (hasCurrent) {
+            busyTime += currentEnd - currentBegin;
+        }
+        currentBegin = interval.first;
+        currentEnd = interval.second;
+        hasCurrent = true;
+    }
+    if (hasCurrent) {
+        busyTime += currentEnd - currentBegin;
+    }
+
+    return busyTime;
+}
+
+std::string execTypeToString(TaskInfo::ExecType execType) {
+    switch (execType) {
+    case TaskInfo::ExecType::DPU:
+        return "DPU";
+    case TaskInfo::ExecType::SW:
+        return "SW";
+    case TaskInfo::ExecType::DMA:
+        return "DMA";
+    default:
+        return "NONE";
+    }
+}
+
+}  // namespace
+
+ProfilingAggregator::Entry& vpux::profiling::ProfilingAggregator::getEntry(std::vector<Entry>& entries,
+                                                                         EntryMap& index, const char* name,
+                                                                         const char* layerType,
+                                                                         TaskInfo::ExecType execType) {
+    const auto it = index.find(name);
+    if (it != index.end()) {
+        return entries[it->second];
+    }
+
+    index.emplace(name, entries.size());
+    entries.push_back({name, layerType, execType, DurationHistogram()});
+    return entries.back();
+}
+
+void vpux::profiling::ProfilingAggregator::addInference(const std::vector<TaskInfo>& tasks,
+                                                        const std::vector<LayerInfo>& layers) {
+    // Engine intervals are prepared out of the lock, only the histograms update is serialized
+    std::vector<Interval> dpuIntervals;
+    std::vector<Interval> swIntervals;
+    std::vector<Interval> dmaIntervals;
+
+    uint64_t inferenceBegin = std::numeric_limits<uint64_t>::max();
+    uint64_t inferenceEnd = 0;
+    for (const auto& task : tasks) {
+        const Interval interval(task.start_time_ns, task.start_time_ns + task.duration_ns);
+        inferenceBegin = std::min(inferenceBegin, interval.first);
+        inferenceEnd = std::max(inferenceEnd, interval.second);
+
+        switch (task.exec_type) {
+        case TaskInfo::ExecType::DPU:
+            dpuIntervals.push_back(interval);
+            break;
+        case TaskInfo::ExecType::SW:
+            swIntervals.push_back(interval);
+            break;
+        case TaskInfo::ExecType::DMA:
+            dmaIntervals.push_back(interval);
+            break;
+        default:
+            break;
+        }
+    }
+
+    const auto inferenceTime = inferenceEnd > inferenceBegin ? inferenceEnd - inferenceBegin : 0;
+    const auto dpuBusyTime = getBusyTime(dpuIntervals);
+    const auto swBusyTime = getBusyTime(swIntervals);
+    const auto dmaBusyTime = getBusyTime(dmaIntervals);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    ++_numInferences;
+    if (!tasks.empty()) {
+        _inferenceHistogram.record(inferenceTime);
+        _totalInferenceNs += inferenceTime;
+        _dpuBusyNs += dpuBusyTime;
+        _swBusyNs += swBusyTime;
+        _dmaBusyNs += dmaBusyTime;
+    }
+
+    for (const auto& task : tasks) {
+        getEntry(_tasks, _tasksIndex, task.name, task.layer_type, task.exec_type).histogram.record(task.duration_ns);
+    }
+    for (const auto& layer : layers) {
+        getEntry(_layers, _layersIndex, layer.name, layer.layer_type, TaskInfo::ExecType::NONE)
+                .histogram.record(layer.duration_ns);
+    }
+}
+
+void vpux::profiling::ProfilingAggregator::reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _numInferences = 0;
+    _inferenceHistogram.reset();
+    _totalInferenceNs = 0;
+    _dpuBusyNs = 0;
+    _swBusyNs = 0;
+    _dmaBusyNs = 0;
+    _layers.clear();
+    _layersIndex.clear();
+    _tasks.clear();
+    _tasksIndex.clear();
+}
+
+uint64_t vpux::profiling::ProfilingAggregator::getNumInferences() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _numInferences;
+}
+
+AggregatedProfilingInfo vpux::profiling::ProfilingAggregator::getAggregatedInfo() const {
+    const auto toEntries = [](const std::vector<Entry>& entries) {
+        std::vector<AggregatedEntry> result;
+        result.reserve(entries.size());
+        for (const auto& entry : entries) {
+            result.push_back({entry.name, entry.layerType, entry.execType, getDurationStatistics(entry.histogram)});
+        }
+        return result;
+    };
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    AggregatedProfilingInfo info;
+    info.num_inferences = _numInferences;
+    info.inference = getDurationStatistics(_inferenceHistogram);
+    if (_totalInferenceNs != 0) {
+        const auto totalTime = static_cast<double>(_totalInferenceNs);
+        info.dpu_utilization = static_cast<double>(_dpuBusyNs) / totalTime;
+        info.sw_utilization = static_cast<double>(_swBusyNs) / totalTime;
+        info.dma_utilization = static_cast<double>(_dmaBusyNs) / totalTime;
+    }
+    info.layers = toEntries(_layers);
+    info.tasks = toEntries(_tasks);
+    return info;
+}
+
+//
+// HostOverheadAggregator
+//
+
+const char* vpux::profiling::stringifyHostOverheadStage(HostOverheadStage stage) {
+    switch (stage) {
+    case HostOverheadStage::Preprocessing:
+        return "preprocessing";
+    case HostOverheadStage::Repack:
+        return "repack";
+    case HostOverheadStage::Push:
+        return "push";
+    case HostOverheadStage::Pull:
+        return "pull";
+    default:
+        return "unknown";
+    }
+}
+
+void vpux::profiling::HostOverheadAggregator::record(HostOverheadStage stage, uint64_t durationNs) {
+    const auto index = static_cast<size_t>(stage);
+    VPUX_THROW_UNLESS(index < _stages.size(), "Unknown host overhead stage {0}", index);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stages[index].record(durationNs);
+}
+
+void vpux::profiling::HostOverheadAggregator::reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto& histogram : _stages) {
+        histogram.reset();
+    }
+}
+
+AggregatedHostOverhead vpux::profiling::HostOverheadAggregator::getAggregatedInfo() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    AggregatedHostOverhead info;
+    for (size_t i = 0; i < _stages.size(); ++i) {
+        info.stages[i] = getDurationStatistics(_stages[i]);
+    }
+    return info;
+}
+
+//
+// Printers
+//
+
+void vpux::profiling::printAggregatedProfilingAsText(const AggregatedProfilingInfo& info, std::ostream& outStream) {
+    const auto printStats = [&](const DurationStatistics& stats) {
+        outStream << "\tCount: " << std::setw(8) << stats.count << "\tMin(us): " << std::setw(10)
+                  << stats.min_ns / 1000. << "\tP50(us): " << std::setw(10) << stats.p50_ns / 1000.
+                  << "\tP90(us): " << std::setw(10) << stats.p90_ns / 1000. << "\tP99(us): " << std::setw(10)
+                  << stats.p99_ns / 1000. << "\tMax(us): " << std::setw(10) << stats.max_ns / 1000. << std::endl;
+    };
+
+    outStream << std::left << std::setprecision(2) << std::fixed;
+
+    for (const auto& task : info.tasks) {
+        outStream << "Task(" << execTypeToString(task.exec_type) << "): " << std::setw(60) << task.name;
+        printStats(task.duration);
+    }
+
+    for (const auto& layer : info.layers) {
+        outStream << "Layer: " << std::setw(40) << layer.name;
+        printStats(layer.duration);
+    }
+
+    outStream << "Inferences: " << info.num_inferences << std::endl;
+    outStream << "Inference time:";
+    printStats(info.inference);
+    outStream << "Utilization: DPU: " << info.dpu_utilization * 100. << "% SW: " << info.sw_utilization * 100.
+              << "% DMA: " << info.dma_utilization * 100. << "%" << std::endl;
+}
+
+void vpux::profiling::printAggregatedProfilingAsJson(const AggregatedProfilingInfo& info, std::ostream& outStream) {
+    const auto printStats = [&](const DurationStatistics& stats) {
+        outStream << "\"count\":" << stats.count << ", \"min_ns\":" << stats.min_ns << ", \"p50_ns\":" << stats.p50_ns
+                  << ", \"p90_ns\":" << stats.p90_ns << ", \"p99_ns\":" << stats.p99_ns
+                  << ", \"max_ns\":" << stats.max_ns << ", \"mean_ns\":" << stats.mean_ns;
+    };
+
+    const auto printEntries = [&](const std::vector<AggregatedEntry>& entries, bool withExecType) {
+        for (size_t i = 0; i < entries.size(); ++i) {
+            const auto& entry = entries[i];
+            outStream << "{\"name\":\"" << escapeJsonString(entry.name) << "\", \"type\":\""
+                      << escapeJsonString(entry.layer_type) << "\", ";
+            if (withExecType) {
+                outStream << "\"exec_type\":\"" << execTypeToString(entry.exec_type) << "\", ";
+            }
+            printStats(entry.duration);
+            outStream << "}" << (i + 1 != entries.size() ? "," : "") << std::endl;
+        }
+    };
+
+    outStream << std::fixed << std::setprecision(3);
+    outStream << "{\"inferences\":" << info.num_inferences << "," << std::endl;
+    outStream << "\"inference\":{";
+    printStats(info.inference);
+    outStream << "}," << std::endl;
+    outStream << "\"utilization\":{\"DPU\":" << info.dpu_utilization << ", \"SW\":" << info.sw_utilization
+              << ", \"DMA\":" << info.dma_utilization << "}," << std::endl;
+    outStream << "\"layers\":[" << std::endl;
+    printEntries(info.layers, false);
+    outStream << "]," << std::endl;
+    outStream << "\"tasks\":[" << std::endl;
+    printEntries(info.tasks, true);
+    outStream << "]" << std::endl;
+    outStream << "}" << std::endl;
+}
+
+void vpux::profiling::printHostOverheadAsText(const AggregatedHostOverhead& info, std::ostream& outStream) {
+    outStream << std::left << std::setprecision(2) << std::fixed;
+
+    for (size_t i = 0; i < info.stages.size(); ++i) {
+        const auto& stats = info.stages[i];
+        outStream << "Host stage: " << std::setw(16) << stringifyHostOverheadStage(static_cast<HostOverheadStage>(i))
+                  << "\tCount: " << std::setw(8) << stats.count << "\tMean(us): " << std::setw(10)
+                  << stats.mean_ns / 1000. << "\tP50(us): " << std::setw(10) << stats.p50_ns / 1000.
+                  << "\tP99(us): " << std::setw(10) << stats.p99_ns / 1000. << "\tMax(us): " << std::setw(10)
+                  << stats.max_ns / 1000. << std::endl;
+    }
+}
+
+void vpux::profiling::printHostOverheadAsJson(const AggregatedHostOverhead& info, std::ostream& outStream) {
+    outStream << std::fixed << std::setprecision(3);
+    outStream << "{" << std::endl;
+    for (size_t i = 0; i < info.stages.size(); ++i) {
+        const auto& stats = info.stages[i];
+        outStream << "\"" << stringifyHostOverheadStage(static_cast<HostOverheadStage>(i)) << "\":{"
+                  << "\"count\":" << stats.count << ", \"min_ns\":" << stats.min_ns << ", \"p50_ns\":" << stats.p50_ns
+                  << ", \"p90_ns\":" << stats.p90_ns << ", \"p99_ns\":" << stats.p99_ns
+                  << ", \"max_ns\":" << stats.max_ns << ", \"mean_ns\":" << stats.mean_ns << "}"
+                  << (i + 1 != info.stages.size() ? "," : "") << std::endl;
+    }
+    outStream << "}" << std::endl;
+}
@@ -0,0 +1,116 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/plugin/profiling_json.hpp"
+
+#include <cstdio>
+
+using namespace vpux::profiling;
+
+namespace {
+
+// The first tid is reserved for the process metadata
+constexpr int FIRST_TRACK_TID = 2;
+
+void writeTimestamp(std::ostream& outStream, uint64_t timestampNs) {
+    // Trace Events timestamps are in microseconds, keep nanosecond resolution without going through double
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%llu.%03u", static_cast<unsigned long long>(timestampNs / 1000),
+                  static_cast<unsigned>(timestampNs % 1000));
+    outStream << buffer;
+}
+
+}  // namespace
+
+std::string vpux::profiling::escapeJsonString(const std::string& str) {
+    std::string result;
+    result.reserve(str.size());
+    for (const auto c : str) {
+        switch (c) {
+        case '"':
+            result += "\\\"";
+            break;
+        case '\\':
+            result += "\\\\";
+            break;
+        case '\n':
+            result += "\\n";
+            break;
+        case '\t':
+            result += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buffer[8];
+                std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+                result += buffer;
+            } else {
+                result += c;
+            }
+            break;
+        }
+    }
+    return result;
+}
+
+vpux::profiling::TraceEventWriter::TraceEventWriter(std::ostream& outStream, int pid, std::string processName)
+        : _outStream(outStream), _pid(pid), _processName(std::move(processName)) {
+    _outStream << "{\"traceEvents\":[" << std::endl;
+}
+
+int vpux::profiling::TraceEventWriter::addTrack(std::string name) {
+    _trackNames.push_back(std::move(name));
+    return static_cast<int>(_trackNames.size()) - 1 + FIRST_TRACK_TID;
+}
+
+void vpux::profiling::TraceEventWriter::writeEventPrefix(const std::string& name, const std::string& category,
+                                                         const char* phase, int tid, uint64_t timestampNs) {
+    _outStream << "{\"name\":\"" << escapeJsonString(name) << "\", \"cat\":\"" << category << "\", \"ph\":\"" << phase
+               << "\", \"ts\":";
+    writeTimestamp(_outStream, timestampNs);
+    _outStream << ", \"pid\":" << _pid << ", \"tid\":" << tid;
+}
+
+void vpux::profiling::TraceEventWriter::writeComplete(const std::string& name, const std::string& category, int tid,
+                                                      uint64_t startNs, uint64_t durationNs) {
+    writeEventPrefix(name, category, "X", tid, startNs);
+    _outStream << ", \"dur\":";
+    writeTimestamp(_outStream, durationNs);
+    _outStream << ", \"args\":{}},\n";
+}
+
+void vpux::profiling::TraceEventWriter::writeFlow(const std::string& name, const std::string& category, uint64_t id,
+                                                  int srcTid, uint64_t srcNs, int dstTid, uint64_t dstNs) {
+    writeEventPrefix(name, category, "s", srcTid, srcNs);
+    _outStream << ", \"id\":" << id << "},\n";
+    // Binding to the enclosing slice makes the arrow end at the consumer slice instead of the next one
+    writeEventPrefix(name, category, "f", dstTid, dstNs);
+    _outStream << ", \"id\":" << id << ", \"bp\":\"e\"},\n";
+}
+
+void vpux::profiling::TraceEventWriter::finish() {
+    if (_finished) {
+        return;
+    }
+    _finished = true;
+
+    // Last event so far has a comma in the end, metadata items in the end make JSON correct
+    _outStream << R"({"name": "process_name", "ph": "M", "pid": )" << _pid << R"(, "tid": 1, "args": {"name" : ")"
+               << escapeJsonString(_processName) << R"("}})";
+    for (size_t ind = 0; ind < _trackNames.size(); ++ind) {
+        const auto tid = static_cast<int>(ind) + FIRST_TRACK_TID;
+        _outStream << ",\n"
+                   << R"({"name": "thread_name", "ph": "M", "pid": )" << _pid << R"(, "tid": )" << tid
+                   << R"(, "args": {"name" : ")" << escapeJsonString(_trackNames[ind]) << R"("}},)" << '\n'
+                   << R"({"name": "thread_sort_index", "ph": "M", "pid": )" << _pid << R"(, "tid": )" << tid
+                   << R"(, "args": {"sort_index" : )" << tid << "}}";
+    }
+    _outStream << "\n],\n"
+               // Hint for a classic Perfetto UI to use nanoseconds for display
+               << "\"displayTimeUnit\": \"ns\"\n"
+               << "}" << std::endl;
+}
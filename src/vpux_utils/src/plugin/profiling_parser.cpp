@@ -9,9 +9,12 @@
 #include "vpux/utils/IE/prefix.hpp"
 #include "vpux/utils/IE/profiling.hpp"
 
+#include <iterator>
 #include <map>
+#include <numeric>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 using namespace vpux::profiling;
 
@@ -77,6 +80,48 @@ struct ACTProfilingMeta {
     }
 };
 
+// Location of one raw record in the profiling buffer section together with its static task info.
+// Collected once per blob by ProfilingIndex
+struct RecordLayout {
+    std::string name;
+    std::string layerType;
+    size_t pos = 0;
+    // Position of the end timestamp, DMA only
+    size_t endPos = 0;
+    size_t clusterId = 0;
+    // Variant for DPU, tile for ActShave
+    size_t variantId = 0;
+    // DMA engine port, DMA only
+    uint32_t dmaPort = 0;
+    RawProfilingRecord::BarriersSet waitBarriers;
+    RawProfilingRecord::BarriersSet updateBarriers;
+};
+
+// Records, aggregated into one cluster or task record. Members are indices of records (clusters) in the index
+struct RecordGroup {
+    std::string name;
+    size_t clusterId = 0;
+    std::vector<size_t> members;
+};
+
+// Participant of the barrier synchronization
+struct BarrierUser {
+    ExecutorType execType;
+    const RawProfilingRecord::BarriersSet* waitBarriers;
+    const RawProfilingRecord::BarriersSet* updateBarriers;
+};
+
+// Synchronization point in terms of positions of the records in concatenation of two synchronized task groups
+struct SynchronizationPointLayout {
+    std::vector<size_t> predecessors;
+    std::vector<size_t> successors;
+};
+
+struct SynchronizationTable {
+    size_t numUsers = 0;
+    std::vector<SynchronizationPointLayout> points;
+};
+
 namespace {
 
 const double PROF_CLK_VALUE_37XX = 38.4;
@@ -150,10 +195,13 @@ BarriersSet getBarriersFromTask(const MVCNN::Task* task, bool waitBarriers) {
     return {};
 }
 
-void checkSameBarriers(const RawProfilingRecordPtr& first, const RawProfilingRecordPtr& second,
-                       bool checkWaitBarriers) {
-    auto firstBarriers = checkWaitBarriers ? first->getWaitBarriers() : first->getUpdateBarriers();
-    auto secondBarriers = checkWaitBarriers ? second->getWaitBarriers() : second->getUpdateBarriers();
+void fillTaskBarriers(RecordLayout& record, const MVCNN::Task* task) {
+    VPUX_THROW_WHEN(task->associated_barriers() == nullptr, "Task should have associated barriers");
+    record.waitBarriers = getBarriersFromTask(task, /*waitBarriers=*/true);
+    record.updateBarriers = getBarriersFromTask(task, /*waitBarriers=*/false);
+}
+
+void checkSameBarriers(const BarriersSet& firstBarriers, const BarriersSet& secondBarriers, bool checkWaitBarriers) {
     const auto intersection = RawProfilingRecord::getBarriersIntersection(firstBarriers, secondBarriers);
     bool barriersAreSame = intersection.size() == firstBarriers.size();
     if (!barriersAreSame) {
@@ -163,39 +211,35 @@ void checkSameBarriers(const RawProfilingRecordPtr& first, const RawProfilingRec
     }
 }
 
-RawProfilingRecords getRelatedTasksOfKind(
-        RawProfilingRecord::BarrierIdType barrierId,
-        const std::multimap<RawProfilingRecord::BarrierIdType, RawProfilingRecordPtr>& relatedTasks,
-        ExecutorType execKind) {
-    RawProfilingRecords tasks;
+std::vector<size_t> getRelatedTasksOfKind(RawProfilingRecord::BarrierIdType barrierId,
+                                          const std::multimap<RawProfilingRecord::BarrierIdType, size_t>& relatedTasks,
+                                          const std::vector<BarrierUser>& users, ExecutorType execKind) {
+    std::vector<size_t> tasks;
     auto range = relatedTasks.equal_range(barrierId);
     for (auto it = range.first; it != range.second; ++it) {
-        if (it->second->getExecutorType() == execKind) {
+        if (users[it->second].execType == execKind) {
             tasks.push_back(it->second);
         }
     }
     return tasks;
 }
 
-SynchronizationPointsContainer findSynchronizationPoints(const RawProfilingRecords& taskGroup1,
-                                                         const RawProfilingRecords& taskGroup2,
-                                                         SynchronizationPointKind pointKind) {
+SynchronizationTable findSynchronizationPoints(const std::vector<BarrierUser>& users,
+                                               SynchronizationPointKind pointKind) {
     using BarrierIdType = RawProfilingRecord::BarrierIdType;
-    std::multimap<BarrierIdType, RawProfilingRecordPtr> barrierPredecessors;
+    std::multimap<BarrierIdType, size_t> barrierPredecessors;
     std::set<BarrierIdType> waitBarriers;
-    std::multimap<BarrierIdType, RawProfilingRecordPtr> barrierSuccessors;
+    std::multimap<BarrierIdType, size_t> barrierSuccessors;
     std::set<BarrierIdType> updateBarriers;
 
-    for (const auto& tasksGroup : {taskGroup1, taskGroup2}) {
-        for (const auto& task : tasksGroup) {
-            for (const auto waitBarrier : task->getWaitBarriers()) {
-                barrierSuccessors.insert(std::make_pair(waitBarrier, task));
-                waitBarriers.insert(waitBarrier);
-            }
-            for (const auto updateBarrier : task->getUpdateBarriers()) {
-                barrierPredecessors.insert(std::make_pair(updateBarrier, task));
-                updateBarriers.insert(updateBarrier);
-            }
+    for (size_t userInd = 0; userInd < users.size(); ++userInd) {
+        for (const auto waitBarrier : *users[userInd].waitBarriers) {
+            barrierSuccessors.insert(std::make_pair(waitBarrier, userInd));
+            waitBarriers.insert(waitBarrier);
+        }
+        for (const auto updateBarrier : *users[userInd].updateBarriers) {
+            barrierPredecessors.insert(std::make_pair(updateBarrier, userInd));
+            updateBarriers.insert(updateBarrier);
         }
     }
 
@@ -209,15 +253,41 @@ SynchronizationPointsContainer findSynchronizationPoints(const RawProfilingRecor
 
     // Possible synchronization points occurs on covered from both directions barriers
     const auto commonBarriers = RawProfilingRecord::getBarriersIntersection(waitBarriers, updateBarriers);
-    SynchronizationPointsContainer synchronizationPoints;
+    SynchronizationTable table;
+    table.numUsers = users.size();
     for (const auto& commonBarrier : commonBarriers) {
-        RawProfilingRecords predecessors =
-                getRelatedTasksOfKind(commonBarrier, barrierPredecessors, predecessorExecType);
-        RawProfilingRecords successors = getRelatedTasksOfKind(commonBarrier, barrierSuccessors, successorExecType);
+        auto predecessors = getRelatedTasksOfKind(commonBarrier, barrierPredecessors, users, predecessorExecType);
+        auto successors = getRelatedTasksOfKind(commonBarrier, barrierSuccessors, users, successorExecType);
         if (!predecessors.empty() && !successors.empty()) {
-            synchronizationPoints.push_back(std::make_pair(predecessors, successors));
+            table.points.push_back({std::move(predecessors), std::move(successors)});
         }
     }
+    return table;
+}
+
+// Resolves the synchronization points against the records of one profiling buffer. Tables, which refer to the records
+// filtered out during decoding, produce no synchronization points
+SynchronizationPointsContainer getSynchronizationPoints(const SynchronizationTable& table,
+                                                        const RawProfilingRecords& taskGroup1,
+                                                        const RawProfilingRecords& taskGroup2) {
+    if (taskGroup1.size() + taskGroup2.size() != table.numUsers) {
+        return {};
+    }
+
+    const auto getRecords = [&](const std::vector<size_t>& indices) {
+        RawProfilingRecords records;
+        records.reserve(indices.size());
+        for (const auto ind : indices) {
+            records.push_back(ind < taskGroup1.size() ? taskGroup1[ind] : taskGroup2[ind - taskGroup1.size()]);
+        }
+        return records;
+    };
+
+    SynchronizationPointsContainer synchronizationPoints;
+    synchronizationPoints.reserve(table.points.size());
+    for (const auto& point : table.points) {
+        synchronizationPoints.push_back(std::make_pair(getRecords(point.predecessors), getRecords(point.successors)));
+    }
     return synchronizationPoints;
 }
 
@@ -254,8 +324,7 @@ std::vector<RawProfilingRecord::TimeType> getBarrierShiftEstimations(const Synch
 
 // Function return difference as delta = DMA - other, so later we can just add delta to convert from Other(DPU/UPA) to
 // DMA timer
-llvm::Optional<int64_t> getDMA2OtherTimersShift(const RawProfilingRecords& dmaTasks,
-                                                const RawProfilingRecords& otherTasks,
+llvm::Optional<int64_t> getDMA2OtherTimersShift(const SynchronizationPointsContainer& syncPoints,
                                                 FrequenciesSetup frequenciesSetup, SynchronizationPointKind pointKind,
                                                 vpux::Logger& log) {
     const auto inverseAlgorithm = pointKind == SynchronizationPointKind::DPU_TO_DMA;
@@ -265,7 +334,6 @@ llvm::Optional<int64_t> getDMA2OtherTimersShift(const RawProfilingRecords& dmaTa
     VPUX_THROW_WHEN(inverseAlgorithm, "DPU2DMA algorithm is disabled");
     using TimeType = RawProfilingRecord::TimeType;
 
-    const auto syncPoints = findSynchronizationPoints(dmaTasks, otherTasks, pointKind);
     if (syncPoints.empty()) {
         log.warning("Cannot find synchronization points for timers shift estimation. Tasks will be aligned on zero.");
         return llvm::None;
@@ -292,6 +360,7 @@ llvm::Optional<int64_t> getDMA2OtherTimersShift(const RawProfilingRecords& dmaTa
     return timersShift;
 }
 
+
 double computeVariance(const std::vector<double>& vec) {
     const auto N = vec.size();
     const double mean = std::accumulate(vec.begin(), vec.end(), 0.) / N;
@@ -364,7 +433,8 @@ FrequenciesSetup findFrequencyForBidirAlg(const SynchronizationPointsContainer&
             PROF_CLK_VALUE_37XX, DMA27Bandwidth};
 }
 
-FrequenciesSetup findFrequencySetup37XX(const RawProfilingRecords& dmaTasks, const RawProfilingRecords& dpuTasks,
+FrequenciesSetup findFrequencySetup37XX(const SynchronizationPointsContainer& dma2dpuSyncPoints,
+                                        const SynchronizationPointsContainer& dpu2dmaSyncPoints,
                                         SynchronizationAlgorithKind algKind) {
     std::map<SynchronizationAlgorithKind, std::string> alg2str = {
             {SynchronizationAlgorithKind::BIDIR_MEAN, "BIDIR_MEAN"},
@@ -380,22 +450,20 @@ FrequenciesSetup findFrequencySetup37XX(const RawProfilingRecords& dmaTasks, con
             algKind == SynchronizationAlgorithKind::DPU_TO_DMA || algKind == SynchronizationAlgorithKind::DMA_TO_DPU;
 
     if (!isOneWayAlg) {
-        const auto dpu2dmaSyncPoints =
-                findSynchronizationPoints(dmaTasks, dpuTasks, SynchronizationPointKind::DPU_TO_DMA);
         if (dpu2dmaSyncPoints.empty()) {
             log.trace("Cannot use {0} algorithm because of lack of synchronization points of DPU2DMA kind. "
                       "DMA2DPU algorith will be used instead.",
                       alg2str[algKind]);
-            return findFrequencySetup37XX(dmaTasks, dpuTasks, SynchronizationAlgorithKind::DMA_TO_DPU);
+            return findFrequencySetup37XX(dma2dpuSyncPoints, dpu2dmaSyncPoints,
+                                          SynchronizationAlgorithKind::DMA_TO_DPU);
         }
 
-        const auto dma2dpuSyncPoints =
-                findSynchronizationPoints(dmaTasks, dpuTasks, SynchronizationPointKind::DMA_TO_DPU);
         if (dma2dpuSyncPoints.empty()) {
             log.trace("Cannot use {0} algorithm because of lack of synchronization points of DMA2DPU kind. "
                       "DPU2DMA algorith will be used instead.",
                       alg2str[algKind]);
-            return findFrequencySetup37XX(dmaTasks, dpuTasks, SynchronizationAlgorithKind::DPU_TO_DMA);
+            return findFrequencySetup37XX(dma2dpuSyncPoints, dpu2dmaSyncPoints,
+                                          SynchronizationAlgorithKind::DPU_TO_DMA);
         }
 
         const auto finalFreq = findFrequencyForBidirAlg(dma2dpuSyncPoints, dpu2dmaSyncPoints, algKind, nestedLog);
@@ -403,10 +471,8 @@ FrequenciesSetup findFrequencySetup37XX(const RawProfilingRecords& dmaTasks, con
                   finalFreq.vpuClk / PLL_VPU_FREQUENCY_SCALE_37XX);
         return finalFreq;
     }
-    const auto syncPointKind = algKind == SynchronizationAlgorithKind::DPU_TO_DMA
-                                       ? SynchronizationPointKind::DPU_TO_DMA
-                                       : SynchronizationPointKind::DMA_TO_DPU;
-    const auto syncPoints = findSynchronizationPoints(dmaTasks, dpuTasks, syncPointKind);
+    const auto& syncPoints =
+            algKind == SynchronizationAlgorithKind::DPU_TO_DMA ? dpu2dmaSyncPoints : dma2dpuSyncPoints;
     return findFrequencySetup37XXFromSyncPoints(syncPoints, nestedLog).first;
 }
 
@@ -419,6 +485,22 @@ void fillTaskInfoWithParsedRawRecords(std::vector<TaskInfo>& vec,
     }
 }
 
+// Barriers are reported for the aggregated tasks only, so each dependency is shown once
+template <class InnerType>
+void fillScheduleInfoWithParsedRawRecords(std::vector<TaskScheduleInfo>& vec,
+                                          const std::vector<std::shared_ptr<InnerType>>& rawTasks, bool withBarriers) {
+    for (const auto& task : rawTasks) {
+        TaskScheduleInfo info;
+        if (withBarriers) {
+            const auto& waitBarriers = task->getWaitBarriers();
+            const auto& updateBarriers = task->getUpdateBarriers();
+            info.wait_barriers.assign(waitBarriers.begin(), waitBarriers.end());
+            info.update_barriers.assign(updateBarriers.begin(), updateBarriers.end());
+        }
+        vec.push_back(std::move(info));
+    }
+}
+
 bool minStartTimeTaskComparator(const TaskInfo& a, const TaskInfo& b) {
     return a.start_time_ns < b.start_time_ns;
 };
@@ -627,11 +709,20 @@ static double getNceFreq(const MVCNN::GraphFile* graphFile) {
     return frcSpeedMhz;
 }
 
-static std::map<ExecutorType, std::pair<uint32_t, uint32_t>> getProfilingOffsets(const MVCNN::GraphFile* graphFile,
-                                                                                 size_t actualBufferSize) {
+static const MVCNN::TensorReference* getProfilingOutput(const MVCNN::GraphFile* graphFile) {
     auto profilingOutputs = graphFile->header()->profiling_output();
     VPUX_THROW_UNLESS(profilingOutputs, "Blob contains no profiling_output");
     VPUX_THROW_UNLESS(profilingOutputs->size() == 1, "Blob must contain exactly one profiling output");
+    return profilingOutputs->Get(0);
+}
+
+static uint32_t getProfilingBufferSize(const MVCNN::GraphFile* graphFile) {
+    // Profiling buffer size is defined as tensor of shape <Nxui32>
+    return static_cast<uint32_t>(getProfilingOutput(graphFile)->dimensions()->Get(0) * sizeof(uint32_t));
+}
+
+static std::map<ExecutorType, std::pair<uint32_t, uint32_t>> getProfilingOffsets(const MVCNN::GraphFile* graphFile,
+                                                                                 size_t actualBufferSize) {
 
     const std::map<std::string, ExecutorType> converter{{"dma", ExecutorType::DMA},
                                                         {"dpu", ExecutorType::DPU},
@@ -639,10 +730,8 @@ static std::map<ExecutorType, std::pair<uint32_t, uint32_t>> getProfilingOffsets
                                                         {"actshave", ExecutorType::ACTSHAVE}};
 
     const char delimiter = '_';
-    auto* profBuffer = profilingOutputs->Get(0);
-    const std::string outputName = profBuffer->name()->str();
-    // Profiling buffer size is defined as tensor of shape <Nxui32>
-    const auto profSize = profBuffer->dimensions()->Get(0) * sizeof(uint32_t);
+    const std::string outputName = getProfilingOutput(graphFile)->name()->str();
+    const auto profSize = getProfilingBufferSize(graphFile);
     VPUX_THROW_WHEN(actualBufferSize < profSize,
                     "Actual buffer size is smaller than calculated. Expected {0}, but got {1}", profSize,
                     actualBufferSize);
@@ -803,17 +892,13 @@ static std::vector<DebugInfo> parseDebugDMATaskProfiling(
     return profInfo;
 }
 
-static void parseDMATaskProfiling(RawProfilingRecords& rawRecords,
-                                  const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* dmaTaskList,
-                                  const void* output, size_t outputLen, MVCNN::TargetDevice device) {
+static void indexDMATasks(std::vector<RecordLayout>& records,
+                          const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* dmaTaskList, size_t outputLen,
+                          MVCNN::TargetDevice device) {
     if (dmaTaskList == nullptr) {
         return;
     }
 
-    uint64_t overflowShift = 0;
-    uint32_t lastTime = 0;
-
-    std::vector<TaskInfo> profInfo;
     size_t totalDmaTasks = 0;
     if (device != MVCNN::TargetDevice::TargetDevice_VPUX37XX) {
         totalDmaTasks = outputLen / sizeof(uint32_t);
@@ -823,8 +908,7 @@ static void parseDMATaskProfiling(RawProfilingRecords& rawRecords,
 
     BarriersSet lastProfilingRecordWaitBarriers;
     uint32_t foundDmaTasks = 0;
-    for (unsigned dmaTaskListId = 0; dmaTaskListId < (*dmaTaskList).size(); dmaTaskListId++) {
-        auto task = (*dmaTaskList)[dmaTaskListId];
+    for (const auto& task : *dmaTaskList) {
         if ((task->task_as_NNDMATask()->src()->name()->str() == "profilingInput:0") ||
             (task->task_as_NNDMATask()->src()->locale() == MVCNN::MemoryLocation_AbsoluteAddr)) {
             auto taskName = task->name()->str();
@@ -833,38 +917,20 @@ static void parseDMATaskProfiling(RawProfilingRecords& rawRecords,
 
             if ((profilingMeta[2] != "PROFTASKBEGIN") && (profilingMeta[2] != "PROFBEGIN")) {
                 foundDmaTasks += 2;
-                unsigned layerNumber = 0;
-
-                layerNumber = stoi(profilingMeta[2]);
-                unsigned lastDMAid = stoi(profilingMeta[1]);
-                auto currentDMAid = layerNumber * 2 - 1;
-
-                taskName = taskName.substr(0, taskName.find("_PROF"));
-                const auto updateBarriers = getBarriersFromTask(task, /*waitBarriers=*/false);
-
-                VPUX_THROW_UNLESS((currentDMAid < totalDmaTasks) && (lastDMAid < totalDmaTasks),
+                const unsigned layerNumber = stoi(profilingMeta[2]);
+
+                RecordLayout record;
+                record.name = taskName.substr(0, taskName.find("_PROF"));
+                record.pos = stoi(profilingMeta[1]);
+                record.endPos = layerNumber * 2 - 1;
+                record.waitBarriers = lastProfilingRecordWaitBarriers;
+                record.updateBarriers = getBarriersFromTask(task, /*waitBarriers=*/false);
+                // Timestamp DMA is executed by the same port as the profiled one
+                record.dmaPort = task->task_as_NNDMATask()->port();
+
+                VPUX_THROW_UNLESS((record.endPos < totalDmaTasks) && (record.pos < totalDmaTasks),
                                   "Can't process DMA profiling data.");
-                if (device != MVCNN::TargetDevice::TargetDevice_VPUX37XX) {
-                    auto outputBin = reinterpret_cast<const uint32_t*>(output);
-
-                    // Catch overflow and increase overflow shift for absolute start time
-                    if (lastTime > 0x7F000000 && outputBin[lastDMAid] < 0x7F000000) {
-                        overflowShift += 0x100000000;
-                    }
-                    lastTime = outputBin[lastDMAid];
-
-                    rawRecords.push_back(std::make_shared<RawProfilingDMA20Record>(
-                            outputBin[lastDMAid], outputBin[currentDMAid], taskName, lastProfilingRecordWaitBarriers,
-                            updateBarriers, overflowShift));
-                } else {
-                    if ((currentDMAid >= outputLen / sizeof(uint64_t)) || (lastDMAid >= outputLen / sizeof(uint64_t))) {
-                        continue;
-                    }
-                    auto outputBin = reinterpret_cast<const uint64_t*>(output);
-                    rawRecords.push_back(std::make_shared<RawProfilingDMA27Record>(
-                            outputBin[lastDMAid], outputBin[currentDMAid], taskName, lastProfilingRecordWaitBarriers,
-                            updateBarriers));
-                }
+                records.push_back(std::move(record));
             } else {
                 lastProfilingRecordWaitBarriers = getBarriersFromTask(task, /*waitBarriers=*/true);
             }
@@ -873,6 +939,36 @@ static void parseDMATaskProfiling(RawProfilingRecords& rawRecords,
     VPUX_THROW_UNLESS(totalDmaTasks == foundDmaTasks, "Unexpected number of DMA tasks in profiling data");
 }
 
+static void decodeDMARecords(RawProfilingRecords& rawRecords, const std::vector<RecordLayout>& layouts,
+                             const void* output, MVCNN::TargetDevice device) {
+    rawRecords.reserve(rawRecords.size() + layouts.size());
+
+    if (device != MVCNN::TargetDevice::TargetDevice_VPUX37XX) {
+        auto outputBin = reinterpret_cast<const uint32_t*>(output);
+        uint64_t overflowShift = 0;
+        uint32_t lastTime = 0;
+
+        for (const auto& layout : layouts) {
+            // Catch overflow and increase overflow shift for absolute start time
+            if (lastTime > 0x7F000000 && outputBin[layout.pos] < 0x7F000000) {
+                overflowShift += 0x100000000;
+            }
+            lastTime = outputBin[layout.pos];
+
+            rawRecords.push_back(std::make_shared<RawProfilingDMA20Record>(
+                    outputBin[layout.pos], outputBin[layout.endPos], layout.name, layout.waitBarriers,
+                    layout.updateBarriers, overflowShift));
+        }
+    } else {
+        auto outputBin = reinterpret_cast<const uint64_t*>(output);
+        for (const auto& layout : layouts) {
+            rawRecords.push_back(std::make_shared<RawProfilingDMA27Record>(
+                    outputBin[layout.pos], outputBin[layout.endPos], layout.name, layout.waitBarriers,
+                    layout.updateBarriers));
+        }
+    }
+}
+
 static std::vector<DebugInfo> parseDebugUPATaskProfiling(
         const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* upaTaskList, const void* output,
         size_t outputLen) {
@@ -914,19 +1010,17 @@ static std::vector<DebugInfo> parseDebugUPATaskProfiling(
     return profInfo;
 }
 
-static void parseUPATaskProfiling(RawProfilingRecords& rawRecords,
-                                  const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* upaTaskList,
-                                  const void* output, size_t outputLen) {
+static void indexUPATasks(std::vector<RecordLayout>& records,
+                          const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* upaTaskList,
+                          size_t outputLen) {
     if (upaTaskList == nullptr) {
         return;
     }
 
-    auto outputUpa = reinterpret_cast<const UpaData_t*>(output);
     const size_t totalUpaTasks = outputLen / sizeof(UpaData_t);
     size_t foundUpaTasks = 0;
 
-    for (unsigned upaTaskListId = 0; upaTaskListId < upaTaskList->size(); upaTaskListId++) {
-        auto task = (*upaTaskList)[upaTaskListId];
+    for (const auto& task : *upaTaskList) {
         auto taskName = task->name()->str();
         std::string profilingMeta[2];
         getProfilingMeta(taskName, 2, profilingMeta);
@@ -936,27 +1030,39 @@ static void parseUPATaskProfiling(RawProfilingRecords& rawRecords,
             if (!taskName.empty() && taskName[taskName.length() - 1] == '/') {
                 taskName.pop_back();
             }
-            unsigned currentPos = stoi(profilingMeta[1]);
-            VPUX_THROW_UNLESS(currentPos < outputLen / sizeof(UpaData_t),
-                              "Unexpected end of blob in UPA profiling data.");
+
+            RecordLayout record;
+            record.name = taskName;
+            record.pos = stoi(profilingMeta[1]);
+            VPUX_THROW_UNLESS(record.pos < totalUpaTasks, "Unexpected end of blob in UPA profiling data.");
             foundUpaTasks++;
 
             auto softLayer = task->task_as_UPALayerTask();
-            std::string layerName;
             if (softLayer != nullptr) {
                 const char* typeName = EnumNameSoftwareLayerParams(softLayer->softLayerParams_type());
                 if (typeName != nullptr) {
-                    layerName = typeName;
+                    record.layerType = typeName;
                 }
             }
-            rawRecords.push_back(
-                    std::make_shared<RawProfilingUPARecord>(outputUpa[currentPos], taskName, task, layerName));
-            std::dynamic_pointer_cast<ThrowableAssertMixin>(rawRecords.back())->checkDataOrDie();
+            fillTaskBarriers(record, task);
+            records.push_back(std::move(record));
         }
     }
     VPUX_THROW_UNLESS(totalUpaTasks == foundUpaTasks, "Unexpected number of UPA tasks in profiling data");
 }
 
+static void decodeUPARecords(RawProfilingRecords& rawRecords, const std::vector<RecordLayout>& layouts,
+                             const void* output) {
+    auto outputUpa = reinterpret_cast<const UpaData_t*>(output);
+    rawRecords.reserve(rawRecords.size() + layouts.size());
+
+    for (const auto& layout : layouts) {
+        rawRecords.push_back(std::make_shared<RawProfilingUPARecord>(
+                outputUpa[layout.pos], layout.name, layout.waitBarriers, layout.updateBarriers, layout.layerType));
+        std::dynamic_pointer_cast<ThrowableAssertMixin>(rawRecords.back())->checkDataOrDie();
+    }
+}
+
 static std::vector<DebugInfo> parseDebugActShaveTaskProfiling(
         const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* shaveTaskList, const void* output,
         size_t outputLen) {
@@ -995,14 +1101,13 @@ static std::vector<DebugInfo> parseDebugActShaveTaskProfiling(
     return profInfo;
 }
 
-static void parseActShaveTaskProfiling(RawProfilingRecords& rawRecords,
-                                       const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* shaveTaskList,
-                                       const void* output, size_t outputLen) {
+static void indexActShaveTasks(std::vector<RecordLayout>& records,
+                               const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* shaveTaskList,
+                               size_t outputLen) {
     if (shaveTaskList == nullptr) {
         return;
     }
 
-    const ActShaveData_t* outputShave = reinterpret_cast<const ActShaveData_t*>(output);
     const size_t numOfActShaveTasks = outputLen / sizeof(ActShaveData_t);
     size_t foundActShaveTasks = 0;
 
@@ -1013,19 +1118,35 @@ static void parseActShaveTaskProfiling(RawProfilingRecords& rawRecords,
 
         if (maybeActMeta.hasValue()) {
             const auto actMeta = maybeActMeta.getValue();
-            size_t currentPos = actMeta.getResultingDDROffset();
 
-            VPUX_THROW_UNLESS(currentPos < numOfActShaveTasks, "Unexpected end of blob in ACT section.");
-            foundActShaveTasks++;
-            rawRecords.push_back(std::make_shared<RawProfilingACTRecord>(outputShave[currentPos], actMeta.taskName,
-                                                                         task, actMeta.clusterId, actMeta.tileId));
+            RecordLayout record;
+            record.name = actMeta.taskName;
+            record.pos = actMeta.getResultingDDROffset();
+            record.clusterId = actMeta.clusterId;
+            record.variantId = actMeta.tileId;
 
-            std::dynamic_pointer_cast<ThrowableAssertMixin>(rawRecords.back())->checkDataOrDie();
+            VPUX_THROW_UNLESS(record.pos < numOfActShaveTasks, "Unexpected end of blob in ACT section.");
+            foundActShaveTasks++;
+            fillTaskBarriers(record, task);
+            records.push_back(std::move(record));
         }
     }
     VPUX_THROW_UNLESS(foundActShaveTasks == shaveTaskList->size(), "All ActShave tasks should be profiled");
 }
 
+static void decodeActShaveRecords(RawProfilingRecords& rawRecords, const std::vector<RecordLayout>& layouts,
+                                  const void* output) {
+    const ActShaveData_t* outputShave = reinterpret_cast<const ActShaveData_t*>(output);
+    rawRecords.reserve(rawRecords.size() + layouts.size());
+
+    for (const auto& layout : layouts) {
+        rawRecords.push_back(std::make_shared<RawProfilingACTRecord>(outputShave[layout.pos], layout.name,
+                                                                     layout.waitBarriers, layout.updateBarriers,
+                                                                     layout.clusterId, layout.variantId));
+        std::dynamic_pointer_cast<ThrowableAssertMixin>(rawRecords.back())->checkDataOrDie();
+    }
+}
+
 static std::vector<DebugInfo> parseDebugDPUTaskProfiling(
         const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* dpuTaskList, const void* output, size_t outputLen,
         MVCNN::TargetDevice device) {
@@ -1073,9 +1194,9 @@ static std::vector<DebugInfo> parseDebugDPUTaskProfiling(
     return profInfo;
 }
 
-static void parseDPUTaskProfiling(RawProfilingRecords& rawRecords,
-                                  const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* dpuTaskList,
-                                  const void* output, size_t outputLen, MVCNN::TargetDevice device) {
+static void indexDPUTasks(std::vector<RecordLayout>& records,
+                          const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* dpuTaskList, size_t outputLen,
+                          MVCNN::TargetDevice device) {
     if (dpuTaskList == nullptr) {
         return;
     }
@@ -1089,31 +1210,26 @@ static void parseDPUTaskProfiling(RawProfilingRecords& rawRecords,
         profilingMeta.emplace(meta.getOrderDescriptor(), meta);
     }
 
-    unsigned currentPos = 0;
-    std::map<std::string, TaskInfo> profInfoAggregator;
+    const auto isHwp = device == MVCNN::TargetDevice::TargetDevice_VPUX37XX;
+    const size_t numOfDpuEntries = outputLen / (isHwp ? sizeof(HwpDpuMode0Data_t) : sizeof(SwDpuData_t));
 
+    unsigned currentPos = 0;
     for (const auto& iter : profilingMeta) {
-        const auto metaData = iter.second;
+        const auto& metaData = iter.second;
         const auto task = (*dpuTaskList)[metaData.taskId];
 
         for (auto variantId = 0; variantId < metaData.maxVariants; variantId++) {
             if (variantId < metaData.numVariants) {
-                if (device == MVCNN::TargetDevice::TargetDevice_VPUX37XX) {
-                    VPUX_THROW_WHEN(currentPos >= outputLen / sizeof(HwpDpuMode0Data_t),
-                                    "HWP profiling index is out of range");
-
-                    const HwpDpuMode0Data_t outputDpu = reinterpret_cast<const HwpDpuMode0Data_t*>(output)[currentPos];
-                    rawRecords.push_back(std::make_shared<RawProfilingDPUHW27Record>(outputDpu, metaData.taskName, task,
-                                                                                     metaData.clusterId, variantId));
-                } else {
-                    VPUX_THROW_WHEN(currentPos >= outputLen / sizeof(SwDpuData_t),
-                                    "SW profiling index is out of range");
-
-                    const SwDpuData_t outputDpu = reinterpret_cast<const SwDpuData_t*>(output)[currentPos];
-                    rawRecords.push_back(std::make_shared<RawProfilingDPUSWRecord>(outputDpu, metaData.taskName, task,
-                                                                                   metaData.clusterId, variantId));
-                }
-                std::dynamic_pointer_cast<ThrowableAssertMixin>(rawRecords.back())->checkDataOrDie();
+                VPUX_THROW_WHEN(currentPos >= numOfDpuEntries, "{0} profiling index is out of range",
+                                isHwp ? "HWP" : "SW");
+
+                RecordLayout record;
+                record.name = metaData.taskName;
+                record.pos = currentPos;
+                record.clusterId = metaData.clusterId;
+                record.variantId = variantId;
+                fillTaskBarriers(record, task);
+                records.push_back(std::move(record));
             }
             // continue increment of currentPos to walk over non-used data
             ++currentPos;
@@ -1121,6 +1237,26 @@ static void parseDPUTaskProfiling(RawProfilingRecords& rawRecords,
     }
 }
 
+static void decodeDPURecords(RawProfilingRecords& rawRecords, const std::vector<RecordLayout>& layouts,
+                             const void* output, MVCNN::TargetDevice device) {
+    rawRecords.reserve(rawRecords.size() + layouts.size());
+
+    for (const auto& layout : layouts) {
+        if (device == MVCNN::TargetDevice::TargetDevice_VPUX37XX) {
+            const HwpDpuMode0Data_t outputDpu = reinterpret_cast<const HwpDpuMode0Data_t*>(output)[layout.pos];
+            rawRecords.push_back(std::make_shared<RawProfilingDPUHW27Record>(outputDpu, layout.name,
+                                                                             layout.waitBarriers, layout.updateBarriers,
+                                                                             layout.clusterId, layout.variantId));
+        } else {
+            const SwDpuData_t outputDpu = reinterpret_cast<const SwDpuData_t*>(output)[layout.pos];
+            rawRecords.push_back(std::make_shared<RawProfilingDPUSWRecord>(outputDpu, layout.name, layout.waitBarriers,
+                                                                           layout.updateBarriers, layout.clusterId,
+                                                                           layout.variantId));
+        }
+        std::dynamic_pointer_cast<ThrowableAssertMixin>(rawRecords.back())->checkDataOrDie();
+    }
+}
+
 std::vector<DebugInfo> vpux::profiling::getTaskInfoInDebugMode(const uint8_t* blobData, size_t blobSize,
                                                                const uint8_t* profData, size_t profSize,
                                                                TaskType type) {
@@ -1199,75 +1335,167 @@ std::vector<DebugInfo> vpux::profiling::getTaskInfoInDebugMode(const uint8_t* bl
     return rawProfTask;
 }
 
-ClusterTaskArray groupClusterTasks(const RawProfilingRecords& rawTasks) {
-    ClusterTaskArray clusterInfoTasks;
-
-    // Grouping of variants into one invariant
-    std::multimap<std::pair<std::string, size_t>, RawProfilingRecordPtr> groupedClustersInfo;
-    for (const auto task : rawTasks) {
-        const auto clusterId = std::dynamic_pointer_cast<ClusteredAndTiledMixin>(task)->getClusterId();
-        const auto key = std::make_pair(task->getRawName(), clusterId);
-        groupedClustersInfo.insert(std::make_pair(key, task));
+// Grouping of variants into one invariant
+static std::vector<RecordGroup> groupRecordsByCluster(const std::vector<RecordLayout>& records) {
+    std::multimap<std::pair<std::string, size_t>, size_t> groupedClustersInfo;
+    for (size_t recordInd = 0; recordInd < records.size(); ++recordInd) {
+        const auto key = std::make_pair(records[recordInd].name, records[recordInd].clusterId);
+        groupedClustersInfo.insert(std::make_pair(key, recordInd));
     }
 
+    std::vector<RecordGroup> clusters;
     auto it = groupedClustersInfo.cbegin();
     while (it != groupedClustersInfo.cend()) {
-        RawProfilingRecords variants;
         const auto groupingKey = it->first;
-        std::string name = groupingKey.first;
-        const auto clusterId = groupingKey.second;
-        const auto execType = it->second->getExecutorType();
 
+        RecordGroup cluster;
+        cluster.name = groupingKey.first;
+        cluster.clusterId = groupingKey.second;
         while (it != groupedClustersInfo.cend() && it->first == groupingKey) {
-            variants.push_back(it->second);
+            cluster.members.push_back(it->second);
             ++it;
         }
-        clusterInfoTasks.push_back(std::make_shared<InvariantRawRecord>(name, clusterId, variants, execType));
+        clusters.push_back(std::move(cluster));
     }
 
-    return clusterInfoTasks;
+    return clusters;
+}
+
+// Grouping of invariants to one NCE Task
+static std::vector<RecordGroup> groupClustersByName(const std::vector<RecordGroup>& clusters,
+                                                    const std::vector<RecordLayout>& records) {
+    std::multimap<std::string, size_t> groupedTasksInfo;
+    for (size_t clusterInd = 0; clusterInd < clusters.size(); ++clusterInd) {
+        groupedTasksInfo.insert(std::make_pair(clusters[clusterInd].name, clusterInd));
+    }
+
+    // Barriers of the invariant are the barriers of its first variant
+    const auto getClusterRecord = [&](size_t clusterInd) -> const RecordLayout& {
+        return records[clusters[clusterInd].members.front()];
+    };
+
+    std::vector<RecordGroup> tasks;
+    auto it = groupedTasksInfo.cbegin();
+    while (it != groupedTasksInfo.cend()) {
+        RecordGroup task;
+        task.name = it->first;
+        while (it != groupedTasksInfo.cend() && it->first == task.name) {
+            task.members.push_back(it->second);
+            ++it;
+
+            const auto& first = getClusterRecord(task.members.front());
+            const auto& last = getClusterRecord(task.members.back());
+            checkSameBarriers(first.waitBarriers, last.waitBarriers, /*checkWaitBarriers=*/true);
+            checkSameBarriers(first.updateBarriers, last.updateBarriers, /*checkWaitBarriers=*/false);
+        }
+        tasks.push_back(std::move(task));
+    }
+    return tasks;
 }
 
-RawProfilingRecords groupTasks(const ClusterTaskArray& clusterInfoTasks) {
-    RawProfilingRecords dpuInfoTasks;
+static void appendBarrierUsers(std::vector<BarrierUser>& users, ExecutorType execType,
+                               const std::vector<RecordLayout>& records) {
+    for (const auto& record : records) {
+        users.push_back({execType, &record.waitBarriers, &record.updateBarriers});
+    }
+}
+
+static void appendBarrierUsers(std::vector<BarrierUser>& users, ExecutorType execType,
+                               const std::vector<RecordGroup>& tasks, const std::vector<RecordGroup>& clusters,
+                               const std::vector<RecordLayout>& records) {
+    for (const auto& task : tasks) {
+        const auto& record = records[clusters[task.members.front()].members.front()];
+        users.push_back({execType, &record.waitBarriers, &record.updateBarriers});
+    }
+}
 
-    // Grouping of invariants to one NCE Task
-    std::multimap<std::string, std::shared_ptr<ArrayRecord>> groupedDPUTasksInfo;
-    for (const auto task : clusterInfoTasks) {
-        groupedDPUTasksInfo.insert(std::make_pair(task->getRawName(), task));
+// Records are decoded for the whole section at once or not decoded at all (filtered out by the task type)
+static ClusterTaskArray buildClusterRecords(const std::vector<RecordGroup>& clusters,
+                                            const RawProfilingRecords& rawTasks) {
+    if (rawTasks.empty()) {
+        return {};
     }
-    auto it = groupedDPUTasksInfo.cbegin();
-    while (it != groupedDPUTasksInfo.cend()) {
-        ClusterTaskArray clusters;
+
+    ClusterTaskArray clusterInfoTasks;
+    clusterInfoTasks.reserve(clusters.size());
+    for (const auto& cluster : clusters) {
         RawProfilingRecords variants;
+        variants.reserve(cluster.members.size());
+        for (const auto recordInd : cluster.members) {
+            variants.push_back(rawTasks[recordInd]);
+        }
+        const auto execType = variants.front()->getExecutorType();
+        clusterInfoTasks.push_back(
+                std::make_shared<InvariantRawRecord>(cluster.name, cluster.clusterId, variants, execType));
+    }
+    return clusterInfoTasks;
+}
 
-        const auto groupingKey = it->first;
-        const auto execType = it->second->getExecutorType();
-        while (it != groupedDPUTasksInfo.cend() && it->first == groupingKey) {
-            clusters.push_back(it->second);
-            ++it;
+static RawProfilingRecords buildTaskRecords(const std::vector<RecordGroup>& tasks,
+                                            const ClusterTaskArray& clusterInfoTasks) {
+    if (clusterInfoTasks.empty()) {
+        return {};
+    }
 
-            const auto first = clusters.front();
-            const auto last = clusters.back();
-            checkSameBarriers(first, last, /*checkWaitBarriers=*/true);
-            checkSameBarriers(first, last, /*checkWaitBarriers=*/false);
-            const auto newVariants = last->getArray();
+    RawProfilingRecords taskInfoTasks;
+    taskInfoTasks.reserve(tasks.size());
+    for (const auto& task : tasks) {
+        RawProfilingRecords variants;
+        for (const auto clusterInd : task.members) {
+            const auto newVariants = clusterInfoTasks[clusterInd]->getArray();
             variants.insert(variants.end(), newVariants.begin(), newVariants.end());
         }
-        dpuInfoTasks.push_back(std::make_shared<ArrayRecord>(groupingKey, variants, execType));
+        const auto execType = clusterInfoTasks[task.members.front()]->getExecutorType();
+        taskInfoTasks.push_back(std::make_shared<ArrayRecord>(task.name, variants, execType));
     }
-    return dpuInfoTasks;
+    return taskInfoTasks;
 }
 
+//
+// ProfilingIndex::Layout
+//
+
+struct vpux::profiling::ProfilingIndex::Layout final {
+    MVCNN::TargetDevice device{};
+    // Profiling counter frequency for platforms, where it doesn't depend on the runtime PLL value
+    double nceFreq = 0;
+
+    uint32_t profilingBufferSize = 0;
+    std::map<ExecutorType, std::pair<uint32_t, uint32_t>> sections;
+
+    std::vector<RecordLayout> dmaRecords;
+    std::vector<RecordLayout> dpuRecords;
+    std::vector<RecordLayout> swRecords;
+    ExecutorType swExecutorType = ExecutorType::NONE;
+
+    std::vector<RecordGroup> dpuClusters;
+    std::vector<RecordGroup> dpuTasks;
+
+    // ActShave tasks may be tiled over the clusters, so they are grouped the same way as DPU tasks
+    bool swTasksMayBeTiled = false;
+    std::vector<RecordGroup> swClusters;
+    std::vector<RecordGroup> swTasks;
+
+    // Synchronization points between DMA records and aggregated DPU tasks
+    SynchronizationTable dma2dpuSyncTable;
+    SynchronizationTable dpu2dmaSyncTable;
+    // Synchronization points between DMA records and raw SW records
+    SynchronizationTable dma2upaSyncTable;
+};
+
 // At parse time we don't know frequency for some platforms, so data is collected in cycles format. We need to determine
 // frequency to convert from cycles to nanoseconds
-std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawTasksContainer& rawTasks, const MVCNN::GraphFile* graphFile,
-                                                bool fpga, VerbosityLevel verbosity) {
+static std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawTasksContainer& rawTasks,
+                                                       const ProfilingIndex::Layout& layout, bool fpga,
+                                                       VerbosityLevel verbosity,
+                                                       std::vector<TaskScheduleInfo>* schedule) {
     auto log = vpux::Logger::global();
-    const auto device = graphFile->header()->device();
+    const auto device = layout.device;
+
+    ClusterTaskArray dpuClusterInfoTasks = buildClusterRecords(layout.dpuClusters, rawTasks.dpuTasks);
+    RawProfilingRecords dpuInfoTasks = buildTaskRecords(layout.dpuTasks, dpuClusterInfoTasks);
 
-    ClusterTaskArray dpuClusterInfoTasks = groupClusterTasks(rawTasks.dpuTasks);
-    RawProfilingRecords dpuInfoTasks = groupTasks(dpuClusterInfoTasks);
+    const auto dma2dpuSyncPoints = getSynchronizationPoints(layout.dma2dpuSyncTable, rawTasks.dmaTasks, dpuInfoTasks);
 
     FrequenciesSetup frequenciesSetup;
     bool sameDmaSwCounter = true;
@@ -1276,13 +1504,15 @@ std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawTasksContainer& rawTask
             frequenciesSetup = {975.0, 1300.0, 975.0, DMA27Bandwidth};
         } else {
             const auto frequencyEstimationAlgorithm = SynchronizationAlgorithKind::BIDIR_MAX;
-            frequenciesSetup = findFrequencySetup37XX(rawTasks.dmaTasks, dpuInfoTasks,
+            const auto dpu2dmaSyncPoints =
+                    getSynchronizationPoints(layout.dpu2dmaSyncTable, rawTasks.dmaTasks, dpuInfoTasks);
+            frequenciesSetup = findFrequencySetup37XX(dma2dpuSyncPoints, dpu2dmaSyncPoints,
                                                       /*algKind=*/frequencyEstimationAlgorithm);
         }
     } else if (device == MVCNN::TargetDevice::TargetDevice_VPUX311X ||
                device == MVCNN::TargetDevice::TargetDevice_VPUX30XX) {
         sameDmaSwCounter = false;
-        frequenciesSetup.profClk = getNceFreq(graphFile);
+        frequenciesSetup.profClk = layout.nceFreq;
         frequenciesSetup.dmaBandwidth = DMA20Bandwidth;
     } else {
         VPUX_THROW("Unknown VPUX target device '{0}'", device);
@@ -1301,28 +1531,48 @@ std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawTasksContainer& rawTask
     fillTaskInfoWithParsedRawRecords(dpuTaskInfo, dpuInfoTasks, frequenciesSetup);
 
     RawProfilingRecords swInfoTasks = rawTasks.swTasks;
-    llvm::Optional<ClusterTaskArray> actClusterInfoTasks;
-    bool swTasksMayBeTiled = device == MVCNN::TargetDevice::TargetDevice_VPUX37XX;
-    if (swTasksMayBeTiled) {
-        actClusterInfoTasks = groupClusterTasks(rawTasks.swTasks);
-        swInfoTasks = groupTasks(actClusterInfoTasks.getValue());
+    ClusterTaskArray actClusterInfoTasks;
+    if (layout.swTasksMayBeTiled) {
+        actClusterInfoTasks = buildClusterRecords(layout.swClusters, rawTasks.swTasks);
+        swInfoTasks = buildTaskRecords(layout.swTasks, actClusterInfoTasks);
     }
     fillTaskInfoWithParsedRawRecords(swTaskInfo, swInfoTasks, frequenciesSetup);
 
+    // Scheduling details are collected in the same order as the tasks info
+    std::vector<TaskScheduleInfo> dmaSchedule;
+    std::vector<TaskScheduleInfo> dpuSchedule;
+    std::vector<TaskScheduleInfo> swSchedule;
+    if (schedule != nullptr) {
+        fillScheduleInfoWithParsedRawRecords(dmaSchedule, rawTasks.dmaTasks, /*withBarriers=*/true);
+        for (size_t i = 0; i < dmaSchedule.size(); ++i) {
+            dmaSchedule[i].dma_port = layout.dmaRecords[i].dmaPort;
+        }
+        fillScheduleInfoWithParsedRawRecords(dpuSchedule, dpuInfoTasks, /*withBarriers=*/true);
+        fillScheduleInfoWithParsedRawRecords(swSchedule, swInfoTasks, /*withBarriers=*/true);
+    }
+
     const auto earliestDpuNs = getEarliestTaskBegin(dpuTaskInfo);
     if (verbosity >= VerbosityLevel::MEDIUM) {
         fillTaskInfoWithParsedRawRecords(dpuTaskInfo, dpuClusterInfoTasks, frequenciesSetup);
-        fillTaskInfoWithParsedRawRecords(swTaskInfo, actClusterInfoTasks.getValue(), frequenciesSetup);
+        fillTaskInfoWithParsedRawRecords(swTaskInfo, actClusterInfoTasks, frequenciesSetup);
+        if (schedule != nullptr) {
+            fillScheduleInfoWithParsedRawRecords(dpuSchedule, dpuClusterInfoTasks, /*withBarriers=*/false);
+            fillScheduleInfoWithParsedRawRecords(swSchedule, actClusterInfoTasks, /*withBarriers=*/false);
+        }
     }
     if (verbosity >= VerbosityLevel::HIGH) {
         fillTaskInfoWithParsedRawRecords(dpuTaskInfo, rawTasks.dpuTasks, frequenciesSetup);
         fillTaskInfoWithParsedRawRecords(swTaskInfo, rawTasks.swTasks, frequenciesSetup);
+        if (schedule != nullptr) {
+            fillScheduleInfoWithParsedRawRecords(dpuSchedule, rawTasks.dpuTasks, /*withBarriers=*/false);
+            fillScheduleInfoWithParsedRawRecords(swSchedule, rawTasks.swTasks, /*withBarriers=*/false);
+        }
     }
 
     const auto earliestDmaNs = getEarliestTaskBegin(dmaTaskInfo);
     const auto earliestSwNs = getEarliestTaskBegin(swTaskInfo);
 
-    const auto timersShift = getDMA2OtherTimersShift(rawTasks.dmaTasks, dpuInfoTasks, frequenciesSetup,
+    const auto timersShift = getDMA2OtherTimersShift(dma2dpuSyncPoints, frequenciesSetup,
                                                      SynchronizationPointKind::DMA_TO_DPU, log);
     log.trace("Timers DMA2DPU difference: {0}", timersShift);
     log.trace("Earliest DMA: {0}", earliestDmaNs);
@@ -1336,18 +1586,42 @@ std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawTasksContainer& rawTask
     if (!dpuTaskInfo.empty()) {
         const auto dma2dpuOffset = getTimersOffset(timersShift, earliestDmaNs, earliestDpuNs.getValue());
         adjustZeroPoint(dpuTaskInfo, dma2dpuOffset, earliestDmaNs);
-        std::sort(dpuTaskInfo.begin(), dpuTaskInfo.end(), [](const TaskInfo& a, const TaskInfo& b) {
+
+        // The permutation is sorted instead of the tasks, so the scheduling details follow their tasks
+        std::vector<size_t> order(dpuTaskInfo.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            const auto& a = dpuTaskInfo[lhs];
+            const auto& b = dpuTaskInfo[rhs];
             if (a.start_time_ns != b.start_time_ns) {
                 return a.start_time_ns < b.start_time_ns;
             } else {
                 return std::strcmp(a.name, b.name) < 0;
             }
         });
+
+        std::vector<TaskInfo> sortedDpuTaskInfo;
+        sortedDpuTaskInfo.reserve(order.size());
+        for (const auto ind : order) {
+            sortedDpuTaskInfo.push_back(dpuTaskInfo[ind]);
+        }
+        dpuTaskInfo = std::move(sortedDpuTaskInfo);
+
+        if (!dpuSchedule.empty()) {
+            std::vector<TaskScheduleInfo> sortedDpuSchedule;
+            sortedDpuSchedule.reserve(order.size());
+            for (const auto ind : order) {
+                sortedDpuSchedule.push_back(std::move(dpuSchedule[ind]));
+            }
+            dpuSchedule = std::move(sortedDpuSchedule);
+        }
     }
 
     int64_t dma2SwOffset = 0;
     if (!swTaskInfo.empty() && !sameDmaSwCounter) {
-        const auto dma2UpaTimerShift = getDMA2OtherTimersShift(rawTasks.dmaTasks, rawTasks.swTasks, frequenciesSetup,
+        const auto dma2upaSyncPoints =
+                getSynchronizationPoints(layout.dma2upaSyncTable, rawTasks.dmaTasks, rawTasks.swTasks);
+        const auto dma2UpaTimerShift = getDMA2OtherTimersShift(dma2upaSyncPoints, frequenciesSetup,
                                                                SynchronizationPointKind::DMA_TO_UPA, log);
         log.trace("Timers DMA2UPA difference: {0}", dma2UpaTimerShift);
         dma2SwOffset = getTimersOffset(dma2UpaTimerShift, earliestDmaNs, earliestSwNs.getValue());
@@ -1364,22 +1638,39 @@ std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawTasksContainer& rawTask
         cleanTaskName(task.name);
     }
 
+    if (schedule != nullptr) {
+        schedule->clear();
+        schedule->reserve(allTaskInfo.size());
+        for (auto* taskSchedule : {&dpuSchedule, &dmaSchedule, &swSchedule}) {
+            std::move(taskSchedule->begin(), taskSchedule->end(), std::back_inserter(*schedule));
+        }
+    }
+
     return allTaskInfo;
 }
 
-std::vector<TaskInfo> vpux::profiling::getTaskInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData,
-                                                   size_t profSize, TaskType type, VerbosityLevel verbosity,
-                                                   bool fpga) {
+//
+// ProfilingIndex
+//
+
+vpux::profiling::ProfilingIndex::ProfilingIndex(const uint8_t* blobData, size_t blobSize) {
     (void)blobSize;
-    std::ignore = verbosity;
 
-    if ((nullptr == blobData) || (nullptr == profData)) {
+    if (nullptr == blobData) {
         VPUX_THROW("Empty input data");
     }
 
+    auto layout = std::make_unique<Layout>();
+
     const auto* graphFile = MVCNN::GetGraphFile(blobData);
-    // Obtaining FRC speed from blob //
     const auto device = graphFile->header()->device();
+    layout->device = device;
+    if (device == MVCNN::TargetDevice::TargetDevice_VPUX311X || device == MVCNN::TargetDevice::TargetDevice_VPUX30XX) {
+        // Obtaining FRC speed from blob //
+        layout->nceFreq = getNceFreq(graphFile);
+    } else if (device != MVCNN::TargetDevice::TargetDevice_VPUX37XX) {
+        VPUX_THROW("Unknown VPUX target device '{0}'", device);
+    }
 
     // Finding of corresponding task list //
     const flatbuffers::Vector<flatbuffers::Offset<MVCNN::Task>>* dmaTaskList = nullptr;
@@ -1405,34 +1696,102 @@ std::vector<TaskInfo> vpux::profiling::getTaskInfo(const uint8_t* blobData, size
     }
 
     // Finding offsets of different profiling type in the profiling output
-    const auto offsets = getProfilingOffsets(graphFile, profSize);
+    layout->profilingBufferSize = ::getProfilingBufferSize(graphFile);
+    layout->sections = getProfilingOffsets(graphFile, layout->profilingBufferSize);
+
+    for (const auto& p : layout->sections) {
+        const auto length = p.second.second;
+
+        switch (p.first) {
+        case ExecutorType::DMA: {
+            indexDMATasks(layout->dmaRecords, dmaTaskList, length, device);
+            break;
+        }
+        case ExecutorType::UPA: {
+            indexUPATasks(layout->swRecords, swTaskList, length);
+            layout->swExecutorType = ExecutorType::UPA;
+            break;
+        }
+        case ExecutorType::ACTSHAVE: {
+            indexActShaveTasks(layout->swRecords, swTaskList, length);
+            layout->swExecutorType = ExecutorType::ACTSHAVE;
+            break;
+        }
+        case ExecutorType::DPU: {
+            indexDPUTasks(layout->dpuRecords, dpuTaskList, length, device);
+            break;
+        }
+        case ExecutorType::NONE: {
+            VPUX_THROW("None is not a valid profiling executor.");
+        }
+        }
+    }
+
+    layout->dpuClusters = groupRecordsByCluster(layout->dpuRecords);
+    layout->dpuTasks = groupClustersByName(layout->dpuClusters, layout->dpuRecords);
+
+    layout->swTasksMayBeTiled = device == MVCNN::TargetDevice::TargetDevice_VPUX37XX;
+    if (layout->swTasksMayBeTiled) {
+        layout->swClusters = groupRecordsByCluster(layout->swRecords);
+        layout->swTasks = groupClustersByName(layout->swClusters, layout->swRecords);
+    }
 
+    std::vector<BarrierUser> dmaDpuUsers;
+    appendBarrierUsers(dmaDpuUsers, ExecutorType::DMA, layout->dmaRecords);
+    appendBarrierUsers(dmaDpuUsers, ExecutorType::DPU, layout->dpuTasks, layout->dpuClusters, layout->dpuRecords);
+    layout->dma2dpuSyncTable = findSynchronizationPoints(dmaDpuUsers, SynchronizationPointKind::DMA_TO_DPU);
+    layout->dpu2dmaSyncTable = findSynchronizationPoints(dmaDpuUsers, SynchronizationPointKind::DPU_TO_DMA);
+
+    std::vector<BarrierUser> dmaSwUsers;
+    appendBarrierUsers(dmaSwUsers, ExecutorType::DMA, layout->dmaRecords);
+    appendBarrierUsers(dmaSwUsers, layout->swExecutorType, layout->swRecords);
+    layout->dma2upaSyncTable = findSynchronizationPoints(dmaSwUsers, SynchronizationPointKind::DMA_TO_UPA);
+
+    _layout = std::move(layout);
+}
+
+vpux::profiling::ProfilingIndex::~ProfilingIndex() = default;
+
+size_t vpux::profiling::ProfilingIndex::getProfilingBufferSize() const {
+    return _layout->profilingBufferSize;
+}
+
+std::vector<TaskInfo> vpux::profiling::ProfilingIndex::decode(const uint8_t* profData, size_t profSize, TaskType type,
+                                                              VerbosityLevel verbosity, bool fpga,
+                                                              std::vector<TaskScheduleInfo>* schedule) const {
+    if (nullptr == profData) {
+        VPUX_THROW("Empty input data");
+    }
+    VPUX_THROW_WHEN(profSize < _layout->profilingBufferSize,
+                    "Actual buffer size is smaller than calculated. Expected {0}, but got {1}",
+                    _layout->profilingBufferSize, profSize);
+
+    const auto device = _layout->device;
     RawTasksContainer rawTasksContainer;
 
-    for (const auto& p : offsets) {
+    for (const auto& p : _layout->sections) {
         const auto offset = p.second.first;
-        const auto length = p.second.second;
 
         switch (p.first) {
         case ExecutorType::DMA: {
-            parseDMATaskProfiling(rawTasksContainer.dmaTasks, dmaTaskList, profData + offset, length, device);
+            decodeDMARecords(rawTasksContainer.dmaTasks, _layout->dmaRecords, profData + offset, device);
             break;
         }
         case ExecutorType::UPA: {
             if (type == TaskType::ALL || type == TaskType::DPU_SW) {
-                parseUPATaskProfiling(rawTasksContainer.swTasks, swTaskList, profData + offset, length);
+                decodeUPARecords(rawTasksContainer.swTasks, _layout->swRecords, profData + offset);
             }
             break;
         }
         case ExecutorType::ACTSHAVE: {
             if (type == TaskType::ALL || type == TaskType::DPU_SW) {
-                parseActShaveTaskProfiling(rawTasksContainer.swTasks, swTaskList, profData + offset, length);
+                decodeActShaveRecords(rawTasksContainer.swTasks, _layout->swRecords, profData + offset);
             }
             break;
         }
         case ExecutorType::DPU: {
             if (type == TaskType::ALL || type == TaskType::DPU_SW) {
-                parseDPUTaskProfiling(rawTasksContainer.dpuTasks, dpuTaskList, profData + offset, length, device);
+                decodeDPURecords(rawTasksContainer.dpuTasks, _layout->dpuRecords, profData + offset, device);
             }
             break;
         }
@@ -1442,7 +1801,17 @@ std::vector<TaskInfo> vpux::profiling::getTaskInfo(const uint8_t* blobData, size
         }
     }
 
-    return convertRawTasksToTaskInfo(rawTasksContainer, graphFile, fpga, verbosity);
+    return convertRawTasksToTaskInfo(rawTasksContainer, *_layout, fpga, verbosity, schedule);
+}
+
+std::vector<TaskInfo> vpux::profiling::getTaskInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData,
+                                                   size_t profSize, TaskType type, VerbosityLevel verbosity,
+                                                   bool fpga) {
+    if ((nullptr == blobData) || (nullptr == profData)) {
+        VPUX_THROW("Empty input data");
+    }
+
+    return ProfilingIndex(blobData, blobSize).decode(profData, profSize, type, verbosity, fpga);
 }
 
 std::vector<LayerInfo> vpux::profiling::getLayerInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData,
@@ -1453,10 +1822,15 @@ std::vector<LayerInfo> vpux::profiling::getLayerInfo(const uint8_t* blobData, si
     return getLayerInfo(taskInfo);
 }
 
+std::vector<LayerInfo> vpux::profiling::getLayerInfo(const ProfilingIndex& index, const uint8_t* profData,
+                                                     size_t profSize, bool fpga) {
+    return getLayerInfo(index.decode(profData, profSize, TaskType::ALL, VerbosityLevel::LOW, fpga));
+}
+
 std::vector<LayerInfo> vpux::profiling::getLayerInfo(const std::vector<TaskInfo>& taskInfo) {
     std::vector<LayerInfo> layerInfo{};
+    std::unordered_map<std::string, size_t> layerIndices;
     for (auto& task : taskInfo) {
-        LayerInfo* layer;
         std::string taskName = std::string(task.name);
         if (taskName.find("cluster_") != std::string::npos) {
             // Skipping high verbose tasks with cluster/variant info
@@ -1465,10 +1839,8 @@ std::vector<LayerInfo> vpux::profiling::getLayerInfo(const std::vector<TaskInfo>
 
         cleanLayerName(taskName);
 
-        auto result = std::find_if(begin(layerInfo), end(layerInfo), [&](LayerInfo item) {
-            return taskName == item.name;
-        });
-        if (result == end(layerInfo)) {
+        const auto result = layerIndices.emplace(taskName, layerInfo.size());
+        if (result.second) {
             LayerInfo info = LayerInfo();
             taskName.copy(info.name, sizeof(info.name) - 1);
             info.name[sizeof(info.name) - 1] = '\0';
@@ -1476,10 +1848,8 @@ std::vector<LayerInfo> vpux::profiling::getLayerInfo(const std::vector<TaskInfo>
             info.start_time_ns = task.start_time_ns;
             info.duration_ns = 0;
             layerInfo.push_back(info);
-            layer = &layerInfo.back();
-        } else {
-            layer = &(*result);
         }
+        LayerInfo* layer = &layerInfo[result.first->second];
         if (task.start_time_ns < layer->start_time_ns) {
             layer->duration_ns += layer->start_time_ns - task.start_time_ns;
             layer->start_time_ns = task.start_time_ns;
@@ -10,6 +10,7 @@
 #include <cstring>  // std::memcpy for pointer-only args
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -67,6 +68,7 @@ public:
     void setup(const InferenceEngine::ParamMap& params) override;
     bool isPreProcessingSupported(const PreprocMap& preProcessMap) const override;
     InferenceEngine::Parameter getParameter(const std::string& paramName) const override;
+    profiling::HostOverheadAggregator* getHostOverheadAggregator() const override;
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getLayerStatistics() override;
 
@@ -222,6 +224,19 @@ public:
             return _blob;
         };
 
+        // Built on the first request and shared by all executors of the graph
+        const profiling::ProfilingIndex& profilingIndex() const;
+
+        // Profiling statistics of all executors of the graph
+        inline profiling::ProfilingAggregator& profilingAggregator() const {
+            return *_profiling_aggregator;
+        };
+
+        // Host-side stage durations of all executors of the graph
+        inline profiling::HostOverheadAggregator& hostOverheadAggregator() const {
+            return *_host_overhead_aggregator;
+        };
+
     private:
         ze_device_handle_t _device = nullptr;
         ze_context_handle_t _context = nullptr;
@@ -234,6 +249,12 @@ public:
         std::map<std::string, ArgumentDescriptor> _outputs_desc_map;
 
         std::unique_ptr<CommandList> _command_list;
+
+        mutable std::once_flag _profiling_index_flag;
+        mutable std::unique_ptr<profiling::ProfilingIndex> _profiling_index;
+
+        std::unique_ptr<profiling::ProfilingAggregator> _profiling_aggregator;
+        std::unique_ptr<profiling::HostOverheadAggregator> _host_overhead_aggregator;
     };
 
     struct Pipeline {
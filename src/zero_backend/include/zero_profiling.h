@@ -11,13 +11,23 @@
 #include <ie_common.h>
 #include "vpux/al/config/compiler.hpp"
 
+#include <functional>
 #include <map>
 
 namespace vpux {
+
+namespace profiling {
+class ProfilingIndex;
+class ProfilingAggregator;
+}  // namespace profiling
+
 namespace zeroProfiling {
 
 using LayerStatistics = std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>;
 
+// Provides the profiling metadata of the compiled blob, which is collected once per network
+using ProfilingIndexProvider = std::function<const profiling::ProfilingIndex&()>;
+
 constexpr uint32_t POOL_SIZE = 1;
 
 struct ProfilingPool {
@@ -53,7 +63,9 @@ struct ProfilingQuery {
         return _handle;
     }
     LayerStatistics getLayerStatistics(InferenceEngine::VPUXConfigParams::CompilerType compiler_type,
-                                       const std::vector<char>& blob);
+                                       const ProfilingIndexProvider& getProfilingIndex);
+    // Decodes the profiling output of the last inference and adds it to the rolling statistics
+    void accumulate(const ProfilingIndexProvider& getProfilingIndex, profiling::ProfilingAggregator& aggregator);
     ~ProfilingQuery();
 
 private:
@@ -11,13 +11,18 @@
 #include "zero_memory.h"
 #include "zero_utils.h"
 
+#include "vpux/al/backend/repacking.hpp"
 #include "vpux/al/config/common.hpp"
 #include "vpux/al/config/compiler.hpp"
 #include "vpux/al/config/runtime.hpp"
 
 #include "vpux/utils/IE/blob.hpp"
 #include "vpux/utils/IE/itt.hpp"
+#include "vpux/utils/plugin/profiling_aggregator.hpp"
+#include "vpux/utils/plugin/profiling_parser.hpp"
+#include "vpux_private_metrics.hpp"
 
+#include <chrono>
 #include <functional>
 #include <iostream>
 #include <sstream>
@@ -115,46 +120,6 @@ bool isRepackingPossible(const IE::TensorDesc& userTensorDesc, const IE::TensorD
     return true;
 }
 
-void prepareInputForInference(const IE::Blob::Ptr& userInput, const IE::TensorDesc& deviceTensorDesc, void* destData,
-                              const vpux::Optional<QuantizationParam>& quantParam, Logger logger) {
-    OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Executor::prepareInputForInference");
-    if (userInput == nullptr) {
-        IE_THROW() << "User input blob null pointer";
-    }
-    if (destData == nullptr) {
-        IE_THROW() << "Destination data null pointer";
-    }
-    const auto userPrecision = userInput->getTensorDesc().getPrecision();
-    const auto userLayout = userInput->getTensorDesc().getLayout();
-    const auto devicePrecision = deviceTensorDesc.getPrecision();
-    const auto deviceLayout = deviceTensorDesc.getLayout();
-
-    const bool isPrecisionMatched = userPrecision == devicePrecision;
-    const bool isLayoutMatched = userLayout == deviceLayout;
-    if (isPrecisionMatched && isLayoutMatched) {
-        IE_THROW() << "There is nothing to repack";
-    }
-
-    if (!isPrecisionMatched) {
-        logger.info("Different precisions of user and device input blobs.\tConversion required from {0} to {1}",
-                    userPrecision.name(), devicePrecision.name());
-        if (!isLayoutMatched) {
-            IE::Blob::Ptr expectedInput = toPrecision(IE::as<IE::MemoryBlob>(userInput), devicePrecision, quantParam);
-            std::stringstream conversionDetailsStr;
-            conversionDetailsStr << "Conversion required from " << userLayout << " to " << deviceLayout << ".";
-            logger.info("Different layouts of user and device input blobs.\t{0}", conversionDetailsStr.str());
-            toLayout(IE::as<IE::MemoryBlob>(expectedInput), deviceLayout, nullptr, destData);
-        } else {
-            toPrecision(IE::as<IE::MemoryBlob>(userInput), devicePrecision, quantParam, nullptr, destData);
-        }
-    } else if (!isLayoutMatched) {
-        std::stringstream conversionDetailsStr;
-        conversionDetailsStr << "Conversion required from " << userLayout << " to " << deviceLayout << ".";
-        logger.info("Different layouts of user and device input blobs.\t{0}", conversionDetailsStr.str());
-        toLayout(IE::as<IE::MemoryBlob>(userInput), deviceLayout, nullptr, destData);
-    }
-}
-
 void getOutputAfterInference(IE::Blob::Ptr& userOutput, const IE::TensorDesc& deviceTensorDesc, const void* srcData,
                              Logger logger) {
     OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Executor::getOutputsAfterInference");
@@ -221,6 +186,16 @@ void getOutputAfterInference(IE::Blob::Ptr& userOutput, const IE::TensorDesc& de
     memcpy(memUserLock, memExpectedLock, memUser->byteSize());
 }
 
+// The clock isn't read, if the host overhead isn't collected
+std::chrono::steady_clock::time_point getStartTime(const profiling::HostOverheadAggregator* hostOverhead) {
+    return hostOverhead != nullptr ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+}
+
+uint64_t getElapsedNs(std::chrono::steady_clock::time_point start) {
+    const auto duration = std::chrono::steady_clock::now() - start;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+
 }  // namespace
 
 namespace vpux {
@@ -365,7 +340,9 @@ ZeroExecutor::Graph::Graph(const ze_device_handle_t& device_handle, const ze_con
           _context(context),
           _blob(networkDesc->getCompiledNetwork()),
           _graph_ddi_table_ext(graph_ddi_table_ext),
-          _command_list(std::make_unique<CommandList>(device_handle, _context, graph_ddi_table_ext)) {
+          _command_list(std::make_unique<CommandList>(device_handle, _context, graph_ddi_table_ext)),
+          _profiling_aggregator(std::make_unique<profiling::ProfilingAggregator>()),
+          _host_overhead_aggregator(std::make_unique<profiling::HostOverheadAggregator>()) {
     OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Executor::Graph::Graph");
     OV_ITT_TASK_CHAIN(ZERO_EXECUTOR_GRAPH, itt::domains::LevelZeroBackend, "Executor::Graph::Graph", "pfnCreate");
     ze_graph_desc_t desc{ZE_STRUCTURE_TYPE_GRAPH_DESC_PROPERTIES,        nullptr, ZE_GRAPH_FORMAT_NATIVE, _blob.size(),
@@ -403,6 +380,14 @@ void ZeroExecutor::Graph::init() {
 void ZeroExecutor::Graph::setArgumentValue(uint32_t argi_, const void* argv_) const {
     zeroUtils::throwOnFail("zeGraphSetArgumentValue", _graph_ddi_table_ext->pfnSetArgumentValue(_handle, argi_, argv_));
 }
+const profiling::ProfilingIndex& ZeroExecutor::Graph::profilingIndex() const {
+    std::call_once(_profiling_index_flag, [this]() {
+        OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Executor::Graph::profilingIndex");
+        _profiling_index = std::make_unique<profiling::ProfilingIndex>(reinterpret_cast<const uint8_t*>(_blob.data()),
+                                                                       _blob.size());
+    });
+    return *_profiling_index;
+}
 ZeroExecutor::Graph::~Graph() {
     zeroUtils::throwOnFail("pfnDestroy", _graph_ddi_table_ext->pfnDestroy(_handle));
 }
@@ -630,6 +615,8 @@ void ZeroExecutor::push(const IE::BlobMap& inputs) {
     const auto& deviceInputs = _networkDesc->getDeviceInputsInfo();
     const auto& quantParamsInfo = _networkDesc->getQuantParamsInfo();
     OV_ITT_TASK_CHAIN(ZERO_EXECUTOR_PUSH, itt::domains::LevelZeroBackend, "Executor::push", "PrepareInput");
+    const auto hostOverhead = getHostOverheadAggregator();
+    uint64_t repackNs = 0;
     // Copy input data to staging buffer on Cpu (input always first argument)
     for (const auto& inferInput : inputs) {
         const auto& name = inferInput.first;
@@ -655,7 +642,12 @@ void ZeroExecutor::push(const IE::BlobMap& inputs) {
                 IE_THROW() << "Push blobs: repacking is not possible";
             }
             void* hostMem = _pipeline->inputs().getHostPtr(name);
+            OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Executor::prepareInputForInference");
+            const auto repackStart = getStartTime(hostOverhead);
             prepareInputForInference(input, deviceInput->getTensorDesc(), hostMem, quantParams, _logger);
+            if (hostOverhead != nullptr) {
+                repackNs += getElapsedNs(repackStart);
+            }
         } else {
             // we should check memory type: host memory or generic and copy if it's a generic
             const auto memInput = IE::as<IE::MemoryBlob>(input);
@@ -674,6 +666,9 @@ void ZeroExecutor::push(const IE::BlobMap& inputs) {
             }
         }
     }
+    if (repackNs != 0) {
+        hostOverhead->record(profiling::HostOverheadStage::Repack, repackNs);
+    }
 
     _pipeline->push();
 }
@@ -690,6 +685,24 @@ void ZeroExecutor::pull(IE::BlobMap& outputs) {
     const auto& deviceOutputs = _networkDesc->getDeviceOutputsInfo();
 
     _pipeline->pull();
+    // Each profiled inference is added to the rolling statistics of the network on request only,
+    // since decoding the profiling output on every inference affects the measured inference time
+    if (_config.get<PERF_COUNT>() && _config.get<COLLECT_PROFILING_STATISTICS>() &&
+        _config.get<COMPILER_TYPE>() == IE::VPUXConfigParams::CompilerType::MLIR) {
+        OV_ITT_SCOPED_TASK(itt::domains::LevelZeroBackend, "Executor::pull::accumulateProfiling");
+        try {
+            _profiling_query.accumulate(
+                    [this]() -> const profiling::ProfilingIndex& {
+                        return _graph->profilingIndex();
+                    },
+                    _graph->profilingAggregator());
+        } catch (const std::exception& ex) {
+            // The statistics are auxiliary, so the inference results are still returned
+            _logger.warning("Failed to accumulate the profiling statistics: {0}", ex.what());
+        }
+    }
+    const auto hostOverhead = getHostOverheadAggregator();
+    uint64_t repackNs = 0;
     // Copy output data to staging buffer on Cpu (input always first argument)
     for (auto& inferOutput : outputs) {
         const auto& name = inferOutput.first;
@@ -711,7 +724,11 @@ void ZeroExecutor::pull(IE::BlobMap& outputs) {
                 IE_THROW() << "Pull blobs: repacking is not possible";
             }
             const void* hostMem = _pipeline->outputs().getHostPtr(name);
+            const auto repackStart = getStartTime(hostOverhead);
             getOutputAfterInference(output, deviceOutput->getTensorDesc(), hostMem, _logger);
+            if (hostOverhead != nullptr) {
+                repackNs += getElapsedNs(repackStart);
+            }
         } else {
             // we should check memory type: host memory or generic and copy if it's a generic
             const auto memOutput = IE::as<IE::MemoryBlob>(output);
@@ -730,16 +747,37 @@ void ZeroExecutor::pull(IE::BlobMap& outputs) {
             }
         }
     }
+    if (repackNs != 0) {
+        hostOverhead->record(profiling::HostOverheadStage::Repack, repackNs);
+    }
 
     _pipeline->reset();
 }
 
-IE::Parameter ZeroExecutor::getParameter(const std::string&) const {
+IE::Parameter ZeroExecutor::getParameter(const std::string& paramName) const {
+    if (paramName == VPUX_METRIC_KEY(PROFILING_STATISTICS)) {
+        std::stringstream stream;
+        profiling::printAggregatedProfilingAsJson(_graph->profilingAggregator().getAggregatedInfo(), stream);
+        return stream.str();
+    }
+    if (paramName == VPUX_METRIC_KEY(HOST_OVERHEAD_STATISTICS) && _config.get<COLLECT_HOST_OVERHEAD_STATISTICS>()) {
+        std::stringstream stream;
+        profiling::printHostOverheadAsJson(_graph->hostOverheadAggregator().getAggregatedInfo(), stream);
+        return stream.str();
+    }
     return IE::Parameter();
 }
 
+profiling::HostOverheadAggregator* ZeroExecutor::getHostOverheadAggregator() const {
+    // The infer requests and push/pull don't read the clock at all without the aggregator
+    return _config.get<COLLECT_HOST_OVERHEAD_STATISTICS>() ? &_graph->hostOverheadAggregator() : nullptr;
+}
+
 std::map<std::string, IE::InferenceEngineProfileInfo> ZeroExecutor::getLayerStatistics() {
-    return _profiling_query.getLayerStatistics(_config.get<COMPILER_TYPE>(), _graph->blob());
+    return _profiling_query.getLayerStatistics(_config.get<COMPILER_TYPE>(),
+                                               [this]() -> const profiling::ProfilingIndex& {
+                                                   return _graph->profilingIndex();
+                                               });
 }
 
 void ZeroExecutor::setup(const IE::ParamMap&) {
@@ -24,6 +24,7 @@
 #include "vpux/utils/IE/itt.hpp"
 #include "vpux/utils/IE/prefix.hpp"
 #include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/plugin/profiling_aggregator.hpp"
 
 namespace IE = InferenceEngine;
 using namespace vpux;
@@ -114,7 +115,13 @@ void ZeroInferRequest::InferAsync() {
     _logger.debug("InferRequest::InferAsync started");
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "InferAsync");
 
-    execDataPreprocessing(_inputs);
+    const auto hostOverhead = _executorPtr->getHostOverheadAggregator();
+    {
+        profiling::HostOverheadScope preprocessingScope(hostOverhead, profiling::HostOverheadStage::Preprocessing);
+        execDataPreprocessing(_inputs);
+    }
+
+    profiling::HostOverheadScope pushScope(hostOverhead, profiling::HostOverheadStage::Push);
     _executorPtr->push(_inputs);
 }
 
@@ -136,7 +143,11 @@ std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> ZeroInferR
 
 void ZeroInferRequest::GetResult() {
     OV_ITT_SCOPED_TASK(itt::domains::VPUXPlugin, "GetResult");
-    _executorPtr->pull(_outputs);
+    {
+        profiling::HostOverheadScope pullScope(_executorPtr->getHostOverheadAggregator(),
+                                               profiling::HostOverheadStage::Pull);
+        _executorPtr->pull(_outputs);
+    }
     _logger.debug("InferRequest::GetResult finished");
 }
 
@@ -12,6 +12,7 @@
 
 #include "vpux/al/config/compiler.hpp"
 #include "vpux/utils/IE/profiling.hpp"
+#include "vpux/utils/plugin/profiling_aggregator.hpp"
 #include "vpux/utils/plugin/profiling_parser.hpp"
 
 #include <ie_common.h>
@@ -163,7 +164,7 @@ void ProfilingQuery::create(const ze_graph_profiling_pool_handle_t& profiling_po
 }
 
 LayerStatistics ProfilingQuery::getLayerStatistics(IE::VPUXConfigParams::CompilerType compiler_type,
-                                                   const std::vector<char>& blob) {
+                                                   const ProfilingIndexProvider& getProfilingIndex) {
     if (!(_handle)) {
         IE_THROW() << "Can't get profiling statistics because profiling is disabled.";
     }
@@ -206,13 +207,14 @@ LayerStatistics ProfilingQuery::getLayerStatistics(IE::VPUXConfigParams::Compile
         }
     } else {
         // Process raw profiling data on the application side
+        // The blob metadata is indexed once per network, so only the raw records are decoded here
         std::vector<uint8_t> rawBytes = getData<uint8_t>();
-        const uint8_t* blob_data = reinterpret_cast<const uint8_t*>(blob.data());
-        layerProfiling = getLayerInfo(blob_data, blob.size(), rawBytes.data(), rawBytes.size());
+        const auto& profilingIndex = getProfilingIndex();
+        layerProfiling = getLayerInfo(profilingIndex, rawBytes.data(), rawBytes.size());
         if (outFile.is_open()) {
             if (format != ProfilingFormat::RAW) {
-                std::vector<TaskInfo> taskProfiling = getTaskInfo(blob_data, blob.size(), rawBytes.data(),
-                                                                  rawBytes.size(), TaskType::ALL, VerbosityLevel::HIGH);
+                std::vector<TaskInfo> taskProfiling =
+                        profilingIndex.decode(rawBytes.data(), rawBytes.size(), TaskType::ALL, VerbosityLevel::HIGH);
                 saveProfilingDataToFile(format, outFile, layerProfiling, taskProfiling);
             } else {
                 saveRawDataToFile(rawBytes.data(), rawBytes.size(), outFile);
@@ -222,6 +224,18 @@ LayerStatistics ProfilingQuery::getLayerStatistics(IE::VPUXConfigParams::Compile
     return convertLayersToIeProfilingInfo(layerProfiling);
 }
 
+void ProfilingQuery::accumulate(const ProfilingIndexProvider& getProfilingIndex, ProfilingAggregator& aggregator) {
+    if (!(_handle)) {
+        return;
+    }
+
+    // Low verbosity keeps only one entry per task, so the aggregator memory doesn't depend on the clusters number
+    std::vector<uint8_t> rawBytes = getData<uint8_t>();
+    const auto taskProfiling =
+            getProfilingIndex().decode(rawBytes.data(), rawBytes.size(), TaskType::ALL, VerbosityLevel::LOW);
+    aggregator.addInference(taskProfiling, getLayerInfo(taskProfiling));
+}
+
 ProfilingQuery::~ProfilingQuery() {
     if (_handle) {
         _graph_profiling_ddi_table_ext->pfnProfilingQueryDestroy(_handle);
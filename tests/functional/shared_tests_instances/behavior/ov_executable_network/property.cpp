@@ -26,6 +26,8 @@ std::vector<std::pair<std::string, ov::Any>> expected_supported_properties_exe_n
         {ov::intel_vpux::preprocessing_shaves.name(), ov::Any(2)},
         {ov::intel_vpux::print_profiling.name(), ov::Any(ov::intel_vpux::ProfilingOutputTypeArg::JSON)},
         {ov::intel_vpux::profiling_output_file.name(), ov::Any("some/file")},
+        {ov::intel_vpux::collect_profiling_statistics.name(), ov::Any(true)},
+        {ov::intel_vpux::collect_host_overhead_statistics.name(), ov::Any(true)},
         {ov::intel_vpux::use_sipp.name(), ov::Any(false)},
         {ov::intel_vpux::vpux_platform.name(), ov::Any(ov::intel_vpux::VPUXPlatform::EMULATOR)},
         {ov::intel_vpux::ddr_heap_size_mb.name(), ov::Any(500)},
@@ -49,3 +49,34 @@ func @QuantConstFold() -> memref<16x3x1x1x!qElemType, #YXOI> {
     // CHECK-SAME:       {order = #YXOI}>
     // CHECK:       return [[CST]]
 }
+
+// -----
+
+func @WeightsTableFold() -> memref<2x1x1x4xsi32> {
+    %0 = const.Declare memref<2x1x1x4xsi32> =
+        dense<[[[[0, 0, 1, 2]]], [[[16, 8, 3, 4]]], [[[32, 16, 5, 6]]]]> : tensor<3x1x1x4xsi32>,
+        [
+            #const.SubView<[0, 0, 0, 0], [2, 1, 1, 4]>,
+            #const.RelocateWeightsTable<1024 : i64, 2048 : i64, [0]>
+        ]
+
+    return %0 : memref<2x1x1x4xsi32>
+
+    // CHECK:       [[CST:%.*]] = const.Declare memref<2x1x1x4xsi32>
+    // CHECK-SAME:       dense<{{\[}}[{{\[}}[0, 0, 1, 2]]], {{\[}}[{{\[}}16, 8, 3, 4]]]]> : tensor<2x1x1x4xsi32>
+    // CHECK-SAME:       [#const.RelocateWeightsTable<1024 : i64, 2048 : i64, [0]>]
+    // CHECK:       return [[CST]]
+}
+
+// -----
+
+func @FoldedWeightsTable() -> memref<16x1x1x4xsi32> {
+    %0 = const.Declare memref<16x1x1x4xsi32> =
+        dense<1> : tensor<16x1x1x4xsi32>, [#const.RelocateWeightsTable<1024 : i64, 16777215 : i64, [0, 8]>]
+
+    return %0 : memref<16x1x1x4xsi32>
+
+    // CHECK:       [[CST:%.*]] = const.Declare memref<16x1x1x4xsi32>
+    // CHECK-SAME:       dense<1> : tensor<16x1x1x4xsi32>, [#const.RelocateWeightsTable<1024 : i64, 16777215 : i64, [0, 8]>]
+    // CHECK:       return [[CST]]
+}
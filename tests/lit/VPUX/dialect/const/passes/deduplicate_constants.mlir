@@ -0,0 +1,98 @@
+//
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --deduplicate-constants %s | FileCheck %s
+// REQUIRES: arch-VPUX30XX || arch-VPUX37XX
+
+func @SameFoldedContent() -> (tensor<1x8xf16>, tensor<1x8xf16>, tensor<1x8xf16>) {
+    %0 = const.Declare tensor<1x8xf16> = dense<1.0> : tensor<1x8xf32>, [#const.ConvertElemType<f16>]
+    %1 = const.Declare tensor<1x8xf16> = dense<1.0> : tensor<1x8xf16>
+    %2 = const.Declare tensor<1x8xf16> = dense<1.0> : tensor<8xf16>, [#const.Reshape<[1, 8]>]
+
+    return %0, %1, %2 : tensor<1x8xf16>, tensor<1x8xf16>, tensor<1x8xf16>
+
+    // CHECK:       [[CST:%.*]] = const.Declare tensor<1x8xf16> = dense<1.000000e+00> : tensor<1x8xf32>
+    // CHECK-NOT:   const.Declare
+    // CHECK:       return [[CST]], [[CST]], [[CST]]
+}
+
+// -----
+
+func @DifferentContentOrType() -> (tensor<1x8xf16>, tensor<1x8xf16>, tensor<8xf16>) {
+    %0 = const.Declare tensor<1x8xf16> = dense<1.0> : tensor<1x8xf16>
+    %1 = const.Declare tensor<1x8xf16> = dense<2.0> : tensor<1x8xf16>
+    %2 = const.Declare tensor<8xf16> = dense<1.0> : tensor<8xf16>
+
+    return %0, %1, %2 : tensor<1x8xf16>, tensor<1x8xf16>, tensor<8xf16>
+
+    // CHECK:       [[CST0:%.*]] = const.Declare tensor<1x8xf16> = dense<1.000000e+00> : tensor<1x8xf16>
+    // CHECK:       [[CST1:%.*]] = const.Declare tensor<1x8xf16> = dense<2.000000e+00> : tensor<1x8xf16>
+    // CHECK:       [[CST2:%.*]] = const.Declare tensor<8xf16> = dense<1.000000e+00> : tensor<8xf16>
+    // CHECK:       return [[CST0]], [[CST1]], [[CST2]]
+}
+
+// -----
+
+func @SharedBuffers() -> (tensor<1x8xf16>, tensor<1x8xf16>, tensor<1x8xf16>) {
+    %0 = const.Declare tensor<1x8xf16> = #const.SharedElements<tensor<1x8xf16>, "0x003C003C003C003C003C003C003C003C">
+    %1 = const.Declare tensor<1x8xf16> = #const.SharedElements<tensor<1x8xf16>, "0x003C003C003C003C003C003C003C003C">
+    %2 = const.Declare tensor<1x8xf16> = dense<1.0> : tensor<1x8xf32>, [#const.ConvertElemType<f16>]
+
+    return %0, %1, %2 : tensor<1x8xf16>, tensor<1x8xf16>, tensor<1x8xf16>
+
+    // CHECK:       [[CST:%.*]] = const.Declare tensor<1x8xf16> = dense<1.000000e+00> : tensor<1x8xf16>
+    // CHECK-NOT:   const.Declare
+    // CHECK:       return [[CST]], [[CST]], [[CST]]
+}
+
+// -----
+
+func @NonDominatingDuplicates(%arg0: memref<1x8xf16>) -> (memref<1x8xf16>, memref<1x8xf16>, memref<1x8xf16>) {
+    %t0, %f0 = async.execute -> !async.value<memref<1x8xf16>> {
+        %0 = const.Declare memref<1x8xf16> = dense<1.0> : tensor<1x8xf16>
+        async.yield %0 : memref<1x8xf16>
+    }
+
+    %1 = const.Declare memref<1x8xf16> = dense<1.0> : tensor<1x8xf32>, [#const.ConvertElemType<f16>]
+
+    %t2, %f2 = async.execute -> !async.value<memref<1x8xf16>> {
+        %2 = const.Declare memref<1x8xf16> = dense<1.0> : tensor<8xf16>, [#const.Reshape<[1, 8]>]
+        async.yield %2 : memref<1x8xf16>
+    }
+
+    %3 = async.await %f0 : !async.value<memref<1x8xf16>>
+    %4 = async.await %f2 : !async.value<memref<1x8xf16>>
+    return %3, %1, %4 : memref<1x8xf16>, memref<1x8xf16>, memref<1x8xf16>
+
+    // The constant in the first region doesn't dominate the others, the last one is dominated by the second one
+
+    // CHECK:       async.execute
+    // CHECK:           [[CST0:%.*]] = const.Declare memref<1x8xf16> = dense<1.000000e+00> : tensor<1x8xf16>
+    // CHECK:           async.yield [[CST0]]
+
+    // CHECK:       [[CST1:%.*]] = const.Declare memref<1x8xf16> = dense<1.000000e+00> : tensor<1x8xf32>, [#const.ConvertElemType<f16>]
+
+    // CHECK:       async.execute
+    // CHECK-NOT:       const.Declare
+    // CHECK:           async.yield [[CST1]]
+
+    // CHECK:       [[VAL0:%.*]] = async.await
+    // CHECK:       [[VAL2:%.*]] = async.await
+    // CHECK:       return [[VAL0]], [[CST1]], [[VAL2]]
+}
+
+// -----
+
+func @FoldedConstants() -> (memref<1x8xf16>, memref<1x8xf16>, memref<1x8xf16>) {
+    %0 = const.Declare memref<1x8xf16> = dense<1.0> : tensor<1x8xf16>
+    %1 = const.Declare memref<1x8xf16> = dense<2.0> : tensor<1x8xf16>
+    %2 = const.Declare memref<1x8xf16> = dense<1.0> : tensor<1x8xf16>
+
+    return %0, %1, %2 : memref<1x8xf16>, memref<1x8xf16>, memref<1x8xf16>
+
+    // CHECK:       [[CST0:%.*]] = const.Declare memref<1x8xf16> = dense<1.000000e+00> : tensor<1x8xf16>
+    // CHECK:       [[CST1:%.*]] = const.Declare memref<1x8xf16> = dense<2.000000e+00> : tensor<1x8xf16>
+    // CHECK-NOT:   const.Declare
+    // CHECK:       return [[CST0]], [[CST1]], [[CST0]]
+}
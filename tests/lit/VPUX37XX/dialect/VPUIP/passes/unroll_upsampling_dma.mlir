@@ -138,3 +138,44 @@ func @UnrollUpsamplingDMAWithNHWC() -> memref<1x16x1024x32xf16, #NHWC, @DDR> {
 
     // CHECK:    return [[OUTPUT]] : memref<1x16x1024x32xf16, #NHWC, @DDR>
 }
+
+// -----
+
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+// CHECK-LABEL: @UnrollSeveralUpsamplingDMAs
+func @UnrollSeveralUpsamplingDMAs() -> memref<1x16x16x16xf16, #NHWC, @DDR> {
+    %bar0 = VPURT.DeclareVirtualBarrier -> !VPURT.Barrier
+
+    %input = VPURT.DeclareBuffer "NetworkInput" [0] <0> -> memref<1x16x8x8xf16, #NHWC, @DDR>
+    %buffer = VPURT.DeclareBuffer "DDR" <0> -> memref<1x16x16x16xf16, #NHWC, @DDR>
+    %output = VPURT.DeclareBuffer "DDR" <8192> -> memref<1x16x16x16xf16, #NHWC, @DDR>
+    VPURT.Task updates(%bar0 : !VPURT.Barrier) {
+        %0 = VPUIP.UpsamplingDMAOp {port = 0 : i64, upsampling_factor = [1, 1, 2, 2]}
+                        inputs(%input : memref<1x16x8x8xf16, #NHWC, @DDR>)
+                        outputs(%buffer : memref<1x16x16x16xf16, #NHWC, @DDR>) -> memref<1x16x16x16xf16, #NHWC, @DDR>
+    }
+    VPURT.Task waits(%bar0 : !VPURT.Barrier) {
+        %0 = VPUIP.UpsamplingDMAOp {port = 0 : i64, upsampling_factor = [1, 1, 2, 2]}
+                        inputs(%input : memref<1x16x8x8xf16, #NHWC, @DDR>)
+                        outputs(%output : memref<1x16x16x16xf16, #NHWC, @DDR>) -> memref<1x16x16x16xf16, #NHWC, @DDR>
+    }
+
+    return %output: memref<1x16x16x16xf16, #NHWC, @DDR>
+
+    // CHECK:       [[BARRIER:%.*]] = VPURT.DeclareVirtualBarrier -> !VPURT.Barrier
+    // CHECK-DAG:   [[OUTPUT:%.*]] = VPURT.DeclareBuffer "DDR" <8192> -> memref<1x16x16x16xf16, #NHWC, @DDR>
+    // CHECK-DAG:   [[BUFFER0:%.*]] = VPURT.DeclareBuffer "DDR" <0> -> memref<1x16x16x16xf16, #NHWC, @DDR>
+    // CHECK-DAG:   [[OUTPUT0:%.*]] = VPURT.DeclareBuffer "DDR" <8192> -> memref<1x16x16x16xf16, #NHWC, @DDR>
+
+    // CHECK:       VPURT.Task updates([[BARRIER]] : !VPURT.Barrier)
+    // CHECK:           VPUIP.UpsamplingDMAOp
+    // CHECK-SAME:          port = 0 : i64
+    // CHECK-SAME:      outputs([[BUFFER0]] : memref<1x16x16x16xf16, #NHWC, @DDR>)
+
+    // CHECK:       VPURT.Task waits([[BARRIER]] : !VPURT.Barrier)
+    // CHECK:           VPUIP.UpsamplingDMAOp
+    // CHECK-SAME:          port = 0 : i64
+    // CHECK-SAME:      outputs([[OUTPUT0]] : memref<1x16x16x16xf16, #NHWC, @DDR>)
+
+    // CHECK:       return [[OUTPUT]] : memref<1x16x16x16xf16, #NHWC, @DDR>
+}
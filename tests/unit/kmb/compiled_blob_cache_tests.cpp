@@ -0,0 +1,133 @@
+//
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#ifndef _WIN32
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+#include <utime.h>
+
+#include "vpux_compiled_blob_cache.h"
+
+namespace {
+
+std::vector<char> makeBlob(size_t size, char fill) {
+    return std::vector<char>(size, fill);
+}
+
+vpux::CompiledBlobCache::BlobWriter writeBlob(const std::vector<char>& blob) {
+    return [&blob](std::ostream& stream) {
+        stream.write(blob.data(), blob.size());
+    };
+}
+
+}  // namespace
+
+class CompiledBlobCacheUnitTests : public ::testing::Test {
+protected:
+    std::string cacheDir;
+    vpux::CompiledBlobCache::Statistics stats;
+    vpux::Logger logger{"CompiledBlobCacheUnitTests", vpux::LogLevel::Error};
+
+    void SetUp() override {
+        char dirTemplate[] = "/tmp/vpux_blob_cache_XXXXXX";
+        ASSERT_NE(nullptr, mkdtemp(dirTemplate));
+        cacheDir = dirTemplate;
+    }
+
+    void TearDown() override {
+        const auto cmd = "rm -rf " + cacheDir;
+        std::system(cmd.c_str());
+    }
+
+    bool entryExists(const std::string& key) const {
+        return std::ifstream(cacheDir + "/" + key + ".blob").good();
+    }
+
+    void setLastAccess(const std::string& key, time_t time) const {
+        const struct utimbuf times = {time, time};
+        utime((cacheDir + "/" + key + ".blob").c_str(), &times);
+    }
+};
+
+TEST_F(CompiledBlobCacheUnitTests, missOnEmptyCache) {
+    vpux::CompiledBlobCache cache(cacheDir, 1024, stats, logger);
+
+    EXPECT_EQ(nullptr, cache.load("0123456789abcdef"));
+    EXPECT_EQ(0u, stats.hits.load());
+    EXPECT_EQ(1u, stats.misses.load());
+}
+
+TEST_F(CompiledBlobCacheUnitTests, loadReturnsStoredBlob) {
+    vpux::CompiledBlobCache cache(cacheDir, 1024, stats, logger);
+    const auto blob = makeBlob(100, 'a');
+
+    cache.store("key", writeBlob(blob));
+    const auto cachedBlob = cache.load("key");
+
+    ASSERT_NE(nullptr, cachedBlob);
+    ASSERT_EQ(blob.size(), cachedBlob->size());
+    EXPECT_EQ(blob, std::vector<char>(cachedBlob->data(), cachedBlob->data() + cachedBlob->size()));
+    EXPECT_EQ(1u, stats.hits.load());
+    EXPECT_EQ(blob.size(), stats.bytes.load());
+}
+
+TEST_F(CompiledBlobCacheUnitTests, cachedBlobIsSeekableStream) {
+    vpux::CompiledBlobCache cache(cacheDir, 1024, stats, logger);
+    const auto blob = makeBlob(64, 'b');
+
+    cache.store("key", writeBlob(blob));
+    const auto cachedBlob = cache.load("key");
+    ASSERT_NE(nullptr, cachedBlob);
+
+    std::istream stream(cachedBlob.get());
+    stream.seekg(0, std::ios_base::end);
+    EXPECT_EQ(static_cast<std::streamoff>(blob.size()), static_cast<std::streamoff>(stream.tellg()));
+    stream.seekg(0, std::ios_base::beg);
+
+    std::vector<char> data(blob.size());
+    stream.read(data.data(), data.size());
+    EXPECT_EQ(blob, data);
+}
+
+TEST_F(CompiledBlobCacheUnitTests, evictsLeastRecentlyUsedEntries) {
+    vpux::CompiledBlobCache cache(cacheDir, 250, stats, logger);
+    const auto blob = makeBlob(100, 'c');
+
+    cache.store("first", writeBlob(blob));
+    cache.store("second", writeBlob(blob));
+    setLastAccess("first", 1000);
+    setLastAccess("second", 2000);
+
+    cache.store("third", writeBlob(blob));
+
+    EXPECT_FALSE(entryExists("first"));
+    EXPECT_TRUE(entryExists("second"));
+    EXPECT_TRUE(entryExists("third"));
+}
+
+TEST_F(CompiledBlobCacheUnitTests, keepsMappedBlobAfterEviction) {
+    vpux::CompiledBlobCache cache(cacheDir, 150, stats, logger);
+    const auto blob = makeBlob(100, 'd');
+
+    cache.store("first", writeBlob(blob));
+    const auto cachedBlob = cache.load("first");
+    ASSERT_NE(nullptr, cachedBlob);
+    setLastAccess("first", 1000);
+
+    cache.store("second", writeBlob(makeBlob(100, 'e')));
+
+    EXPECT_FALSE(entryExists("first"));
+    EXPECT_EQ(blob, std::vector<char>(cachedBlob->data(), cachedBlob->data() + cachedBlob->size()));
+}
+
+#endif
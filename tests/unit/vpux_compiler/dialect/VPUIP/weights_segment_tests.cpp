@@ -0,0 +1,88 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/dialect/VPUIP/graph-schema/weights_segment.hpp"
+
+#include "vpux/utils/core/mem_size.hpp"
+
+#include <llvm/Support/raw_ostream.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+
+using namespace vpux;
+
+namespace {
+
+VPUIP::WeightsSegmentWriter::ContentWriter fillWith(char value) {
+    return [value](MutableArrayRef<char> storage) {
+        std::fill(storage.begin(), storage.end(), value);
+    };
+}
+
+}  // namespace
+
+TEST(MLIR_VPUIP_WeightsSegment, WriteAndRead) {
+    // Small staging buffer makes the writer split the entries into several batches
+    VPUIP::WeightsSegmentWriter writer(64, Byte(128));
+    EXPECT_EQ(0, writer.append(Byte(100), fillWith('a')));
+    EXPECT_EQ(1, writer.append(Byte(1), fillWith('b')));
+    EXPECT_EQ(2, writer.append(Byte(300), fillWith('c')));
+    EXPECT_EQ(3, writer.append(Byte(0), fillWith('d')));
+
+    std::string buffer;
+    llvm::raw_string_ostream stream(buffer);
+    writer.write(stream, LoopExecPolicy::Parallel);
+    stream.flush();
+
+    ASSERT_EQ(writer.getSegmentSize(), buffer.size());
+
+    const VPUIP::WeightsSegmentReader reader(makeArrayRef(buffer.data(), buffer.size()));
+    ASSERT_EQ(4, reader.numEntries());
+
+    const auto checkEntry = [&](uint64_t index, size_t size, char value) {
+        const auto entry = reader.getEntry(index);
+        ASSERT_EQ(size, entry.size());
+        EXPECT_EQ(0, (entry.data() - buffer.data()) % 64);
+        EXPECT_TRUE(std::all_of(entry.begin(), entry.end(), [value](char c) {
+            return c == value;
+        }));
+    };
+
+    checkEntry(0, 100, 'a');
+    checkEntry(1, 1, 'b');
+    checkEntry(2, 300, 'c');
+    checkEntry(3, 0, 'd');
+
+    EXPECT_ANY_THROW(reader.getEntry(4));
+}
+
+TEST(MLIR_VPUIP_WeightsSegment, FindTrailingSegment) {
+    VPUIP::WeightsSegmentWriter writer;
+    writer.append(Byte(16), fillWith('w'));
+
+    std::string blob = "metadata";
+    const auto metadataSize = blob.size();
+
+    llvm::raw_string_ostream stream(blob);
+    writer.write(stream, LoopExecPolicy::Parallel);
+    stream.flush();
+
+    const auto segment = VPUIP::WeightsSegmentReader::findTrailingSegment(makeArrayRef(blob.data(), blob.size()));
+    ASSERT_TRUE(segment.hasValue());
+    EXPECT_EQ(blob.size() - metadataSize, segment->size());
+
+    const VPUIP::WeightsSegmentReader reader(segment.getValue());
+    ASSERT_EQ(1, reader.numEntries());
+    EXPECT_EQ(16, reader.getEntry(0).size());
+
+    const std::string plainBlob = "metadata without weights segment, which is long enough to contain the footer";
+    EXPECT_FALSE(VPUIP::WeightsSegmentReader::findTrailingSegment(makeArrayRef(plainBlob.data(), plainBlob.size()))
+                         .hasValue());
+}
@@ -16,7 +16,11 @@
 
 #include <mlir/Dialect/Quant/QuantOps.h>
 #include <mlir/Dialect/Quant/QuantTypes.h>
+#include <mlir/IR/Builders.h>
 #include <mlir/IR/MLIRContext.h>
+#include <mlir/IR/OperationSupport.h>
+
+#include <llvm/Support/raw_ostream.h>
 
 #include <gtest/gtest.h>
 #include <vpux/compiler/utils/quantization.hpp>
@@ -147,6 +151,77 @@ TEST_F(MLIR_ConstContentAttrTest, FromOpaqueElementsAttr) {
     }
 }
 
+TEST_F(MLIR_ConstContentAttrTest, FromSharedElementsAttr) {
+    const auto baseType = mlir::RankedTensorType::get({1, 2, 3, 4}, mlir::Float32Type::get(&ctx));
+
+    auto vals = std::make_shared<std::vector<float>>(generateValues<float>(baseType.getNumElements()));
+    const auto bytes = makeArrayRef(reinterpret_cast<const char*>(vals->data()), vals->size() * sizeof(float));
+    const auto buffer = Const::SharedBuffer::create(bytes, vals);
+
+    const std::weak_ptr<std::vector<float>> weakVals = vals;
+    vals.reset();
+    // The data is owned by the buffer
+    ASSERT_FALSE(weakVals.expired());
+
+    const auto baseAttr = Const::SharedElementsAttr::get(baseType, buffer);
+    EXPECT_EQ(baseAttr.getRawData().data(), bytes.data());
+    EXPECT_EQ(baseAttr, Const::SharedElementsAttr::get(baseType, buffer));
+    EXPECT_FALSE(buffer->hasContentHash());
+
+    const auto contentAttr = Const::ContentAttr::get(baseAttr);
+    ASSERT_NE(contentAttr, nullptr);
+    EXPECT_EQ(contentAttr.getType(), baseType);
+
+    const auto content = contentAttr.fold();
+    EXPECT_EQ(content.getType(), baseType);
+    EXPECT_FALSE(content.isSplat());
+
+    const auto contentVals = content.getValues<float>();
+    EXPECT_EQ(contentVals.size(), weakVals.lock()->size());
+
+    for (size_t i = 0; i < contentVals.size(); ++i) {
+        EXPECT_EQ(contentVals[i], static_cast<float>(i));
+    }
+
+    // Neither uniquing nor folding computes the content hash
+    EXPECT_FALSE(buffer->hasContentHash());
+
+    const auto copiedAttr = Const::SharedElementsAttr::get(baseType, Const::SharedBuffer::copy(bytes));
+    EXPECT_NE(copiedAttr, baseAttr);
+    EXPECT_EQ(copiedAttr.getContentHash(), baseAttr.getContentHash());
+    EXPECT_TRUE(buffer->hasContentHash());
+}
+
+TEST_F(MLIR_ConstContentAttrTest, PrintSharedElementsAttr) {
+    const auto baseType = mlir::RankedTensorType::get({1, 2, 3, 4}, mlir::Float32Type::get(&ctx));
+
+    const auto vals = generateValues<float>(baseType.getNumElements());
+    const auto bytes = makeArrayRef(reinterpret_cast<const char*>(vals.data()), vals.size() * sizeof(float));
+
+    const auto printDeclare = [&](mlir::ElementsAttr baseContent, const mlir::OpPrintingFlags& flags) {
+        mlir::OpBuilder builder(&ctx);
+        auto declareOp = builder.create<Const::DeclareOp>(mlir::UnknownLoc::get(&ctx), baseType,
+                                                          Const::ContentAttr::get(baseContent));
+
+        std::string str;
+        llvm::raw_string_ostream stream(str);
+        declareOp->print(stream, flags);
+        declareOp->erase();
+        return stream.str();
+    };
+
+    const auto sharedAttr = Const::SharedElementsAttr::get(baseType, Const::SharedBuffer::copy(bytes));
+    const auto denseAttr = mlir::DenseElementsAttr::get(baseType, makeArrayRef(vals));
+
+    // The shared constants are printed exactly as the dense ones, including the elided form
+    EXPECT_EQ(printDeclare(sharedAttr, mlir::OpPrintingFlags()), printDeclare(denseAttr, mlir::OpPrintingFlags()));
+
+    const auto elidedFlags = mlir::OpPrintingFlags().elideLargeElementsAttrs(4);
+    const auto elided = printDeclare(sharedAttr, elidedFlags);
+    EXPECT_EQ(elided, printDeclare(denseAttr, elidedFlags));
+    EXPECT_LT(elided.size(), printDeclare(denseAttr, mlir::OpPrintingFlags()).size());
+}
+
 TEST_F(MLIR_ConstContentAttrTest, ConvertStorageElemType) {
     const auto baseType = mlir::RankedTensorType::get({1, 2, 3, 4}, mlir::Float32Type::get(&ctx));
 
@@ -743,6 +818,57 @@ TEST_F(MLIR_ConstContentAttrTest, SubViewSplat) {
     EXPECT_EQ(content.getSplatValue<int32_t>(), splatVal);
 }
 
+TEST_F(MLIR_ConstContentAttrTest, RelocateWeightsTable) {
+    const int64_t OC = 4;
+    const int64_t numElemPerOC = 4;
+
+    // One more channel is added to check the relocation of the table, which was already copied by subview
+    std::vector<int32_t> vals;
+    for (int64_t oc = 0; oc < OC + 1; ++oc) {
+        vals.insert(vals.end(), {checked_cast<int32_t>(oc * 16), checked_cast<int32_t>(oc * 8),
+                                 checked_cast<int32_t>(100 + oc), checked_cast<int32_t>(200 + oc)});
+    }
+
+    const auto tableType = mlir::RankedTensorType::get({OC, 1, 1, numElemPerOC}, getSInt32Type(&ctx));
+    const auto extTableType = mlir::RankedTensorType::get({OC + 1, 1, 1, numElemPerOC}, getSInt32Type(&ctx));
+
+    const auto tableAttr = Const::ContentAttr::get(
+            mlir::DenseElementsAttr::get(tableType, makeArrayRef(vals).take_front(OC * numElemPerOC)));
+    const auto extTableAttr = Const::ContentAttr::get(mlir::DenseElementsAttr::get(extTableType, makeArrayRef(vals)))
+                                      .subview({0, 0, 0, 0}, {OC, 1, 1, numElemPerOC});
+
+    const int64_t weightsPtr = 1000;
+    const int64_t sparsityPtr = 2000;
+    const SmallVector<int64_t> clusterOffsets = {0, 2};
+
+    for (const auto& baseAttr : {tableAttr, extTableAttr}) {
+        const auto contentAttr =
+                baseAttr.relocateWeightsTablePointers(weightsPtr, sparsityPtr, ShapeRef(clusterOffsets), 1, nullptr);
+        ASSERT_NE(contentAttr, nullptr);
+        EXPECT_EQ(contentAttr.getType(), tableType);
+
+        const auto content = contentAttr.fold();
+        const auto contentVals = content.getValues<int32_t>();
+        ASSERT_EQ(contentVals.size(), OC * numElemPerOC);
+
+        for (int64_t oc = 0; oc < OC; ++oc) {
+            const auto clusterOC = oc - (oc < clusterOffsets[1] ? clusterOffsets[0] : clusterOffsets[1]);
+            EXPECT_EQ(contentVals[oc * numElemPerOC + 0], weightsPtr + clusterOC * 16) << oc;
+            EXPECT_EQ(contentVals[oc * numElemPerOC + 1], sparsityPtr + clusterOC * 8) << oc;
+            EXPECT_EQ(contentVals[oc * numElemPerOC + 2], 100 + oc) << oc;
+            EXPECT_EQ(contentVals[oc * numElemPerOC + 3], 200 + oc) << oc;
+        }
+
+        // The exporters resolve the relocation directly in the destination buffer
+        std::vector<int32_t> exportedVals(contentVals.size());
+        contentAttr.copyFoldedTo(makeMutableArrayRef(reinterpret_cast<char*>(exportedVals.data()),
+                                                     exportedVals.size() * sizeof(int32_t)));
+        for (size_t i = 0; i < exportedVals.size(); ++i) {
+            EXPECT_EQ(exportedVals[i], contentVals[i]) << i;
+        }
+    }
+}
+
 TEST_F(MLIR_ConstContentAttrTest, BitPack) {
     const int64_t IC = 1;
     const int64_t IH = 2;
@@ -1146,3 +1272,10 @@ TEST_F(MLIR_ConstContentAttrTest, PositionRequirement) {
     EXPECT_EQ(finalTransformations[2].getTransformationName(), "Sparsify");
     EXPECT_EQ(finalTransformations[3].getTransformationName(), "SwizzleConstant");
 }
+
+TEST_F(MLIR_ConstContentAttrTest, FoldingExecPolicy) {
+    EXPECT_EQ(Const::getFoldingExecPolicy(&ctx), LoopExecPolicy::Parallel);
+
+    ctx.disableMultithreading();
+    EXPECT_EQ(Const::getFoldingExecPolicy(&ctx), LoopExecPolicy::Sequential);
+}
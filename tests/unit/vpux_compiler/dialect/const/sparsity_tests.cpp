@@ -0,0 +1,186 @@
+//
+// Copyright (C) 2023 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/dialect/const/utils/sparsity.hpp"
+
+#include "vpux/utils/IE/float16.hpp"
+#include "vpux/utils/core/numeric.hpp"
+
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+constexpr int64_t ALIGNMENT = 16;
+
+template <typename T>
+using IsFloat = std::integral_constant<bool, std::is_floating_point<T>::value || std::is_same<T, float16>::value ||
+                                                     std::is_same<T, bfloat16>::value>;
+
+// The floating point weights also contain the negative zeros and NaNs, which must be handled as with
+// the value comparison
+template <typename T>
+T generateValue(uint32_t r, std::true_type) {
+    if (r % 7 == 1) {
+        return T(-0.0f);
+    } else if (r % 11 == 1) {
+        return T(std::numeric_limits<float>::quiet_NaN());
+    }
+    return T(static_cast<float>(r % 100));
+}
+
+template <typename T>
+T generateValue(uint32_t r, std::false_type) {
+    return static_cast<T>(r % 100);
+}
+
+// About a half of the elements are equal to the sparse value
+template <typename T>
+std::vector<T> generateWeights(size_t size, T sparseValue) {
+    std::vector<T> vals(size);
+    uint32_t state = 12345;
+    for (auto& val : vals) {
+        state = state * 1664525u + 1013904223u;
+        const auto r = state >> 8;
+        val = r % 2 == 0 ? sparseValue : generateValue<T>(r >> 1, IsFloat<T>());
+    }
+    return vals;
+}
+
+template <typename T>
+std::vector<uint8_t> referenceSparsityMap(const std::vector<T>& weights, int64_t numOC, T sparseValue,
+                                          int64_t mapSizePerOC) {
+    std::vector<uint8_t> map(numOC * mapSizePerOC, 0);
+    const auto workloadSize = weights.size() / numOC;
+    for (size_t oc = 0; oc < static_cast<size_t>(numOC); ++oc) {
+        size_t outIdx = oc * mapSizePerOC;
+        for (size_t inIdx = 0; inIdx < workloadSize; inIdx += CHAR_BIT) {
+            uint8_t byteValue = 0;
+            for (size_t bitShift = 0; bitShift < CHAR_BIT; ++bitShift) {
+                const auto idx = oc * workloadSize + inIdx + bitShift;
+                if (idx < weights.size() && weights[idx] != sparseValue) {
+                    byteValue |= (1 << bitShift);
+                }
+            }
+            map[outIdx++] = byteValue;
+        }
+    }
+    return map;
+}
+
+template <typename T>
+std::vector<char> referenceCompactWeights(const std::vector<T>& weights, int64_t numOC, T sparseValue,
+                                          size_t outputSize) {
+    std::vector<char> output(outputSize, 0);
+    auto outPtr = reinterpret_cast<T*>(output.data());
+    const auto workloadSize = weights.size() / numOC;
+
+    size_t outputIndex = 0;
+    for (size_t oc = 0; oc < static_cast<size_t>(numOC); ++oc) {
+        for (size_t i = oc * workloadSize; i < (oc + 1) * workloadSize; ++i) {
+            if (weights[i] != sparseValue) {
+                outPtr[outputIndex++] = weights[i];
+            }
+        }
+        outputIndex = alignVal<size_t>(outputIndex * sizeof(T), ALIGNMENT) / sizeof(T);
+    }
+    return output;
+}
+
+template <typename T>
+class MLIR_ConstSparsityTest : public testing::Test {};
+
+using SparsityStorageTypes = testing::Types<int8_t, uint8_t, float16, bfloat16, float>;
+TYPED_TEST_SUITE(MLIR_ConstSparsityTest, SparsityStorageTypes);
+
+}  // namespace
+
+TYPED_TEST(MLIR_ConstSparsityTest, CountNonSparseElements) {
+    using T = TypeParam;
+
+    const int64_t numOC = 16;
+    const auto sparseValue = T(0.0f);
+    const auto weights = generateWeights<T>(numOC * 3 * 3 * 37, sparseValue);
+
+    const auto numElems = Const::countNonSparseElements(makeArrayRef(weights), numOC, sparseValue);
+    ASSERT_EQ(numElems.size(), static_cast<size_t>(numOC));
+
+    const auto workloadSize = weights.size() / numOC;
+    for (int64_t oc = 0; oc < numOC; ++oc) {
+        int64_t expected = 0;
+        for (size_t i = oc * workloadSize; i < (oc + 1) * workloadSize; ++i) {
+            expected += weights[i] != sparseValue ? 1 : 0;
+        }
+        EXPECT_EQ(numElems[oc], expected) << oc;
+    }
+}
+
+TYPED_TEST(MLIR_ConstSparsityTest, BuildSparsityMap) {
+    using T = TypeParam;
+
+    // The second workload size isn't aligned to the byte size
+    for (const int64_t workloadSize : {int64_t(16 * 3 * 3), int64_t(3 * 3 * 5)}) {
+        for (const auto sparseValue : {T(0.0f), T(3.0f)}) {
+            const int64_t numOC = 33;
+            const auto mapSizePerOC = alignVal<int64_t>(divUp<int64_t>(workloadSize, CHAR_BIT), ALIGNMENT);
+            const auto weights = generateWeights<T>(numOC * workloadSize, sparseValue);
+
+            std::vector<uint8_t> map(numOC * mapSizePerOC, 0);
+            Const::buildSparsityMap(makeArrayRef(weights), numOC, sparseValue, mapSizePerOC,
+                                    makeMutableArrayRef(reinterpret_cast<char*>(map.data()), map.size()));
+
+            EXPECT_EQ(map, referenceSparsityMap(weights, numOC, sparseValue, mapSizePerOC)) << workloadSize;
+        }
+    }
+}
+
+TYPED_TEST(MLIR_ConstSparsityTest, CompactWeights) {
+    using T = TypeParam;
+
+    for (const auto sparseValue : {T(0.0f), T(3.0f)}) {
+        const int64_t numOC = 33;
+        const auto weights = generateWeights<T>(numOC * 3 * 3 * 13, sparseValue);
+
+        const auto numElems = Const::countNonSparseElements(makeArrayRef(weights), numOC, sparseValue);
+        size_t outputSize = 0;
+        for (const auto num : numElems) {
+            outputSize += alignVal<size_t>(num * sizeof(T), ALIGNMENT);
+        }
+
+        std::vector<char> output(outputSize, 0);
+        Const::compactWeights(makeArrayRef(weights), numOC, sparseValue, ALIGNMENT, output);
+
+        EXPECT_EQ(output, referenceCompactWeights(weights, numOC, sparseValue, outputSize));
+    }
+}
+
+TYPED_TEST(MLIR_ConstSparsityTest, CompactWeightsDense) {
+    using T = TypeParam;
+
+    // No sparse elements at all, so the data of each output channel fills its aligned slot completely
+    const int64_t numOC = 8;
+    const int64_t workloadSize = ALIGNMENT;
+    std::vector<T> weights(numOC * workloadSize, T(1.0f));
+
+    std::vector<char> output(weights.size() * sizeof(T), 0);
+    Const::compactWeights(makeArrayRef(weights), numOC, T(0.0f), ALIGNMENT, output);
+
+    EXPECT_EQ(output, referenceCompactWeights(weights, numOC, T(0.0f), output.size()));
+}
+
+TEST(MLIR_ConstSparsity, CompactWeightsOutOfBounds) {
+    const std::vector<uint8_t> weights(64, 1);
+    std::vector<char> output(32, 0);
+
+    EXPECT_ANY_THROW(Const::compactWeights(makeArrayRef(weights), 4, uint8_t(0), ALIGNMENT, output));
+}
@@ -0,0 +1,88 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/utils/compile_telemetry.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/init.hpp"
+
+#include "vpux/utils/IE/float16.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Parser.h>
+#include <mlir/Pass/PassManager.h>
+#include <mlir/Transforms/Passes.h>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+TEST(MLIR_CompileTelemetry, PassRecords) {
+    mlir::DialectRegistry registry;
+    vpux::registerDialects(registry);
+
+    mlir::MLIRContext ctx(registry);
+
+    constexpr llvm::StringLiteral inputIR = R"(
+        module @test {
+            func @main(%arg0: tensor<1x8xf16>) -> tensor<1x8xf16> {
+                %cst0 = const.Declare tensor<1x8xf16> = dense<1.0> : tensor<1x8xf16>
+                %cst1 = const.Declare tensor<1x16xf16> = dense<2.0> : tensor<1x16xf16>
+                return %cst0 : tensor<1x8xf16>
+            }
+        }
+    )";
+
+    auto module = mlir::parseSourceString(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    const auto initialSize = getIRSize(module.get());
+    EXPECT_EQ(2, initialSize.numConstants);
+    EXPECT_EQ(48, initialSize.constBytes);
+
+    const auto telemetry = std::make_shared<CompileTelemetry>();
+
+    mlir::PassManager pm(&ctx, mlir::OpPassManager::Nesting::Implicit);
+    addTelemetry(pm, telemetry);
+    pm.addPass(mlir::createCanonicalizerPass());
+
+    ASSERT_TRUE(mlir::succeeded(pm.run(module.get())));
+
+    {
+        TelemetryScope exportTelemetry(telemetry.get(), "export", module.get());
+
+        // The splat content is folded into a single element
+        module->walk([](Const::DeclareOp declareOp) {
+            const auto content = declareOp.content();
+            EXPECT_TRUE(content.isSplat());
+        });
+    }
+
+    const auto records = telemetry->getRecords();
+    ASSERT_EQ(2, records.size());
+
+    EXPECT_EQ("canonicalize", records[0].name);
+    EXPECT_EQ("pass", records[0].kind);
+    EXPECT_FALSE(records[0].failed);
+    EXPECT_EQ(2, records[0].before.numConstants);
+    EXPECT_EQ(1, records[0].after.numConstants);
+    EXPECT_EQ(16, records[0].after.constBytes);
+    EXPECT_EQ(records[0].before.numOps - 1, records[0].after.numOps);
+
+    EXPECT_EQ("export", records[1].name);
+    EXPECT_EQ("stage", records[1].kind);
+    EXPECT_EQ("builtin.module", records[1].anchor);
+    EXPECT_EQ(records[0].after.numOps, records[1].after.numOps);
+    EXPECT_EQ(sizeof(float16), records[1].foldedBytes);
+
+    std::string json;
+    llvm::raw_string_ostream stream(json);
+    telemetry->printAsJson(stream);
+    stream.flush();
+    EXPECT_NE(std::string::npos, json.find("\"name\": \"canonicalize\""));
+    EXPECT_NE(std::string::npos, json.find("\"const_bytes_after\": 16"));
+    EXPECT_NE(std::string::npos, json.find("\"const_bytes_folded\": 2"));
+}
@@ -0,0 +1,78 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/compiler/utils/ir_statistics.hpp"
+#include "vpux/compiler/init.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Parser.h>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+TEST(MLIR_IRStatistics, ConstantsBuffersAndBarriers) {
+    mlir::DialectRegistry registry;
+    vpux::registerDialects(registry);
+
+    mlir::MLIRContext ctx(registry);
+
+    constexpr llvm::StringLiteral inputIR = R"(
+        module @test {
+            func @main() {
+                %cst0 = const.Declare tensor<1x8xf16> = dense<1.0> : tensor<1x8xf32>, [#const.ConvertElemType<f16>]
+                %cst1 = const.Declare tensor<1x8xf16> = dense<1.0> : tensor<1x8xf32>, [#const.ConvertElemType<f16>]
+                %cst2 = const.Declare tensor<1x16xf16> = dense<2.0> : tensor<1x16xf16>
+                %buf0 = VPURT.DeclareBuffer "DDR" <0> -> memref<1x1000xf16, @DDR>
+                %buf1 = VPURT.DeclareBuffer "DDR" <4096> -> memref<1x8xf16, @DDR>
+                %buf2 = memref.alloc() : memref<1x8xf16>
+                %bar0 = VPURT.DeclareVirtualBarrier -> !VPURT.Barrier
+                %bar1 = VPURT.DeclareVirtualBarrier -> !VPURT.Barrier
+                return
+            }
+        }
+    )";
+
+    auto module = mlir::parseSourceString(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    const auto stats = getIRStatistics(module.get());
+
+    EXPECT_EQ(3, stats.opsPerDialect.at("const"));
+    EXPECT_EQ(4, stats.opsPerDialect.at("VPURT"));
+    EXPECT_EQ(1, stats.opsPerDialect.at("memref"));
+
+    EXPECT_EQ(3, stats.numConstants);
+    // Splat base content is stored as a single element
+    EXPECT_EQ(4 + 4 + 2, stats.constBaseBytes);
+    EXPECT_EQ(16 + 16 + 32, stats.constFoldedBytes);
+    EXPECT_EQ(1, stats.maxTransformations);
+    EXPECT_EQ(2, stats.totalTransformations);
+    EXPECT_EQ(1, stats.transformationsHistogram.at(0));
+    EXPECT_EQ(2, stats.transformationsHistogram.at(1));
+
+    EXPECT_EQ(1, stats.numDuplicateGroups);
+    EXPECT_EQ(1, stats.numDuplicateConstants);
+    EXPECT_EQ(16, stats.duplicateFoldedBytes);
+
+    const auto& ddr = stats.buffersPerMemory.at("DDR");
+    EXPECT_EQ(3, ddr.count);
+    EXPECT_EQ(2000 + 16 + 16, ddr.bytes);
+    EXPECT_EQ(4096 + 16, ddr.extentBytes);
+
+    EXPECT_EQ(2, stats.numVirtualBarriers);
+    EXPECT_EQ(0, stats.numPhysicalBarriers);
+
+    std::string json;
+    llvm::raw_string_ostream stream(json);
+    printIRStatisticsAsJson(stats, "canonicalize", stream);
+    stream.flush();
+    // Single line, so the dumps after several passes form a JSON Lines file
+    EXPECT_EQ(json.size() - 1, json.find('\n'));
+    EXPECT_NE(std::string::npos, json.find("\"after_pass\":\"canonicalize\""));
+    EXPECT_NE(std::string::npos, json.find("\"folded_bytes\":64"));
+}
@@ -5,7 +5,9 @@
 
 //
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <climits>
+#include <cstring>
 #include <vector>
 #include "vpux/compiler/utils/swizzle_transform.hpp"
 
@@ -96,3 +98,51 @@ INSTANTIATE_TEST_SUITE_P(testUnligned_VPUX37XX_Key2, SwizzlingTest_VPUX37XX, Com
 INSTANTIATE_TEST_SUITE_P(testUnligned_VPUX37XX_Key3, SwizzlingTest_VPUX37XX, Combine(Values(3), Values(2049)));
 INSTANTIATE_TEST_SUITE_P(testUnligned_VPUX37XX_Key4, SwizzlingTest_VPUX37XX, Combine(Values(4), Values(1022)));
 INSTANTIATE_TEST_SUITE_P(testUnligned_VPUX37XX_Key5, SwizzlingTest_VPUX37XX, Combine(Values(5), Values(2049)));
+
+//
+// The swizzling by the precomputed stripe pattern must give exactly the same result as the address transformation
+// applied to each 16-byte chunk
+//
+
+class SwizzlingPatternTest_VPUX37XX : public TestWithParam<std::tuple<uint32_t, uint32_t>> {};
+
+std::vector<uint8_t> referenceSwizzle(const std::vector<uint8_t>& input, uint32_t swizzleKey, VPU::ArchKind archKind) {
+    BufferTransform::AddressTransform addressTransform{swizzleKey, archKind};
+    const auto copyDataWidth{1u << addressTransform.getLog2RamCutDataWidth()};
+
+    std::vector<uint8_t> output(input.size(), 0);
+    for (uint32_t dpuAddr{}; dpuAddr < input.size(); dpuAddr += copyDataWidth) {
+        const auto phyAddr{addressTransform.getPhysicalAddress(dpuAddr)};
+        memcpy(output.data() + phyAddr, input.data() + dpuAddr, copyDataWidth);
+    }
+
+    return output;
+}
+
+TEST_P(SwizzlingPatternTest_VPUX37XX, swizzlingPatternTest_VPUX37XX) {
+    const auto swizzleKey = std::get<0>(GetParam());
+    const auto size = std::get<1>(GetParam());
+
+    std::vector<uint8_t> input(size);
+    for (auto& val : input) {
+        val = static_cast<uint8_t>(rand() % 256);
+    }
+
+    BufferTransform::BufferSwizzleTransform bufferTransform{swizzleKey, VPU::ArchKind::VPUX37XX};
+
+    std::vector<uint8_t> swizzled(size, 0);
+    MutableArrayRef<uint8_t> swizzledArrayRef(swizzled);
+    const auto inputRawData = makeArrayRef(reinterpret_cast<const char*>(input.data()), input.size());
+    bufferTransform.swizzle<uint8_t>(inputRawData, swizzledArrayRef);
+
+    EXPECT_EQ(swizzled, referenceSwizzle(input, swizzleKey, VPU::ArchKind::VPUX37XX));
+
+    SmallVector<uint8_t> deswizzled(size, 0);
+    bufferTransform.deswizzle<uint8_t>(swizzledArrayRef, deswizzled);
+
+    EXPECT_TRUE(std::equal(input.begin(), input.end(), deswizzled.begin()));
+}
+
+// Less than one stripe, exactly one stripe of 16KB, several stripes and several stripes with the partial one
+INSTANTIATE_TEST_SUITE_P(testPattern_VPUX37XX, SwizzlingPatternTest_VPUX37XX,
+                         Combine(Values(0, 1, 2, 3, 4, 5), Values(4096, 16384, 65536, 70144)));
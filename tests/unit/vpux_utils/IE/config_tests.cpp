@@ -199,3 +199,28 @@ TEST_F(MLIR_ConfigSerializationTests, CanDumpLogLevel) {
 
     EXPECT_EQ(expected, conf.toString());
 }
+
+TEST_F(MLIR_ConfigSerializationTests, CanDumpStableString) {
+    struct RunTimeOption final : OptionBase<RunTimeOption, int64_t> {
+        static StringRef key() {
+            return "RUNTIME_OPT";
+        }
+
+        static OptionMode mode() {
+            return OptionMode::RunTime;
+        }
+    };
+
+    options->add<SimpleOption>();
+    options->add<PrivateOption>();
+    options->add<RunTimeOption>();
+    options->add<LOG_LEVEL>();
+
+    conf.update({{"RUNTIME_OPT", "1"}, {"PUBLIC_OPT", "NO"}});
+    conf.update({{"PRIVATE_OPT", "5"}, {"LOG_LEVEL", "LOG_TRACE"}});
+
+    EXPECT_EQ("LOG_LEVEL=\"LOG_TRACE\" PRIVATE_OPT=\"5\" PUBLIC_OPT=\"NO\"",
+              conf.toStableString(OptionMode::CompileTime));
+    EXPECT_EQ("PRIVATE_OPT=\"5\" PUBLIC_OPT=\"NO\"", conf.toStableString(OptionMode::CompileTime, {"LOG_LEVEL"}));
+    EXPECT_EQ("LOG_LEVEL=\"LOG_TRACE\" PUBLIC_OPT=\"NO\" RUNTIME_OPT=\"1\"", conf.toStableString(OptionMode::RunTime));
+}
@@ -0,0 +1,40 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/core/logger.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace vpux;
+
+TEST(MLIR_LoggerTest, AsyncBackend) {
+    const auto wasAsync = Logger::isAsync();
+    Logger::setAsync(true);
+    EXPECT_TRUE(Logger::isAsync());
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < 4; ++t) {
+        threads.emplace_back([t]() {
+            Logger log("async-test", LogLevel::Trace);
+            for (size_t i = 0; i < 8; ++i) {
+                log.trace("Thread {0} message {1}", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Far below the queue capacity, nothing must be lost
+    Logger::flush();
+    EXPECT_EQ(0, Logger::getNumDroppedEntries());
+
+    Logger::setAsync(wasAsync);
+}
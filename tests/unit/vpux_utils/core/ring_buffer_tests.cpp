@@ -0,0 +1,76 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/core/ring_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace vpux;
+
+TEST(MLIR_RingBufferTest, SimpleUsage) {
+    RingBuffer<int> buffer(3);
+
+    for (int i = 0; i < 5; ++i) {
+        if (buffer.full()) {
+            buffer.pop();
+        }
+        buffer.push(i);
+    }
+
+    EXPECT_EQ(3, buffer.size());
+    EXPECT_EQ(2, buffer.front());
+    EXPECT_EQ(4, buffer.back());
+}
+
+TEST(MLIR_SpscRingBufferTest, Bounded) {
+    SpscRingBuffer<int> buffer(4);
+    EXPECT_EQ(4, buffer.capacity());
+    EXPECT_TRUE(buffer.empty());
+
+    int val = 0;
+    EXPECT_FALSE(buffer.tryPop(val));
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(buffer.tryPush(i));
+    }
+    EXPECT_FALSE(buffer.tryPush(4));
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(buffer.tryPop(val));
+        EXPECT_EQ(i, val);
+    }
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(MLIR_SpscRingBufferTest, ProducerConsumer) {
+    constexpr int count = 100000;
+    SpscRingBuffer<int> buffer(16);
+
+    std::thread producer([&]() {
+        for (int i = 0; i < count; ++i) {
+            while (!buffer.tryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    while (expected < count) {
+        int val = 0;
+        if (buffer.tryPop(val)) {
+            ASSERT_EQ(expected, val);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(buffer.empty());
+}
@@ -0,0 +1,96 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/plugin/predicted_cycles.hpp"
+#include "vpux/utils/plugin/weights_segment_format.hpp"
+
+#include "profiling_test_utils.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+
+using namespace vpux::profiling;
+using namespace vpux::profiling::test;
+
+TEST(PredictedCycles, SerializeAndFind) {
+    PredictedCycles predicted;
+    predicted.frequencyMHz = 1000.0;
+    predicted.tasks = {{"conv", "CONV", TaskInfo::ExecType::DPU, 1000}, {"conv", "NNDMA", TaskInfo::ExecType::DMA, 7}};
+
+    const auto segment = serializePredictedCycles(predicted, 64);
+    ASSERT_EQ(0, segment.size() % 64);
+
+    // Graph, predicted cycles and fake weights segment, which consists of the footer only
+    std::vector<uint8_t> blob(100, 0xFF);
+    blob.insert(blob.end(), segment.begin(), segment.end());
+    vpux::WeightsSegmentFooter weightsFooter = {};
+    std::memcpy(weightsFooter.magic, vpux::WEIGHTS_SEGMENT_MAGIC, sizeof(weightsFooter.magic));
+    weightsFooter.version = vpux::WEIGHTS_SEGMENT_VERSION;
+    weightsFooter.segmentSize = sizeof(weightsFooter);
+    const auto weightsFooterData = reinterpret_cast<const uint8_t*>(&weightsFooter);
+    blob.insert(blob.end(), weightsFooterData, weightsFooterData + sizeof(weightsFooter));
+
+    PredictedCycles found;
+    ASSERT_TRUE(findPredictedCycles(blob.data(), blob.size(), found));
+    EXPECT_EQ(1000.0, found.frequencyMHz);
+    ASSERT_EQ(2, found.tasks.size());
+    EXPECT_EQ("conv", found.tasks[1].name);
+    EXPECT_EQ("NNDMA", found.tasks[1].opType);
+    EXPECT_EQ(TaskInfo::ExecType::DMA, found.tasks[1].execType);
+    EXPECT_EQ(7, found.tasks[1].cycles);
+
+    const std::vector<uint8_t> plainBlob(100, 0xFF);
+    EXPECT_FALSE(findPredictedCycles(plainBlob.data(), plainBlob.size(), found));
+}
+
+TEST(PredictedCycles, Correlate) {
+    PredictedCycles predicted;
+    predicted.frequencyMHz = 500.0;
+    predicted.tasks = {
+            {"conv1", "CONV", TaskInfo::ExecType::DPU, 500},     // 1000 ns
+            {"conv2", "CONV", TaskInfo::ExecType::DPU, 5000},    // 10000 ns
+            {"pool", "MAXPOOL", TaskInfo::ExecType::DPU, 1000},  // 2000 ns
+            {"conv1", "NNDMA", TaskInfo::ExecType::DMA, 100},    // 200 ns
+            {"absent", "NNDMA", TaskInfo::ExecType::DMA, 100},
+    };
+
+    const std::vector<TaskInfo> measured = {
+            makeTask("conv1", TaskInfo::ExecType::DPU, 0, 2000),
+            makeTask("conv2", TaskInfo::ExecType::DPU, 0, 8000),
+            makeTask("pool", TaskInfo::ExecType::DPU, 0, 2000),
+            // DMAs of the same layer are summed
+            makeTask("conv1", TaskInfo::ExecType::DMA, 0, 100),
+            makeTask("conv1", TaskInfo::ExecType::DMA, 0, 100),
+            makeTask("softmax", TaskInfo::ExecType::SW, 0, 300),
+    };
+
+    const auto report = correlatePredictedCycles(predicted, measured);
+    EXPECT_EQ(1, report.numUnmatchedPredicted);
+    EXPECT_EQ(1, report.numUnmatchedMeasured);
+
+    ASSERT_EQ(4, report.entries.size());
+    EXPECT_EQ("conv2", report.entries[0].name);
+    EXPECT_DOUBLE_EQ(0.25, report.entries[0].relativeError());
+    EXPECT_EQ("conv1", report.entries[1].name);
+    EXPECT_DOUBLE_EQ(-0.5, report.entries[1].relativeError());
+    EXPECT_EQ(200, report.entries.back().measuredNs);
+    EXPECT_DOUBLE_EQ(0.0, report.entries.back().relativeError());
+
+    ASSERT_EQ(3, report.opTypes.size());
+    EXPECT_EQ("CONV", report.opTypes[0].opType);
+    EXPECT_EQ(2, report.opTypes[0].count);
+    EXPECT_EQ(11000, report.opTypes[0].predictedNs);
+    EXPECT_EQ(10000, report.opTypes[0].measuredNs);
+    EXPECT_DOUBLE_EQ(0.375, report.opTypes[0].meanAbsError);
+    EXPECT_DOUBLE_EQ(0.5, report.opTypes[0].p90AbsError);
+
+    std::stringstream stream;
+    printCycleCorrelationAsJson(report, 2, stream);
+    EXPECT_NE(std::string::npos, stream.str().find("\"matched\":4"));
+}
@@ -0,0 +1,158 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/plugin/profiling_aggregator.hpp"
+
+#include "profiling_test_utils.hpp"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <sstream>
+
+using namespace vpux::profiling;
+using namespace vpux::profiling::test;
+
+TEST(DurationHistogram, ExactForSmallValues) {
+    DurationHistogram histogram;
+    for (uint64_t value = 1; value <= DurationHistogram::SUB_BUCKET_COUNT; ++value) {
+        histogram.record(value);
+    }
+
+    EXPECT_EQ(DurationHistogram::SUB_BUCKET_COUNT, histogram.count());
+    EXPECT_EQ(1, histogram.min());
+    EXPECT_EQ(DurationHistogram::SUB_BUCKET_COUNT, histogram.max());
+    EXPECT_EQ(DurationHistogram::SUB_BUCKET_COUNT / 2, histogram.percentile(50.0));
+    EXPECT_EQ(DurationHistogram::SUB_BUCKET_COUNT, histogram.percentile(100.0));
+}
+
+TEST(DurationHistogram, BoundedRelativeError) {
+    DurationHistogram histogram;
+    for (uint64_t value = 1; value <= 100000; ++value) {
+        histogram.record(value * 1000);
+    }
+
+    const auto checkPercentile = [&](double percent, uint64_t expected) {
+        const auto actual = static_cast<double>(histogram.percentile(percent));
+        EXPECT_NEAR(static_cast<double>(expected), actual,
+                    static_cast<double>(expected) / DurationHistogram::SUB_BUCKET_COUNT);
+    };
+
+    checkPercentile(50.0, 50000000);
+    checkPercentile(90.0, 90000000);
+    checkPercentile(99.0, 99000000);
+    EXPECT_EQ(1000, histogram.min());
+    EXPECT_EQ(100000000, histogram.max());
+    EXPECT_EQ(100000000, histogram.percentile(100.0));
+}
+
+TEST(DurationHistogram, ClampsHugeValues) {
+    DurationHistogram histogram;
+    histogram.record(std::numeric_limits<uint64_t>::max());
+    histogram.record(5);
+
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), histogram.max());
+    EXPECT_EQ(5, histogram.percentile(50.0));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(), histogram.percentile(100.0));
+}
+
+TEST(DurationHistogram, Merge) {
+    DurationHistogram first;
+    DurationHistogram second;
+    first.record(10);
+    second.record(20);
+    second.record(30);
+
+    first.merge(second);
+    EXPECT_EQ(3, first.count());
+    EXPECT_EQ(10, first.min());
+    EXPECT_EQ(30, first.max());
+    EXPECT_EQ(20, first.percentile(50.0));
+    EXPECT_DOUBLE_EQ(20.0, first.mean());
+}
+
+TEST(ProfilingAggregator, AccumulatesInferences) {
+    ProfilingAggregator aggregator;
+
+    for (uint64_t i = 0; i < 100; ++i) {
+        // DPU tasks overlap, so DPU is busy for [0, 60) in each inference
+        const std::vector<TaskInfo> tasks = {
+                makeTask("conv", TaskInfo::ExecType::DPU, 0, 50),
+                makeTask("conv/cluster_0", TaskInfo::ExecType::DPU, 10, 50),
+                makeTask("dma", TaskInfo::ExecType::DMA, 60, 40 + i),
+        };
+        const std::vector<LayerInfo> layers = {makeLayer("conv", 0, 60)};
+        aggregator.addInference(tasks, layers);
+    }
+
+    const auto info = aggregator.getAggregatedInfo();
+    EXPECT_EQ(100, info.num_inferences);
+    EXPECT_EQ(100, info.inference.count);
+    EXPECT_EQ(100, info.inference.min_ns);
+    EXPECT_EQ(199, info.inference.max_ns);
+
+    ASSERT_EQ(3, info.tasks.size());
+    EXPECT_EQ("conv", info.tasks[0].name);
+    EXPECT_EQ("dma", info.tasks[2].name);
+    EXPECT_EQ(TaskInfo::ExecType::DMA, info.tasks[2].exec_type);
+    EXPECT_EQ(40, info.tasks[2].duration.min_ns);
+    EXPECT_EQ(139, info.tasks[2].duration.max_ns);
+
+    ASSERT_EQ(1, info.layers.size());
+    EXPECT_EQ(100, info.layers[0].duration.count);
+    EXPECT_EQ(60, info.layers[0].duration.p99_ns);
+
+    const double totalTime = 100 * 100 + 99 * 100 / 2;
+    EXPECT_DOUBLE_EQ(100 * 60 / totalTime, info.dpu_utilization);
+    EXPECT_DOUBLE_EQ((totalTime - 100 * 60) / totalTime, info.dma_utilization);
+    EXPECT_DOUBLE_EQ(0.0, info.sw_utilization);
+
+    std::stringstream stream;
+    printAggregatedProfilingAsJson(info, stream);
+    EXPECT_NE(std::string::npos, stream.str().find("\"inferences\":100"));
+
+    aggregator.reset();
+    EXPECT_EQ(0, aggregator.getNumInferences());
+    EXPECT_TRUE(aggregator.getAggregatedInfo().tasks.empty());
+}
+
+TEST(ProfilingAggregator, EscapesJsonNames) {
+    ProfilingAggregator aggregator;
+
+    const std::vector<TaskInfo> tasks = {makeTask("conv\"1\\2", TaskInfo::ExecType::DPU, 0, 50)};
+    const std::vector<LayerInfo> layers = {makeLayer("conv\"1\\2", 0, 50)};
+    aggregator.addInference(tasks, layers);
+
+    std::stringstream stream;
+    printAggregatedProfilingAsJson(aggregator.getAggregatedInfo(), stream);
+    EXPECT_NE(std::string::npos, stream.str().find(R"("name":"conv\"1\\2")"));
+    EXPECT_EQ(std::string::npos, stream.str().find(R"("name":"conv"1)"));
+}
+
+TEST(HostOverheadAggregator, AccumulatesStages) {
+    HostOverheadAggregator aggregator;
+    for (uint64_t i = 1; i <= 10; ++i) {
+        aggregator.record(HostOverheadStage::Push, i * 100);
+        aggregator.record(HostOverheadStage::Pull, 50);
+    }
+    aggregator.record(HostOverheadStage::Repack, 30);
+
+    const auto info = aggregator.getAggregatedInfo();
+    const auto& push = info.stages[static_cast<size_t>(HostOverheadStage::Push)];
+    EXPECT_EQ(10, push.count);
+    EXPECT_EQ(100, push.min_ns);
+    EXPECT_EQ(1000, push.max_ns);
+    EXPECT_DOUBLE_EQ(550.0, push.mean_ns);
+    EXPECT_EQ(10, info.stages[static_cast<size_t>(HostOverheadStage::Pull)].count);
+    EXPECT_EQ(1, info.stages[static_cast<size_t>(HostOverheadStage::Repack)].count);
+    EXPECT_EQ(0, info.stages[static_cast<size_t>(HostOverheadStage::Preprocessing)].count);
+
+    std::stringstream stream;
+    printHostOverheadAsJson(info, stream);
+    EXPECT_NE(std::string::npos, stream.str().find("\"push\":{\"count\":10"));
+
+    aggregator.reset();
+    EXPECT_EQ(0, aggregator.getAggregatedInfo().stages[static_cast<size_t>(HostOverheadStage::Push)].count);
+}
@@ -0,0 +1,38 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#pragma once
+
+#include "vpux/utils/plugin/profiling_parser.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace vpux {
+namespace profiling {
+namespace test {
+
+inline TaskInfo makeTask(const char* name, TaskInfo::ExecType execType, uint64_t start, uint64_t duration) {
+    TaskInfo task = {};
+    std::strncpy(task.name, name, sizeof(task.name) - 1);
+    task.exec_type = execType;
+    task.start_time_ns = start;
+    task.duration_ns = duration;
+    return task;
+}
+
+inline LayerInfo makeLayer(const char* name, uint64_t start, uint64_t duration) {
+    LayerInfo layer = {};
+    std::strncpy(layer.name, name, sizeof(layer.name) - 1);
+    layer.start_time_ns = start;
+    layer.duration_ns = duration;
+    return layer;
+}
+
+}  // namespace test
+}  // namespace profiling
+}  // namespace vpux
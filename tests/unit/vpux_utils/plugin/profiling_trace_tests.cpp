@@ -0,0 +1,51 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/IE/profiling.hpp"
+
+#include "profiling_test_utils.hpp"
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+using namespace vpux::profiling;
+using namespace vpux::profiling::test;
+
+TEST(ProfilingChromeTrace, TracksAndBarrierFlows) {
+    const std::vector<TaskInfo> tasks = {
+            makeTask("conv", TaskInfo::ExecType::DPU, 2000, 1000),
+            makeTask("conv/cluster_1", TaskInfo::ExecType::DPU, 2000, 1000),
+            makeTask("load", TaskInfo::ExecType::DMA, 0, 1000),
+            makeTask("load2", TaskInfo::ExecType::DMA, 500, 1500),
+            makeTask("softmax/cluster_0/tile_1", TaskInfo::ExecType::SW, 3000, 100),
+    };
+    std::vector<TaskScheduleInfo> schedule(tasks.size());
+    schedule[0].wait_barriers = {0};
+    schedule[2].update_barriers = {0};
+    schedule[3].update_barriers = {0};
+    schedule[3].dma_port = 1;
+
+    std::stringstream stream;
+    printProfilingAsChromeTrace(tasks, schedule, {}, stream);
+    const auto trace = stream.str();
+
+    EXPECT_NE(std::string::npos, trace.find(R"("args": {"name" : "DMA Port[0]"})"));
+    EXPECT_NE(std::string::npos, trace.find(R"("args": {"name" : "DMA Port[1]"})"));
+    EXPECT_NE(std::string::npos, trace.find(R"("args": {"name" : "Cluster[1]"})"));
+    EXPECT_NE(std::string::npos, trace.find(R"("args": {"name" : "SW Cluster[0] Shave[1]"})"));
+    EXPECT_EQ(std::string::npos, trace.find("Layers"));
+
+    // The barrier is released by the last producer, which is load2 on DMA Port[1]
+    const auto flowStart = trace.find(R"("ph":"s", "ts":0.500)");
+    ASSERT_NE(std::string::npos, flowStart);
+    const auto flowFinish = trace.find(R"("ph":"f", "ts":2.000)");
+    ASSERT_NE(std::string::npos, flowFinish);
+    EXPECT_LT(flowStart, flowFinish);
+
+    EXPECT_ANY_THROW(printProfilingAsChromeTrace(tasks, {}, {}, stream));
+}
@@ -0,0 +1,361 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "benchmark.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/format.hpp"
+
+#include <llvm/Support/Format.h>
+#include <llvm/Support/FormatVariadic.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/Regex.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <ctime>
+#include <mutex>
+#include <thread>
+
+using namespace vpux;
+using namespace vpux::bench;
+
+namespace {
+
+std::chrono::nanoseconds getProcessCpuTime() {
+    llvm::sys::TimePoint<> elapsed;
+    std::chrono::nanoseconds userTime;
+    std::chrono::nanoseconds sysTime;
+    llvm::sys::Process::GetTimeUsage(elapsed, userTime, sysTime);
+    return userTime + sysTime;
+}
+
+}  // namespace
+
+//
+// State
+//
+
+bool vpux::bench::State::keepRunning() {
+    if (!_started) {
+        _started = true;
+        startTimer();
+    }
+
+    if (_iterations < _maxIterations) {
+        ++_iterations;
+        return true;
+    }
+
+    if (_running) {
+        stopTimer();
+    }
+
+    return false;
+}
+
+void vpux::bench::State::pauseTiming() {
+    VPUX_THROW_UNLESS(_running, "Timer is not running");
+    stopTimer();
+}
+
+void vpux::bench::State::resumeTiming() {
+    VPUX_THROW_WHEN(_running, "Timer is already running");
+    startTimer();
+}
+
+void vpux::bench::State::startTimer() {
+    _running = true;
+    _cpuStart = getProcessCpuTime();
+    _realStart = std::chrono::steady_clock::now();
+}
+
+void vpux::bench::State::stopTimer() {
+    _realTime += std::chrono::steady_clock::now() - _realStart;
+    _cpuTime += getProcessCpuTime() - _cpuStart;
+    _running = false;
+}
+
+//
+// Registry
+//
+
+std::vector<Benchmark>& vpux::bench::getRegisteredBenchmarks() {
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+//
+// runBenchmarks
+//
+
+namespace {
+
+std::vector<State> runInstance(const Benchmark& benchmark, int64_t arg, int64_t iterations, int64_t numThreads) {
+    std::vector<State> states;
+    for (int64_t threadIndex = 0; threadIndex < numThreads; ++threadIndex) {
+        states.emplace_back(arg, iterations, threadIndex, numThreads);
+    }
+
+    if (numThreads == 1) {
+        benchmark.func(states.front());
+        return states;
+    }
+
+    // The threads are released at once, so the measured intervals overlap as much as possible
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool started = false;
+
+    std::vector<std::thread> threads;
+    for (auto& state : states) {
+        threads.emplace_back([&]() {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&]() {
+                    return started;
+                });
+            }
+
+            try {
+                benchmark.func(state);
+            } catch (const std::exception& ex) {
+                state.skipWithError(ex.what());
+            }
+        });
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        started = true;
+    }
+    cv.notify_all();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    return states;
+}
+
+std::string getError(const std::vector<State>& states) {
+    for (const auto& state : states) {
+        if (!state.error().empty()) {
+            return state.error();
+        }
+    }
+    return {};
+}
+
+std::chrono::nanoseconds getRealTime(const std::vector<State>& states) {
+    std::chrono::nanoseconds realTime{};
+    for (const auto& state : states) {
+        realTime = std::max(realTime, state.realTime());
+    }
+    return realTime;
+}
+
+BenchmarkResult makeResult(StringRef name, const std::vector<State>& states) {
+    const auto& mainState = states.front();
+
+    BenchmarkResult result;
+    result.name = name.str();
+    result.threads = static_cast<int64_t>(states.size());
+    result.iterations = mainState.iterations();
+    result.error = getError(states);
+    result.counters = mainState.counters();
+
+    if (mainState.iterations() == 0) {
+        return result;
+    }
+
+    // The process CPU time of any thread already covers all of them
+    const auto realTimeNs = static_cast<double>(getRealTime(states).count());
+    result.realTimeNs = realTimeNs / static_cast<double>(mainState.iterations());
+    result.cpuTimeNs = static_cast<double>(mainState.cpuTime().count()) / static_cast<double>(mainState.iterations());
+
+    if (realTimeNs > 0.0) {
+        int64_t itemsProcessed = 0;
+        int64_t bytesProcessed = 0;
+        for (const auto& state : states) {
+            itemsProcessed += state.itemsProcessed();
+            bytesProcessed += state.bytesProcessed();
+        }
+
+        result.itemsPerSecond = static_cast<double>(itemsProcessed) * 1e9 / realTimeNs;
+        result.bytesPerSecond = static_cast<double>(bytesProcessed) * 1e9 / realTimeNs;
+    }
+
+    return result;
+}
+
+std::string getInstanceName(const Benchmark& benchmark, int64_t arg, int64_t numThreads) {
+    auto name = benchmark.name;
+    if (!benchmark.args.empty()) {
+        name += printToString("/{0}", arg);
+    }
+    if (benchmark.threads.size() > 1 || numThreads > 1) {
+        name += printToString("/threads:{0}", numThreads);
+    }
+    return name;
+}
+
+}  // namespace
+
+std::vector<BenchmarkResult> vpux::bench::runBenchmarks(const RunnerOptions& options, llvm::raw_ostream& log) {
+    llvm::Regex filter(options.filter.empty() ? ".*" : options.filter);
+    std::string regexErr;
+    VPUX_THROW_UNLESS(filter.isValid(regexErr), "Invalid benchmark filter '{0}' : {1}", options.filter, regexErr);
+
+    const auto minTimeNs = options.minTime * 1e9;
+    constexpr int64_t maxIterations = 1000000000;
+
+    std::vector<BenchmarkResult> results;
+
+    for (const auto& benchmark : getRegisteredBenchmarks()) {
+        const auto args = benchmark.args.empty() ? std::vector<int64_t>{0} : benchmark.args;
+        const auto threads = benchmark.threads.empty() ? std::vector<int64_t>{1} : benchmark.threads;
+
+        for (const auto arg : args) {
+            for (const auto numThreads : threads) {
+                const auto name = getInstanceName(benchmark, arg, numThreads);
+                if (!filter.match(name)) {
+                    continue;
+                }
+
+                for (int64_t rep = 0; rep < options.repetitions; ++rep) {
+                    log << "Running " << name << "\n";
+                    log.flush();
+
+                    if (benchmark.iterations > 0) {
+                        const auto states = runInstance(benchmark, arg, benchmark.iterations, numThreads);
+                        results.push_back(makeResult(name, states));
+                        continue;
+                    }
+
+                    // Grow the number of iterations until the run takes long enough, like Google Benchmark does
+                    int64_t iterations = 1;
+                    while (true) {
+                        const auto states = runInstance(benchmark, arg, iterations, numThreads);
+                        const auto realTimeNs = static_cast<double>(getRealTime(states).count());
+
+                        if (!getError(states).empty() || realTimeNs >= minTimeNs || iterations >= maxIterations) {
+                            results.push_back(makeResult(name, states));
+                            break;
+                        }
+
+                        const auto multiplier = realTimeNs > 0.0 ? std::min(10.0, minTimeNs * 1.4 / realTimeNs) : 10.0;
+                        iterations = std::min(maxIterations,
+                                              std::max(iterations + 1, static_cast<int64_t>(iterations * multiplier)));
+                    }
+                }
+            }
+        }
+    }
+
+    return results;
+}
+
+//
+// printResultsAsJson
+//
+
+void vpux::bench::printResultsAsJson(const std::vector<BenchmarkResult>& results, StringRef executable,
+                                     llvm::raw_ostream& stream) {
+    char dateStr[32] = {};
+    const auto now = std::time(nullptr);
+    if (const auto tm = std::localtime(&now)) {
+        std::strftime(dateStr, sizeof(dateStr), "%Y-%m-%dT%H:%M:%S", tm);
+    }
+
+    llvm::json::OStream json(stream, 2);
+    json.object([&]() {
+        json.attributeObject("context", [&]() {
+            json.attribute("date", dateStr);
+            json.attribute("executable", executable);
+            json.attribute("num_cpus", static_cast<int64_t>(std::thread::hardware_concurrency()));
+#ifdef NDEBUG
+            json.attribute("library_build_type", "release");
+#else
+            json.attribute("library_build_type", "debug");
+#endif
+        });
+
+        json.attributeArray("benchmarks", [&]() {
+            for (const auto& result : results) {
+                json.object([&]() {
+                    json.attribute("name", result.name);
+                    json.attribute("run_name", result.name);
+                    json.attribute("run_type", "iteration");
+                    json.attribute("threads", result.threads);
+                    json.attribute("iterations", result.iterations);
+                    json.attribute("real_time", result.realTimeNs);
+                    json.attribute("cpu_time", result.cpuTimeNs);
+                    json.attribute("time_unit", "ns");
+
+                    if (result.itemsPerSecond > 0.0) {
+                        json.attribute("items_per_second", result.itemsPerSecond);
+                    }
+                    if (result.bytesPerSecond > 0.0) {
+                        json.attribute("bytes_per_second", result.bytesPerSecond);
+                    }
+
+                    for (const auto& counter : result.counters) {
+                        json.attribute(counter.first, counter.second);
+                    }
+
+                    if (!result.error.empty()) {
+                        json.attribute("error_occurred", true);
+                        json.attribute("error_message", result.error);
+                    }
+                });
+            }
+        });
+    });
+
+    stream << "\n";
+}
+
+//
+// printResultsAsText
+//
+
+void vpux::bench::printResultsAsText(const std::vector<BenchmarkResult>& results, llvm::raw_ostream& stream) {
+    size_t nameWidth = 9;
+    for (const auto& result : results) {
+        nameWidth = std::max(nameWidth, result.name.size());
+    }
+
+    stream << llvm::left_justify("Benchmark", nameWidth) << llvm::right_justify("Time (ms)", 16)
+           << llvm::right_justify("CPU (ms)", 16) << llvm::right_justify("Iterations", 14) << "\n";
+    stream << std::string(nameWidth + 46, '-') << "\n";
+
+    for (const auto& result : results) {
+        stream << llvm::left_justify(result.name, nameWidth);
+
+        if (!result.error.empty()) {
+            stream << "  ERROR: " << result.error << "\n";
+            continue;
+        }
+
+        stream << llvm::formatv("{0,16:F3}{1,16:F3}{2,14}", result.realTimeNs / 1e6, result.cpuTimeNs / 1e6,
+                                result.iterations);
+
+        if (result.itemsPerSecond > 0.0) {
+            stream << llvm::formatv("  items/s={0:E2}", result.itemsPerSecond);
+        }
+        if (result.bytesPerSecond > 0.0) {
+            stream << llvm::formatv("  bytes/s={0:E2}", result.bytesPerSecond);
+        }
+        for (const auto& counter : result.counters) {
+            stream << llvm::formatv("  {0}={1:F3}", counter.first, counter.second);
+        }
+
+        stream << "\n";
+    }
+}
@@ -0,0 +1,195 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+// Minimal Google Benchmark style harness, the results are reported in the Google Benchmark JSON format,
+// so the usual comparison scripts can be used on them.
+//
+
+#pragma once
+
+#include "vpux/utils/core/helper_macros.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <llvm/Support/raw_ostream.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace vpux {
+namespace bench {
+
+//
+// State
+//
+
+class State final {
+public:
+    State(int64_t arg, int64_t maxIterations, int64_t threadIndex = 0, int64_t numThreads = 1)
+            : _arg(arg), _maxIterations(maxIterations), _threadIndex(threadIndex), _numThreads(numThreads) {
+    }
+
+public:
+    // The timer is started on the first call and stopped after the last iteration:
+    //   while (state.keepRunning()) { ... }
+    bool keepRunning();
+
+    void pauseTiming();
+    void resumeTiming();
+
+public:
+    // Size parameter of the benchmark instance
+    int64_t arg() const {
+        return _arg;
+    }
+
+    // The multi-threaded instances run the benchmark function in every thread at the same time
+    int64_t threadIndex() const {
+        return _threadIndex;
+    }
+
+    int64_t numThreads() const {
+        return _numThreads;
+    }
+
+    void setItemsProcessed(int64_t items) {
+        _itemsProcessed = items;
+    }
+
+    void setBytesProcessed(int64_t bytes) {
+        _bytesProcessed = bytes;
+    }
+
+    // Reported in the results as is
+    void setCounter(StringRef name, double value) {
+        _counters[name.str()] = value;
+    }
+
+    void skipWithError(StringRef message) {
+        _error = message.str();
+        _iterations = _maxIterations;
+    }
+
+public:
+    int64_t iterations() const {
+        return _iterations;
+    }
+
+    std::chrono::nanoseconds realTime() const {
+        return _realTime;
+    }
+
+    std::chrono::nanoseconds cpuTime() const {
+        return _cpuTime;
+    }
+
+    int64_t itemsProcessed() const {
+        return _itemsProcessed;
+    }
+
+    int64_t bytesProcessed() const {
+        return _bytesProcessed;
+    }
+
+    const std::map<std::string, double>& counters() const {
+        return _counters;
+    }
+
+    const std::string& error() const {
+        return _error;
+    }
+
+private:
+    void startTimer();
+    void stopTimer();
+
+private:
+    int64_t _arg = 0;
+    int64_t _maxIterations = 0;
+    int64_t _threadIndex = 0;
+    int64_t _numThreads = 1;
+    int64_t _iterations = 0;
+    bool _started = false;
+    bool _running = false;
+
+    std::chrono::steady_clock::time_point _realStart;
+    std::chrono::nanoseconds _cpuStart{};
+    std::chrono::nanoseconds _realTime{};
+    std::chrono::nanoseconds _cpuTime{};
+
+    int64_t _itemsProcessed = 0;
+    int64_t _bytesProcessed = 0;
+    std::map<std::string, double> _counters;
+    std::string _error;
+};
+
+//
+// Benchmark
+//
+
+using BenchmarkFunc = std::function<void(State&)>;
+
+struct Benchmark final {
+    std::string name;
+    BenchmarkFunc func;
+    std::vector<int64_t> args;
+
+    // Fixed number of iterations for the heavy benchmarks, 0 means it is chosen to reach the minimal time
+    int64_t iterations = 0;
+
+    // Number of threads for each instance, to measure the scaling with the concurrent callers
+    std::vector<int64_t> threads;
+};
+
+std::vector<Benchmark>& getRegisteredBenchmarks();
+
+struct BenchmarkRegistration final {
+    BenchmarkRegistration(StringRef name, BenchmarkFunc func, std::vector<int64_t> args, int64_t iterations = 0,
+                          std::vector<int64_t> threads = {1}) {
+        getRegisteredBenchmarks().push_back(
+                Benchmark{name.str(), std::move(func), std::move(args), iterations, std::move(threads)});
+    }
+};
+
+#define VPUX_BENCHMARK(_name_, _func_, ...) \
+    static ::vpux::bench::BenchmarkRegistration VPUX_UNIQUE_NAME(benchmarkRegistration_)(_name_, _func_, __VA_ARGS__)
+
+//
+// Runner
+//
+
+struct RunnerOptions final {
+    std::string filter;     // Regular expression for the benchmark names
+    double minTime = 0.5;   // Seconds per benchmark instance with automatic number of iterations
+    int64_t repetitions = 1;
+};
+
+struct BenchmarkResult final {
+    std::string name;
+    int64_t threads = 1;
+    int64_t iterations = 0;   // Per thread
+    double realTimeNs = 0.0;  // Per iteration, for the slowest thread
+    double cpuTimeNs = 0.0;   // Per iteration, for the whole process
+    double itemsPerSecond = 0.0;
+    double bytesPerSecond = 0.0;
+    std::map<std::string, double> counters;
+    std::string error;
+};
+
+std::vector<BenchmarkResult> runBenchmarks(const RunnerOptions& options, llvm::raw_ostream& log);
+
+void printResultsAsJson(const std::vector<BenchmarkResult>& results, StringRef executable, llvm::raw_ostream& stream);
+
+void printResultsAsText(const std::vector<BenchmarkResult>& results, llvm::raw_ostream& stream);
+
+// Parses the Google Benchmark style command line options, runs the registered benchmarks and prints the results
+int benchmarkMain(int argc, char* argv[], StringRef description);
+
+}  // namespace bench
+}  // namespace vpux
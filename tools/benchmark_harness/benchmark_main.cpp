@@ -0,0 +1,88 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "benchmark.hpp"
+
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <cstdlib>
+#include <iostream>
+
+using namespace vpux;
+using namespace vpux::bench;
+
+namespace {
+
+enum class OutputFormat { Console, Json };
+
+llvm::cl::opt<std::string> benchmarkFilter("benchmark_filter",
+                                           llvm::cl::desc("Regular expression for the names of benchmarks to run"),
+                                           llvm::cl::init(".*"));
+
+llvm::cl::opt<double> benchmarkMinTime("benchmark_min_time",
+                                       llvm::cl::desc("Minimal time in seconds to run each benchmark for, it doesn't "
+                                                      "affect the benchmarks with the fixed number of iterations"),
+                                       llvm::cl::init(0.5));
+
+llvm::cl::opt<int64_t> benchmarkRepetitions("benchmark_repetitions",
+                                            llvm::cl::desc("Number of times to repeat each benchmark"),
+                                            llvm::cl::init(1));
+
+llvm::cl::opt<OutputFormat> benchmarkFormat(
+        "benchmark_format", llvm::cl::desc("Format of the results"),
+        llvm::cl::values(clEnumValN(OutputFormat::Console, "console", "Human readable table"),
+                         clEnumValN(OutputFormat::Json, "json", "Google Benchmark compatible JSON")),
+        llvm::cl::init(OutputFormat::Console));
+
+llvm::cl::opt<std::string> benchmarkOut("benchmark_out",
+                                        llvm::cl::desc("File to write the JSON results to, in addition to the console "
+                                                       "output"),
+                                        llvm::cl::value_desc("filename"));
+
+llvm::cl::opt<bool> benchmarkList("benchmark_list_tests", llvm::cl::desc("List the benchmarks instead of running them"),
+                                  llvm::cl::init(false));
+
+}  // namespace
+
+int vpux::bench::benchmarkMain(int argc, char* argv[], StringRef description) {
+    llvm::cl::ParseCommandLineOptions(argc, argv, description);
+
+    if (benchmarkList) {
+        for (const auto& benchmark : getRegisteredBenchmarks()) {
+            llvm::outs() << benchmark.name << "\n";
+        }
+        return EXIT_SUCCESS;
+    }
+
+    RunnerOptions options;
+    options.filter = benchmarkFilter.getValue();
+    options.minTime = benchmarkMinTime.getValue();
+    options.repetitions = benchmarkRepetitions.getValue();
+
+    const auto results = runBenchmarks(options, llvm::errs());
+
+    if (benchmarkFormat == OutputFormat::Json) {
+        printResultsAsJson(results, argv[0], llvm::outs());
+    } else {
+        printResultsAsText(results, llvm::outs());
+    }
+
+    if (!benchmarkOut.empty()) {
+        std::error_code ec;
+        llvm::raw_fd_ostream file(benchmarkOut.getValue(), ec, llvm::sys::fs::OF_Text);
+        if (ec) {
+            std::cerr << "Failed to open file " << benchmarkOut.getValue() << " : " << ec.message() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        printResultsAsJson(results, argv[0], file);
+    }
+
+    return EXIT_SUCCESS;
+}
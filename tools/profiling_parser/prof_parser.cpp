@@ -8,24 +8,46 @@
 #include <algorithm>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <ie_version.hpp>
 #include <iostream>
+#include <sstream>
 
 #include <gflags/gflags.h>
 
 #include "vpux/utils/IE/profiling.hpp"
+#include "vpux/utils/plugin/predicted_cycles.hpp"
+#include "vpux/utils/plugin/profiling_aggregator.hpp"
 #include "vpux/utils/plugin/profiling_parser.hpp"
 
 using vpux::profiling::OutputType;
 using vpux::profiling::VerbosityLevel;
 
 DEFINE_string(b, "", "Precompiled blob that was profiled.");
-DEFINE_string(p, "", "Profiling result binary");
-DEFINE_string(f, "json", "Format to use (text, json or debug)");
+DEFINE_string(p, "", "Profiling result binary, comma-separated list of binaries in aggregation mode");
+DEFINE_string(f, "json", "Format to use (text, json, trace or debug)");
 DEFINE_string(o, "", "Output file, stdout by default");
 DEFINE_bool(g, false, "Profiling data is from FPGA");
 DEFINE_bool(v, false, "Medium verbosity of DPU tasks parsing");
 DEFINE_bool(vv, false, "High verbosity of DPU tasks parsing");
+DEFINE_bool(a, false,
+            "Aggregate the profiling results of several inferences into percentile statistics. "
+            "Each binary may contain several consecutive profiling results");
+DEFINE_bool(c, false,
+            "Compare the compile-time cycle estimates embedded into the blob with the measured task durations");
+DEFINE_uint32(n, 10, "Number of the worst mispredicted tasks to report in comparison mode");
+
+static std::vector<std::string> splitFileList(const std::string& fileList) {
+    std::vector<std::string> files;
+    std::stringstream stream(fileList);
+    std::string file;
+    while (std::getline(stream, file, ',')) {
+        if (!file.empty()) {
+            files.push_back(file);
+        }
+    }
+    return files;
+}
 
 static bool validateFile(const char* flagName, const std::string& pathToFile) {
     if (pathToFile.empty()) {
@@ -44,6 +66,28 @@ static bool validateFile(const char* flagName, const std::string& pathToFile) {
     return isValid;
 }
 
+static bool validateFileList(const char* flagName, const std::string& fileList) {
+    const auto files = splitFileList(fileList);
+    if (files.empty()) {
+        return false;
+    }
+    return std::all_of(files.begin(), files.end(), [&](const std::string& file) {
+        return validateFile(flagName, file);
+    });
+}
+
+static std::vector<uint8_t> readBinaryFile(const std::string& path) {
+    std::ifstream file;
+    file.open(path, std::ios::in | std::ios::binary);
+    file.seekg(0, file.end);
+    size_t length = file.tellg();
+    file.seekg(0, file.beg);
+    std::vector<uint8_t> data(length);
+    file.read(reinterpret_cast<char*>(data.data()), data.size());
+    file.close();
+    return data;
+}
+
 static VerbosityLevel getVerbosity() {
     VerbosityLevel verbosity = FLAGS_v == true ? VerbosityLevel::MEDIUM : VerbosityLevel::LOW;
     return FLAGS_vv == true ? VerbosityLevel::HIGH : verbosity;
@@ -52,7 +96,7 @@ static VerbosityLevel getVerbosity() {
 static void parseCommandLine(int argc, char* argv[], const std::string& usage) {
     gflags::SetUsageMessage(usage);
     gflags::RegisterFlagValidator(&FLAGS_b, &validateFile);
-    gflags::RegisterFlagValidator(&FLAGS_p, &validateFile);
+    gflags::RegisterFlagValidator(&FLAGS_p, &validateFileList);
 
     std::ostringstream version;
     version << InferenceEngine::GetInferenceEngineVersion();
@@ -68,17 +112,95 @@ static void parseCommandLine(int argc, char* argv[], const std::string& usage) {
     std::cout << "Parameters:" << std::endl;
     std::cout << "    Network blob file:     " << FLAGS_b << std::endl;
     std::cout << "    Profiling result file: " << FLAGS_p << std::endl;
-    std::cout << "    Format (text/json):    " << FLAGS_f << std::endl;
+    std::cout << "    Format:                " << FLAGS_f << std::endl;
     std::cout << "    Output file:           " << FLAGS_o << std::endl;
     std::cout << "    Verbosity:             " << verbosityToStr[getVerbosity()] << std::endl;
     std::cout << "    FPGA:                  " << FLAGS_g << std::endl;
+    std::cout << "    Aggregate:             " << FLAGS_a << std::endl;
+    std::cout << "    Compare predicted:     " << FLAGS_c << std::endl;
 
     std::cout << std::endl;
 }
 
+static void writeOutput(const std::function<void(std::ostream&)>& writer) {
+    if (FLAGS_o.empty()) {
+        writer(std::cout);
+    } else {
+        std::ofstream outfile(FLAGS_o, std::ios::out | std::ios::trunc);
+        if (outfile.is_open()) {
+            writer(outfile);
+        } else {
+            std::cerr << "Can't write result into " << FLAGS_o << std::endl;
+        }
+    }
+}
+
+// Blob metadata is indexed once and the dumps are read one by one, so the memory doesn't depend on the number of
+// inferences
+static void aggregateProfiling(OutputType format, const std::vector<uint8_t>& blob,
+                               const std::vector<std::string>& profilingFiles) {
+    const vpux::profiling::ProfilingIndex index(blob.data(), blob.size());
+    const auto bufferSize = index.getProfilingBufferSize();
+    if (bufferSize == 0) {
+        std::cerr << "The blob doesn't contain profiling metadata" << std::endl;
+        return;
+    }
+
+    vpux::profiling::ProfilingAggregator aggregator;
+    for (const auto& file : profilingFiles) {
+        const auto output_bin = readBinaryFile(file);
+        if (output_bin.size() % bufferSize != 0) {
+            std::cerr << "Size of " << file << " isn't multiple of the profiling buffer size " << bufferSize
+                      << ", the trailing " << output_bin.size() % bufferSize << " bytes are ignored" << std::endl;
+        }
+
+        for (size_t offset = 0; offset + bufferSize <= output_bin.size(); offset += bufferSize) {
+            const auto tasks = index.decode(output_bin.data() + offset, bufferSize, vpux::profiling::TaskType::ALL,
+                                            VerbosityLevel::LOW, FLAGS_g);
+            aggregator.addInference(tasks, vpux::profiling::getLayerInfo(tasks));
+        }
+    }
+
+    writeOutput([&](std::ostream& out) {
+        const auto info = aggregator.getAggregatedInfo();
+        if (format == OutputType::TEXT) {
+            vpux::profiling::printAggregatedProfilingAsText(info, out);
+        } else {
+            vpux::profiling::printAggregatedProfilingAsJson(info, out);
+        }
+    });
+}
+
+// Cost model estimates are joined with the top-level tasks, so the error is reported per operation
+static bool comparePredictedCycles(OutputType format, const std::vector<uint8_t>& blob,
+                                   const std::vector<uint8_t>& profiling) {
+    vpux::profiling::PredictedCycles predicted;
+    if (!vpux::profiling::findPredictedCycles(blob.data(), blob.size(), predicted)) {
+        std::cerr << "The blob doesn't contain predicted cycles" << std::endl;
+        return false;
+    }
+
+    const auto tasks = vpux::profiling::getTaskInfo(blob.data(), blob.size(), profiling.data(), profiling.size(),
+                                                    vpux::profiling::TaskType::ALL, VerbosityLevel::LOW, FLAGS_g);
+    const auto report = vpux::profiling::correlatePredictedCycles(predicted, tasks);
+
+    writeOutput([&](std::ostream& out) {
+        if (format == OutputType::TEXT) {
+            vpux::profiling::printCycleCorrelationAsText(report, FLAGS_n, out);
+        } else {
+            vpux::profiling::printCycleCorrelationAsJson(report, FLAGS_n, out);
+        }
+    });
+    return true;
+}
+
 int main(int argc, char** argv) {
-    static const char* usage = "Usage: prof_parser -b <blob path> -p <profiling.bin path> [-f json|text] "
-                               "[-o <output.file>] [-v|vv] [-g]\n";
+    static const char* usage = "Usage: prof_parser -b <blob path> -p <profiling.bin path> [-f json|trace|text] "
+                               "[-o <output.file>] [-v|vv] [-g]\n"
+                               "       prof_parser -a -b <blob path> -p <profiling.bin path>[,<profiling.bin path>...] "
+                               "[-f json|text] [-o <output.file>] [-g]\n"
+                               "       prof_parser -c -b <blob path> -p <profiling.bin path> [-f json|text] [-n <count>] "
+                               "[-o <output.file>] [-g]\n";
     if (argc < 5) {
         std::cout << usage << std::endl;
         return 0;
@@ -88,26 +210,30 @@ int main(int argc, char** argv) {
     std::string blobPath(FLAGS_b);
     std::string profResult(FLAGS_p);
     std::transform(FLAGS_f.begin(), FLAGS_f.end(), FLAGS_f.begin(), ::tolower);
-    OutputType format =
-            (FLAGS_f == "text") ? OutputType::TEXT : ((FLAGS_f == "json") ? OutputType::JSON : OutputType::DEBUG);
-
-    std::ifstream blob_file;
-    blob_file.open(blobPath, std::ios::in | std::ios::binary);
-    blob_file.seekg(0, blob_file.end);
-    size_t blob_length = blob_file.tellg();
-    blob_file.seekg(0, blob_file.beg);
-    std::vector<uint8_t> blob_bin(blob_length);
-    blob_file.read(reinterpret_cast<char*>(blob_bin.data()), blob_bin.size());
-    blob_file.close();
-
-    std::fstream profiling_results;
-    profiling_results.open(profResult, std::ios::in | std::ios::binary);
-    profiling_results.seekg(0, profiling_results.end);
-    size_t profiling_length = profiling_results.tellg();
-    profiling_results.seekg(0, profiling_results.beg);
-    std::vector<uint8_t> output_bin(profiling_length);
-    profiling_results.read(reinterpret_cast<char*>(output_bin.data()), output_bin.size());
-    profiling_results.close();
+    const std::map<std::string, OutputType> formats = {
+            {"text", OutputType::TEXT},
+            {"json", OutputType::JSON},
+            {"trace", OutputType::TRACE},
+    };
+    const auto formatIt = formats.find(FLAGS_f);
+    const OutputType format = formatIt != formats.end() ? formatIt->second : OutputType::DEBUG;
+
+    const std::vector<uint8_t> blob_bin = readBinaryFile(blobPath);
+
+    if (FLAGS_a) {
+        aggregateProfiling(format, blob_bin, splitFileList(profResult));
+        return 0;
+    }
+    if (splitFileList(profResult).size() > 1) {
+        std::cerr << "Several profiling results are supported in aggregation mode only" << std::endl;
+        return 1;
+    }
+
+    const std::vector<uint8_t> output_bin = readBinaryFile(profResult);
+
+    if (FLAGS_c) {
+        return comparePredictedCycles(format, blob_bin, output_bin) ? 0 : 1;
+    }
 
     auto blobData = std::make_pair(blob_bin.data(), blob_bin.size());
     auto profilingData = std::make_pair(output_bin.data(), output_bin.size());
@@ -21,9 +21,17 @@
 
 #include <gflags/gflags.h>
 
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <numeric>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -51,6 +59,14 @@ DEFINE_bool(img_as_bin, false, "Force binary input even if network expects an im
 DEFINE_bool(pc, false, "Report performance counters");
 DEFINE_string(img_bin_precision, "", "Specify the precision of the binary input files. Eg: 'FP32,FP16;FP32,U8'");
 
+DEFINE_bool(benchmark, false,
+            "Measure throughput and latency with pipelined asynchronous infer requests instead of the single "
+            "inference. The comparison with the references is skipped");
+DEFINE_uint32(nireq, 4, "Number of the asynchronous infer requests for 'benchmark' mode");
+DEFINE_uint32(niter, 0, "Number of the inferences for 'benchmark' mode, 0 to run for the '-time' seconds");
+DEFINE_uint32(time, 10, "Duration in seconds for 'benchmark' mode, used when '-niter' is 0");
+DEFINE_string(benchmark_report, "", "Path to the JSON report of 'benchmark' mode (optional)");
+
 DEFINE_bool(run_test, false, "Run the test (compare current results with previously dumped)");
 DEFINE_string(mode, "", "Comparison mode to use");
 
@@ -135,6 +151,13 @@ void parseCommandLine(int argc, char* argv[]) {
     std::cout << "    Config file:              " << FLAGS_config << std::endl;
     std::cout << "    Run test:                 " << FLAGS_run_test << std::endl;
     std::cout << "    Performance counters:     " << FLAGS_pc << std::endl;
+    std::cout << "    Benchmark:                " << FLAGS_benchmark << std::endl;
+    if (FLAGS_benchmark) {
+        std::cout << "    Infer requests:   " << FLAGS_nireq << std::endl;
+        std::cout << "    Iterations:       " << FLAGS_niter << std::endl;
+        std::cout << "    Time (s):         " << FLAGS_time << std::endl;
+        std::cout << "    Report:           " << FLAGS_benchmark_report << std::endl;
+    }
     if (FLAGS_run_test) {
         std::cout << "    Mode:             " << FLAGS_mode << std::endl;
         if (strEq(FLAGS_mode, "classification")) {
@@ -1189,6 +1212,218 @@ static void printPerformanceCountsAndLatency(size_t numberOfTestCase, const Prof
     std::cout << "Latency: " << std::fixed << std::setprecision(2) << durationMs.count() << " ms" << std::endl;
 }
 
+//
+// Benchmark mode
+//
+
+// Infer requests completed in the callbacks, in order of completion
+class CompletedRequests final {
+public:
+    struct Entry final {
+        size_t index;
+        Time::time_point endTime;
+        std::exception_ptr error;
+    };
+
+    void push(size_t index, std::exception_ptr error) {
+        const auto endTime = Time::now();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _entries.push_back({index, endTime, error});
+        }
+        _cv.notify_one();
+    }
+
+    Entry pop() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this]() {
+            return !_entries.empty();
+        });
+        const auto entry = _entries.front();
+        _entries.pop_front();
+        return entry;
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque<Entry> _entries;
+};
+
+struct BenchmarkResult final {
+    size_t numRequests = 0;
+    std::chrono::duration<double, std::milli> duration{};
+    std::vector<double> latenciesMs;
+};
+
+// Keeps every infer request busy: a request is restarted as soon as its previous inference is completed,
+// until the requested number of iterations is started or the time is over
+BenchmarkResult runBenchmarkLoop(size_t numRequests, const std::function<void(size_t)>& startRequest,
+                                 CompletedRequests& completed) {
+    const auto benchmarkStart = Time::now();
+    const auto deadline = benchmarkStart + std::chrono::seconds(FLAGS_time);
+
+    uint64_t numStarted = 0;
+    const auto shouldStart = [&]() {
+        return FLAGS_niter != 0 ? numStarted < FLAGS_niter : Time::now() < deadline;
+    };
+
+    std::vector<Time::time_point> startTimes(numRequests);
+    const auto start = [&](size_t index) {
+        startTimes[index] = Time::now();
+        startRequest(index);
+        ++numStarted;
+    };
+
+    BenchmarkResult result;
+    result.numRequests = numRequests;
+
+    for (size_t index = 0; index < numRequests && shouldStart(); ++index) {
+        start(index);
+    }
+
+    std::exception_ptr firstError;
+    for (uint64_t numCompleted = 0; numCompleted < numStarted; ++numCompleted) {
+        const auto entry = completed.pop();
+        if (entry.error != nullptr) {
+            // The rest of the requests are drained before the error is reported
+            firstError = firstError != nullptr ? firstError : entry.error;
+            continue;
+        }
+
+        const std::chrono::duration<double, std::milli> latency = entry.endTime - startTimes[entry.index];
+        result.latenciesMs.push_back(latency.count());
+
+        if (firstError == nullptr && shouldStart()) {
+            start(entry.index);
+        }
+    }
+    result.duration = Time::now() - benchmarkStart;
+
+    if (firstError != nullptr) {
+        std::rethrow_exception(firstError);
+    }
+    return result;
+}
+
+// Returns empty string, if the metric isn't supported by the plugin or the backend
+using MetricQuery = std::function<std::string(const std::string&)>;
+
+void reportBenchmark(size_t numberOfTestCase, BenchmarkResult& result, const MetricQuery& queryMetric) {
+    auto& latencies = result.latenciesMs;
+    std::sort(latencies.begin(), latencies.end());
+
+    const auto percentile = [&](double percent) {
+        if (latencies.empty()) {
+            return 0.0;
+        }
+        const auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * static_cast<double>(latencies.size())));
+        return latencies[std::max<size_t>(rank, 1) - 1];
+    };
+
+    const auto numInferences = latencies.size();
+    const auto meanMs =
+            numInferences != 0 ? std::accumulate(latencies.begin(), latencies.end(), 0.0) / numInferences : 0.0;
+    const auto throughput = result.duration.count() != 0.0 ? numInferences * 1000.0 / result.duration.count() : 0.0;
+
+    // Host overhead and profiling statistics are accumulated by the plugin since the network was loaded
+    const auto hostOverhead = queryMetric("VPUX_HOST_OVERHEAD_STATISTICS");
+    const auto profiling = FLAGS_pc ? queryMetric("VPUX_PROFILING_STATISTICS") : std::string();
+
+    const auto fmt = std::cout.flags();
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Benchmark results for " << numberOfTestCase << "-th test case:" << std::endl;
+    std::cout << "    Infer requests:   " << result.numRequests << std::endl;
+    std::cout << "    Inferences:       " << numInferences << std::endl;
+    std::cout << "    Duration:         " << result.duration.count() << " ms" << std::endl;
+    std::cout << "    Throughput:       " << throughput << " FPS" << std::endl;
+    std::cout << "    Latency mean:     " << meanMs << " ms" << std::endl;
+    std::cout << "    Latency p50:      " << percentile(50.0) << " ms" << std::endl;
+    std::cout << "    Latency p99:      " << percentile(99.0) << " ms" << std::endl;
+    if (!hostOverhead.empty()) {
+        std::cout << "Host overhead statistics (preprocessing, repack, push, pull):" << std::endl
+                  << hostOverhead << std::endl;
+    } else {
+        std::cout << "Host overhead statistics are not available, they are collected by the VPUX plugin with "
+                     "VPUX_COLLECT_HOST_OVERHEAD_STATISTICS YES in the '-config' file"
+                  << std::endl;
+    }
+    if (!profiling.empty()) {
+        std::cout << "Profiling statistics:" << std::endl << profiling << std::endl;
+    }
+    std::cout.flags(fmt);
+
+    if (FLAGS_benchmark_report.empty()) {
+        return;
+    }
+
+    // All test cases are reported, so the file is rewritten after each of them
+    static std::vector<std::string> reportEntries;
+
+    std::ostringstream entry;
+    entry << std::fixed << std::setprecision(3);
+    entry << "{\"test_case\":" << numberOfTestCase << ", \"device\":\"" << FLAGS_device << "\", ";
+    entry << "\"infer_requests\":" << result.numRequests << ", \"inferences\":" << numInferences << ", ";
+    entry << "\"duration_ms\":" << result.duration.count() << ", \"throughput_fps\":" << throughput << "," << std::endl;
+    entry << "\"latency_ms\":{\"mean\":" << meanMs << ", \"p50\":" << percentile(50.0)
+          << ", \"p99\":" << percentile(99.0) << ", \"min\":" << percentile(0.0) << ", \"max\":" << percentile(100.0)
+          << "}," << std::endl;
+    entry << "\"host_overhead\":" << (hostOverhead.empty() ? "null" : hostOverhead) << "," << std::endl;
+    entry << "\"profiling\":" << (profiling.empty() ? "null" : profiling) << "}";
+    reportEntries.push_back(entry.str());
+
+    std::ofstream report(FLAGS_benchmark_report);
+    if (!report.is_open()) {
+        throw std::runtime_error("Can't open the benchmark report file " + FLAGS_benchmark_report);
+    }
+    report << "[" << std::endl;
+    for (size_t i = 0; i < reportEntries.size(); ++i) {
+        report << reportEntries[i] << (i + 1 != reportEntries.size() ? "," : "") << std::endl;
+    }
+    report << "]" << std::endl;
+}
+
+void runBenchmark(size_t numberOfTestCase, ie::ExecutableNetwork& exeNet, const ie::BlobMap& inputs) {
+    const auto numRequests = std::max<size_t>(FLAGS_nireq, 1);
+
+    CompletedRequests completed;
+    std::vector<ie::InferRequest> requests;
+    for (size_t index = 0; index < numRequests; ++index) {
+        auto request = exeNet.CreateInferRequest();
+        for (const auto& p : inputs) {
+            request.SetBlob(p.first, p.second);
+        }
+        // The first inference of the request isn't measured
+        request.Infer();
+
+        request.SetCompletionCallback<std::function<void(ie::InferRequest, ie::StatusCode)>>(
+                [&completed, index](ie::InferRequest, ie::StatusCode status) {
+                    completed.push(index, status == ie::StatusCode::OK
+                                                  ? nullptr
+                                                  : std::make_exception_ptr(std::runtime_error(
+                                                            "Infer request failed with status " +
+                                                            std::to_string(static_cast<int>(status)))));
+                });
+        requests.push_back(request);
+    }
+
+    std::cout << "Run benchmark on " << FLAGS_device << " with " << numRequests << " infer requests" << std::endl;
+    auto result = runBenchmarkLoop(
+            numRequests,
+            [&](size_t index) {
+                requests[index].StartAsync();
+            },
+            completed);
+
+    reportBenchmark(numberOfTestCase, result, [&](const std::string& name) -> std::string {
+        try {
+            return exeNet.GetMetric(name).as<std::string>();
+        } catch (const std::exception&) {
+            return {};
+        }
+    });
+}
+
 bool compare_mean_IoU(std::vector<float> iou, float semSegThreshold, uint32_t classes) {
     float threshold = semSegThreshold * 100;
     float ma = 0.0f;
@@ -1452,6 +1687,11 @@ static int runSingleImageTestOV10() {
                 dumpedInputsPaths.push_back(blobFileName);
             }
 
+            if (FLAGS_benchmark) {
+                runBenchmark(numberOfTestCase, exeNet, inputs);
+                continue;
+            }
+
             std::cout << "Run inference on " << FLAGS_device << std::endl;
             const auto startTime = Time::now();
             const auto inferenceOutput = runInfer(exeNet, inputs, dumpedInputsPaths);
@@ -1655,6 +1895,42 @@ std::pair<TensorMap, ProfVec> runInfer(ov::CompiledModel& compiledModel, const T
     return std::make_pair(out, profData);
 }
 
+void runBenchmark(size_t numberOfTestCase, ov::CompiledModel& compiledModel, const TensorMap& inputs) {
+    const auto numRequests = std::max<size_t>(FLAGS_nireq, 1);
+
+    CompletedRequests completed;
+    std::vector<ov::InferRequest> requests;
+    for (size_t index = 0; index < numRequests; ++index) {
+        auto request = compiledModel.create_infer_request();
+        for (const auto& p : inputs) {
+            request.set_tensor(p.first, p.second);
+        }
+        // The first inference of the request isn't measured
+        request.infer();
+
+        request.set_callback([&completed, index](std::exception_ptr error) {
+            completed.push(index, error);
+        });
+        requests.push_back(request);
+    }
+
+    std::cout << "Run benchmark on " << FLAGS_device << " with " << numRequests << " infer requests" << std::endl;
+    auto result = runBenchmarkLoop(
+            numRequests,
+            [&](size_t index) {
+                requests[index].start_async();
+            },
+            completed);
+
+    reportBenchmark(numberOfTestCase, result, [&](const std::string& name) -> std::string {
+        try {
+            return compiledModel.get_property(name).as<std::string>();
+        } catch (const std::exception&) {
+            return {};
+        }
+    });
+}
+
 static ie::Precision toIE(const ov::element::Type& type) {
     switch (type) {
     case ov::element::u8:
@@ -2131,6 +2407,11 @@ static int runSingleImageTestOV20() {
                 in_tensors.emplace(inputInfo.get_any_name(), ov::Tensor(prec, shape, blob->buffer().as<void*>()));
             }
 
+            if (FLAGS_benchmark) {
+                runBenchmark(numberOfTestCase, compiledModel, in_tensors);
+                continue;
+            }
+
             std::cout << "Run inference on " << FLAGS_device << std::endl;
 
             const auto startTime = Time::now();
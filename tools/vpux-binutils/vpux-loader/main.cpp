@@ -7,18 +7,25 @@
 
 #include <llvm/Support/CommandLine.h>
 #include <llvm/Support/FormatVariadic.h>
+#include <llvm/Support/MemoryBuffer.h>
 
 #include <vpux_elf/accessor.hpp>
 #include <vpux_elf/types/symbol_entry.hpp>
 #include <vpux_elf/utils/error.hpp>
 #include <vpux_loader/vpux_loader.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cstdint>
 #include <ctime>
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <random>
+#include <sstream>
+#include <string>
 #include <vector>
 
 #ifndef VPUX_ELF_LOG_UNIT_NAME
@@ -63,6 +70,22 @@ llvm::cl::opt<size_t> memSize("size", llvm::cl::value_desc("memSize"), llvm::cl:
                                              "for the Loaded and linked hex-file. This value needs to reflect"
                                              "the InferenceManagerDemoHex application configuration"));
 
+llvm::cl::opt<std::string> symtabFile("symtab", llvm::cl::value_desc("filename"), llvm::cl::init(""),
+                                      llvm::cl::desc("Platform symbol table description. Each line holds "
+                                                     "'<cluster> <symbol> <value> <size>', the built-in values "
+                                                     "of the cluster 0 are used if it is not specified"));
+
+llvm::cl::opt<uint32_t> clusterIndex("cluster", llvm::cl::value_desc("index"), llvm::cl::init(0),
+                                     llvm::cl::desc("Cluster of the platform symbol table to link the ELF to"));
+
+llvm::cl::opt<uint32_t> benchLoads("bench-loads", llvm::cl::value_desc("count"), llvm::cl::init(0),
+                                   llvm::cl::desc("Number of timed load iterations, which are run after the output "
+                                                  "file is written. The benchmark is disabled by default"));
+
+llvm::cl::opt<uint32_t> benchRelocs("bench-relocs", llvm::cl::value_desc("count"), llvm::cl::init(1),
+                                    llvm::cl::desc("Number of timed I/O re-relocations with new buffers per "
+                                                   "load iteration of the benchmark"));
+
 llvm::cl::opt<bool> verbose("v", llvm::cl::desc("Set verbosity"));
 
 }  // namespace
@@ -135,6 +158,12 @@ public:
         return m_tracker - m_buffer;
     }
 
+    // Releases all the allocations made after the buffer had the given size
+    void rewind(size_t size) {
+        VPUX_ELF_THROW_UNLESS(size <= this->size(), ArgsError, "Can't rewind the buffer forward");
+        m_tracker = m_buffer + size;
+    }
+
 private:
     template <typename T>
     bool isPowerOfTwo(T val) {
@@ -159,52 +188,167 @@ private:
     uint8_t* m_tracker;
 };
 
-// TODO(E#23975): This beautiful piece of code contains the "special symtab" that normally needs to be queried from
-// the runtime. In IMDemo example we have a similar class that constructs this symTab based on data from the
-// InferenceRuntimeService. Since we cannot include that in VPUx-plugin, we will occasionally manually check the
-// values, and update them here Hopefully if we solve the riddle of integration between VPUx Plugin and vpuip_2, then
-// we will not have to resort to magical solutions (This is my wish to SantaClaus this year :) ) This ticket will
-// not totally solve the problem, but will greatly reduce the hack-ishness of this solution
+// TODO(E#23975): The "special symtab" normally needs to be queried from the runtime. In IMDemo example we have
+// a similar class that constructs this symTab based on data from the InferenceRuntimeService. Since we cannot
+// include that in VPUx-plugin, the platform description is read from the file given by the -symtab option.
+// The built-in values of the cluster 0 are used if no description is provided, they are occasionally checked
+// against the runtime manually.
+//
+// The description holds one symbol per line, the values can be given in decimal or hexadecimal form:
+//   # <cluster> <symbol> <value> <size>
+//   0 NNCMX_SLICE_BASE_ADDR 0x2e014000 2097152
+//   1 NNCMX_SLICE_BASE_ADDR 0x2e214000 2097152
+
+class PlatformSymtab {
+public:
+    static constexpr size_t SPECIAL_SYMTAB_SIZE = 7;
+    static constexpr size_t MAX_CLUSTER_COUNT = 64;
 
-class HardCodedSymtabToCluster0 {
-private:
-    static constexpr size_t SPECIAL_SYMTAB_SIZE = 7;  // I counted!!!! Twice!!
-    SymbolEntry symTab_[SPECIAL_SYMTAB_SIZE];
+    using ClusterSymtab = std::array<SymbolEntry, SPECIAL_SYMTAB_SIZE>;
 
 public:
-    HardCodedSymtabToCluster0(): symTab_() {
-        for (size_t i = 0; i < SPECIAL_SYMTAB_SIZE; ++i) {
-            symTab_[i].st_info = static_cast<unsigned char>(elf64STInfo(STB_GLOBAL, STT_OBJECT));
-            symTab_[i].st_other = STV_DEFAULT;
-            symTab_[i].st_shndx = 0;
-            symTab_[i].st_name = 0;
+    static PlatformSymtab createDefault() {
+        PlatformSymtab platform;
+        auto& cluster0 = platform.getCluster(0);
+
+        setSymbol(cluster0, VPU_NNRD_SYM_NNCXM_SLICE_BASE_ADDR, 0x2e014000, 2097152);
+        setSymbol(cluster0, VPU_NNRD_SYM_RTM_IVAR, 0x2e004000, 64);
+        setSymbol(cluster0, VPU_NNRD_SYM_RTM_ACT, 0, 0);
+        setSymbol(cluster0, VPU_NNRD_SYM_RTM_DMA0, 0x2e1f8000, 64);
+        setSymbol(cluster0, VPU_NNRD_SYM_RTM_DMA1, 0x2e1fc000, 64);
+        setSymbol(cluster0, VPU_NNRD_SYM_FIFO_BASE, 0x0, 0);
+        setSymbol(cluster0, VPU_NNRD_SYM_BARRIERS_START, 0, 0);
+
+        return platform;
+    }
+
+    static PlatformSymtab parse(const std::string& fileName) {
+        std::ifstream file(fileName);
+        if (!file.is_open()) {
+            VPUX_ELF_LOG(LogLevel::ERROR, "Failed to open platform symbol table '%s'", fileName.c_str());
+            VPUX_ELF_THROW(ArgsError, "Can't open platform symbol table");
         }
 
-        symTab_[VPU_NNRD_SYM_NNCXM_SLICE_BASE_ADDR].st_value = 0x2e014000;
-        symTab_[VPU_NNRD_SYM_NNCXM_SLICE_BASE_ADDR].st_size = 2097152;
+        PlatformSymtab platform;
+
+        std::string line;
+        size_t lineNum = 0;
+        while (std::getline(file, line)) {
+            ++lineNum;
+
+            const auto commentPos = line.find('#');
+            if (commentPos != std::string::npos) {
+                line.resize(commentPos);
+            }
+
+            std::istringstream lineStream(line);
+            std::string clusterStr, symbolStr, valueStr, sizeStr, extraStr;
+            if (!(lineStream >> clusterStr)) {
+                continue;
+            }
+
+            if (!(lineStream >> symbolStr >> valueStr >> sizeStr) || (lineStream >> extraStr)) {
+                VPUX_ELF_LOG(LogLevel::ERROR, "%s:%zu: expected '<cluster> <symbol> <value> <size>'",
+                             fileName.c_str(), lineNum);
+                VPUX_ELF_THROW(ArgsError, "Malformed platform symbol table");
+            }
+
+            const auto clusterIdx = parseNumber(clusterStr, fileName, lineNum);
+            if (clusterIdx >= MAX_CLUSTER_COUNT) {
+                VPUX_ELF_LOG(LogLevel::ERROR, "%s:%zu: cluster index '%s' exceeds the limit of %zu clusters",
+                             fileName.c_str(), lineNum, clusterStr.c_str(), MAX_CLUSTER_COUNT);
+                VPUX_ELF_THROW(ArgsError, "Malformed platform symbol table");
+            }
+
+            auto& cluster = platform.getCluster(static_cast<size_t>(clusterIdx));
+            setSymbol(cluster, getSymbolIndex(symbolStr, fileName, lineNum), parseNumber(valueStr, fileName, lineNum),
+                      parseNumber(sizeStr, fileName, lineNum));
+        }
 
-        symTab_[VPU_NNRD_SYM_RTM_IVAR].st_value = 0x2e004000;
-        symTab_[VPU_NNRD_SYM_RTM_IVAR].st_size = 64;
+        VPUX_ELF_THROW_WHEN(platform.m_clusters.empty(), ArgsError, "Platform symbol table is empty");
+        return platform;
+    }
 
-        symTab_[VPU_NNRD_SYM_RTM_ACT].st_value = 0;
-        symTab_[VPU_NNRD_SYM_RTM_ACT].st_size = 0;
+public:
+    size_t clusterCount() const {
+        return m_clusters.size();
+    }
 
-        symTab_[VPU_NNRD_SYM_RTM_DMA0].st_value = 0x2e1f8000;
-        symTab_[VPU_NNRD_SYM_RTM_DMA0].st_size = 64;
+    const details::ArrayRef<SymbolEntry> symTab(size_t cluster) const {
+        if (cluster >= m_clusters.size() || !m_described[cluster]) {
+            VPUX_ELF_LOG(LogLevel::ERROR, "Cluster %zu is not described by the platform symbol table", cluster);
+            VPUX_ELF_THROW(ArgsError, "Cluster index is out of the platform symbol table range");
+        }
+        return details::ArrayRef<SymbolEntry>(m_clusters[cluster].data(), SPECIAL_SYMTAB_SIZE);
+    }
 
-        symTab_[VPU_NNRD_SYM_RTM_DMA1].st_value = 0x2e1fc000;
-        symTab_[VPU_NNRD_SYM_RTM_DMA1].st_size = 64;
+private:
+    ClusterSymtab& getCluster(size_t cluster) {
+        while (m_clusters.size() <= cluster) {
+            ClusterSymtab symTab = {};
+            for (auto& symbol : symTab) {
+                symbol.st_info = static_cast<unsigned char>(elf64STInfo(STB_GLOBAL, STT_OBJECT));
+                symbol.st_other = STV_DEFAULT;
+                symbol.st_shndx = 0;
+                symbol.st_name = 0;
+            }
+            m_clusters.push_back(symTab);
+            m_described.push_back(false);
+        }
 
-        symTab_[VPU_NNRD_SYM_FIFO_BASE].st_value = 0x0;
-        symTab_[VPU_NNRD_SYM_FIFO_BASE].st_size = 0;
+        m_described[cluster] = true;
+        return m_clusters[cluster];
+    }
+
+    static void setSymbol(ClusterSymtab& symTab, size_t index, uint64_t value, uint64_t size) {
+        symTab[index].st_value = value;
+        symTab[index].st_size = size;
+    }
+
+    static uint64_t parseNumber(const std::string& str, const std::string& fileName, size_t lineNum) {
+        size_t parsed = 0;
+        uint64_t value = 0;
+        try {
+            value = std::stoull(str, &parsed, 0);
+        } catch (const std::exception&) {
+            parsed = 0;
+        }
+
+        if (parsed == 0 || parsed != str.size()) {
+            VPUX_ELF_LOG(LogLevel::ERROR, "%s:%zu: '%s' is not a number", fileName.c_str(), lineNum, str.c_str());
+            VPUX_ELF_THROW(ArgsError, "Malformed platform symbol table");
+        }
 
-        symTab_[VPU_NNRD_SYM_BARRIERS_START].st_value = 0;
-        symTab_[VPU_NNRD_SYM_BARRIERS_START].st_size = 0;
+        return value;
     }
 
-    const details::ArrayRef<SymbolEntry> symTab() const {
-        return details::ArrayRef<SymbolEntry>(symTab_, SPECIAL_SYMTAB_SIZE);
+    static size_t getSymbolIndex(const std::string& name, const std::string& fileName, size_t lineNum) {
+        static const std::pair<const char*, size_t> symbols[] = {
+                {"NNCMX_SLICE_BASE_ADDR", VPU_NNRD_SYM_NNCXM_SLICE_BASE_ADDR},
+                {"RTM_IVAR", VPU_NNRD_SYM_RTM_IVAR},
+                {"RTM_ACT", VPU_NNRD_SYM_RTM_ACT},
+                {"RTM_DMA0", VPU_NNRD_SYM_RTM_DMA0},
+                {"RTM_DMA1", VPU_NNRD_SYM_RTM_DMA1},
+                {"FIFO_BASE", VPU_NNRD_SYM_FIFO_BASE},
+                {"BARRIERS_START", VPU_NNRD_SYM_BARRIERS_START},
+        };
+
+        const auto it = std::find_if(std::begin(symbols), std::end(symbols), [&](const auto& symbol) {
+            return name == symbol.first;
+        });
+
+        if (it == std::end(symbols)) {
+            VPUX_ELF_LOG(LogLevel::ERROR, "%s:%zu: unknown symbol '%s'", fileName.c_str(), lineNum, name.c_str());
+            VPUX_ELF_THROW(ArgsError, "Malformed platform symbol table");
+        }
+
+        return it->second;
     }
+
+private:
+    std::vector<ClusterSymtab> m_clusters;
+    // The clusters preceding the described ones are created empty, they can't be used for linking
+    std::vector<bool> m_described;
 };
 
 void allocIO(BufferManager* mngr, std::vector<DeviceBuffer>& ioVec, details::ArrayRef<DeviceBuffer> sizes,
@@ -292,6 +436,95 @@ struct HexMappedInferenceEntry {
     uint32_t outputsCount;
 };
 
+// Timing of one phase of the load over the benchmark iterations
+class PhaseStats {
+public:
+    explicit PhaseStats(const char* name): m_name(name) {
+    }
+
+    template <class Func>
+    void measure(Func&& func) {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const auto time =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        m_min = m_count == 0 ? time : std::min(m_min, time);
+        m_max = std::max(m_max, time);
+        m_total += time;
+        ++m_count;
+    }
+
+    void print(llvm::raw_ostream& stream) const {
+        using usec = std::chrono::duration<double, std::micro>;
+
+        if (m_count == 0) {
+            return;
+        }
+
+        stream << llvm::formatv("\t {0,-20} x{1,-6} min {2,12:f2} us | avg {3,12:f2} us | max {4,12:f2} us\n", m_name,
+                                m_count, usec(m_min).count(), usec(m_total).count() / m_count,
+                                usec(m_max).count());
+    }
+
+private:
+    const char* m_name;
+    size_t m_count = 0;
+    std::chrono::nanoseconds m_min{0};
+    std::chrono::nanoseconds m_max{0};
+    std::chrono::nanoseconds m_total{0};
+};
+
+// Repeats the load of the ELF and the patching of the I/O buffers the same way the driver does it for each
+// inference. The buffer manager is rewound before each iteration, so the benchmark doesn't need extra memory.
+void runBenchmark(const uint8_t* elfData, size_t elfSize, const details::ArrayRef<SymbolEntry> symTab,
+                  FlatHexBufferManager& bufferManager, size_t loadMark) {
+    // Section copy and the static relocations are both done at the loader construction
+    PhaseStats loadStats("load");
+    PhaseStats ioAllocStats("I/O allocation");
+    PhaseStats ioRelocStats("I/O relocation");
+
+    // The entry of the benchmark iterations is not the part of the output file
+    HexMappedInferenceEntry entry = {};
+
+    for (uint32_t loadInd = 0; loadInd < benchLoads; ++loadInd) {
+        bufferManager.rewind(loadMark);
+
+        ElfDDRAccessManager accessor(elfData, elfSize, &bufferManager);
+        std::unique_ptr<VPUXLoader> loader;
+        loadStats.measure([&]() {
+            loader = std::make_unique<VPUXLoader>(&accessor, &bufferManager, symTab);
+        });
+
+        const auto ioMark = bufferManager.size();
+        const auto inputSizes = loader->getInputBuffers();
+        const auto outputSizes = loader->getOutputBuffers();
+
+        for (uint32_t relocInd = 0; relocInd < benchRelocs; ++relocInd) {
+            bufferManager.rewind(ioMark);
+
+            std::vector<DeviceBuffer> inputs;
+            std::vector<DeviceBuffer> outputs;
+            ioAllocStats.measure([&]() {
+                allocIO(&bufferManager, inputs, inputSizes, &entry.inputsPtr, &entry.inputSizesPtr,
+                        &entry.inputsCount);
+                allocIO(&bufferManager, outputs, outputSizes, &entry.outputsPtr, &entry.outputSizesPtr,
+                        &entry.outputsCount);
+            });
+
+            ioRelocStats.measure([&]() {
+                loader->applyJitRelocations(inputs, outputs);
+            });
+        }
+    }
+
+    llvm::outs() << llvm::formatv("Benchmark: {0} loads, {1} I/O relocations per load\n", benchLoads.getValue(),
+                                  benchRelocs.getValue());
+    loadStats.print(llvm::outs());
+    ioAllocStats.print(llvm::outs());
+    ioRelocStats.print(llvm::outs());
+}
+
 int main(int argc, char* argv[]) {
     llvm::cl::ParseCommandLineOptions(argc, argv);
 
@@ -299,19 +532,30 @@ int main(int argc, char* argv[]) {
         Logger::setGlobalLevel(LogLevel::DEBUG);
     }
 
-    std::ifstream inputStream(elfFilePath.data(), std::ios::binary);
-    std::vector<uint8_t> elfFile((std::istreambuf_iterator<char>(inputStream)), (std::istreambuf_iterator<char>()));
-    inputStream.close();
+    // The file is mapped into the memory rather than read, the loader accesses it directly
+    auto elfFile = llvm::MemoryBuffer::getFile(elfFilePath, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+    if (!elfFile) {
+        VPUX_ELF_LOG(LogLevel::ERROR, "Failed to open '%s': %s", elfFilePath.c_str(),
+                     elfFile.getError().message().c_str());
+        VPUX_ELF_THROW(AccessError, "Error at reading the input file");
+    }
+
+    const auto elfData = reinterpret_cast<const uint8_t*>(elfFile.get()->getBufferStart());
+    const auto elfSize = elfFile.get()->getBufferSize();
+
+    const auto platformSymTab =
+            symtabFile.empty() ? PlatformSymtab::createDefault() : PlatformSymtab::parse(symtabFile);
+    const auto symTab = platformSymTab.symTab(clusterIndex);
 
-    HardCodedSymtabToCluster0 singleClusterSymTab;
     FlatHexBufferManager bufferManager(baseAddr, memSize);
 
     HexMappedInferenceEntry* hexEntry = reinterpret_cast<HexMappedInferenceEntry*>(
             bufferManager.allocate(BufferSpecs(1, sizeof(HexMappedInferenceEntry), SHF_NONE)).cpu_addr());
+    const auto loadMark = bufferManager.size();
 
-    ElfDDRAccessManager accessor(reinterpret_cast<const uint8_t*>(elfFile.data()), elfFile.size(), &bufferManager);
+    ElfDDRAccessManager accessor(elfData, elfSize, &bufferManager);
 
-    VPUXLoader loader(&accessor, &bufferManager, singleClusterSymTab.symTab());
+    VPUXLoader loader(&accessor, &bufferManager, symTab);
 
     std::vector<DeviceBuffer> inputs;
     std::vector<DeviceBuffer> outputs;
@@ -341,5 +585,9 @@ int main(int argc, char* argv[]) {
 
     VPUX_ELF_THROW_UNLESS(outFileStream.good(), AccessError, "Error at writing the output file");
 
+    if (benchLoads > 0) {
+        runBenchmark(elfData, elfSize, symTab, bufferManager, loadMark);
+    }
+
     return 0;
 }
@@ -0,0 +1,398 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "benchmark.hpp"
+
+#include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/dialect/const/utils/sparsity.hpp"
+#include "vpux/compiler/init.hpp"
+#include "vpux/compiler/utils/codec_factory.hpp"
+#include "vpux/compiler/utils/linear_scan.hpp"
+#include "vpux/compiler/utils/partitioner.hpp"
+#include "vpux/compiler/utils/swizzle_transform.hpp"
+
+#include "vpux/utils/core/numeric.hpp"
+#include "vpux/utils/core/range.hpp"
+
+#include <mlir/IR/BuiltinAttributes.h>
+#include <mlir/IR/BuiltinTypes.h>
+#include <mlir/IR/MLIRContext.h>
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <deque>
+#include <exception>
+
+using namespace vpux;
+using namespace vpux::bench;
+
+namespace {
+
+// Deterministic pseudo-random sequence, so the runs are comparable between builds
+class Lcg final {
+public:
+    uint32_t next() {
+        _state = _state * 1664525u + 1013904223u;
+        return _state >> 8;
+    }
+
+private:
+    uint32_t _state = 12345;
+};
+
+constexpr AddressType CMX_SIZE = 1024 * 1024;
+constexpr AddressType CMX_ALIGNMENT = 64;
+constexpr size_t NUM_ALIVE_BUFFERS = 32;
+
+// Buffer sizes in range [1KB, 16KB], which keeps about NUM_ALIVE_BUFFERS buffers in the CMX
+std::vector<AddressType> generateBufferSizes(int64_t count) {
+    Lcg rng;
+    std::vector<AddressType> sizes(count);
+    for (auto& size : sizes) {
+        size = 1024 + rng.next() % (15 * 1024);
+    }
+    return sizes;
+}
+
+//
+// LinearScan
+//
+
+struct LiveRange final {
+    bool alive = true;
+    AddressType size = 0;
+    AddressType addr = InvalidAddress;
+};
+
+struct LinearScanHandler final {
+    bool isAlive(LiveRange* r) const {
+        return r->alive;
+    }
+
+    bool isFixedAlloc(LiveRange*) const {
+        return false;
+    }
+
+    AddressType getSize(LiveRange* r) const {
+        return r->size;
+    }
+
+    AddressType getAlignment(LiveRange*) const {
+        return CMX_ALIGNMENT;
+    }
+
+    AddressType getAddress(LiveRange* r) const {
+        return r->addr;
+    }
+
+    void allocated(LiveRange* r, AddressType addr) const {
+        r->addr = addr;
+    }
+
+    void freed(LiveRange*) const {
+    }
+
+    int getSpillWeight(LiveRange*) const {
+        return 0;
+    }
+
+    bool spilled(LiveRange*) const {
+        return true;
+    }
+};
+
+void LinearScanAlloc(State& state) {
+    const auto sizes = generateBufferSizes(state.arg());
+
+    while (state.keepRunning()) {
+        std::vector<LiveRange> ranges(sizes.size());
+        for (auto i : irange(sizes.size())) {
+            ranges[i].size = sizes[i];
+        }
+
+        LinearScan<LiveRange*, LinearScanHandler> scan(CMX_SIZE);
+
+        // Sliding window of the alive buffers, like in the schedule of a linear network
+        for (auto i : irange(ranges.size())) {
+            if (i >= NUM_ALIVE_BUFFERS) {
+                ranges[i - NUM_ALIVE_BUFFERS].alive = false;
+                scan.freeNonAlive();
+            }
+
+            if (!scan.alloc({&ranges[i]})) {
+                state.skipWithError("LinearScan failed to allocate the buffer");
+                return;
+            }
+        }
+    }
+
+    state.setItemsProcessed(state.iterations() * state.arg());
+}
+
+//
+// Partitioner
+//
+
+void PartitionerAllocFree(State& state) {
+    const auto sizes = generateBufferSizes(state.arg());
+
+    while (state.keepRunning()) {
+        Partitioner partitioner(CMX_SIZE);
+        std::deque<std::pair<AddressType, AddressType>> alive;
+
+        for (const auto size : sizes) {
+            if (alive.size() >= NUM_ALIVE_BUFFERS) {
+                partitioner.free(alive.front().first, alive.front().second);
+                alive.pop_front();
+            }
+
+            const auto addr = partitioner.alloc(size, CMX_ALIGNMENT);
+            if (addr == InvalidAddress) {
+                state.skipWithError("Partitioner failed to allocate the buffer");
+                return;
+            }
+
+            alive.emplace_back(addr, size);
+        }
+    }
+
+    state.setItemsProcessed(state.iterations() * state.arg());
+}
+
+//
+// memPermuteTransformation
+//
+
+void ConstReorderNHWC(State& state) {
+    mlir::DialectRegistry registry;
+    registerDialects(registry);
+
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<Const::ConstDialect>();
+
+    // Weights of the convolution with arg output channels, 64 input channels and 3x3 kernel
+    const auto baseType = mlir::RankedTensorType::get({state.arg(), 64, 3, 3}, mlir::Float32Type::get(&ctx));
+
+    Lcg rng;
+    std::vector<float> vals(baseType.getNumElements());
+    for (auto& val : vals) {
+        val = static_cast<float>(rng.next() % 256) / 256.0f;
+    }
+
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, makeArrayRef(vals));
+    const auto contentAttr = Const::ContentAttr::get(baseAttr).reorder(DimsOrder::NHWC);
+
+    while (state.keepRunning()) {
+        const auto content = contentAttr.fold();
+
+        std::vector<char> buffer(content.getType().getTotalAllocSize().count());
+        content.copyTo(buffer);
+    }
+
+    state.setBytesProcessed(state.iterations() * static_cast<int64_t>(vals.size() * sizeof(float)));
+}
+
+//
+// Weights codecs
+//
+
+// Quantized weights like data, most of the values are close to the zero point
+std::vector<uint8_t> generateWeights(int64_t size) {
+    Lcg rng;
+    std::vector<uint8_t> data(size);
+    for (auto& val : data) {
+        const auto r = rng.next();
+        val = static_cast<uint8_t>(128 + static_cast<int>(r % 17) - 8 + ((r >> 16) % 16 == 0 ? (r >> 8) % 64 : 0));
+    }
+    return data;
+}
+
+void runCodecBenchmark(State& state, ICodec::CompressionAlgorithm algo) {
+    auto data = generateWeights(state.arg());
+
+    std::unique_ptr<ICodec> codec;
+    try {
+        codec = makeCodec(algo);
+    } catch (const std::exception& ex) {
+        state.skipWithError(ex.what());
+        return;
+    }
+
+    size_t compressedSize = 0;
+    while (state.keepRunning()) {
+        compressedSize = codec->compress(data).size();
+    }
+
+    state.setBytesProcessed(state.iterations() * state.arg());
+    state.setCounter("compression_ratio", static_cast<double>(compressedSize) / static_cast<double>(data.size()));
+}
+
+void HuffmanCompress(State& state) {
+    runCodecBenchmark(state, ICodec::HUFFMAN_CODEC);
+}
+
+void BitCompactorCompress(State& state) {
+    runCodecBenchmark(state, ICodec::BITCOMPACTOR_CODEC);
+}
+
+//
+// Weights sparsity
+//
+
+// Weights of the 3x3 convolution with 64 input channels, the output channels are added up to the given size
+constexpr int64_t SPARSITY_WORKLOAD_SIZE = 64 * 3 * 3;
+constexpr uint8_t SPARSITY_ZERO_POINT = 128;
+
+std::vector<uint8_t> generateSparseWeights(int64_t size) {
+    auto data = generateWeights(alignVal(size, SPARSITY_WORKLOAD_SIZE));
+
+    // Prune about a half of the weights
+    Lcg rng;
+    for (auto& val : data) {
+        if (rng.next() % 2 == 0) {
+            val = SPARSITY_ZERO_POINT;
+        }
+    }
+    return data;
+}
+
+// The element by element implementation, which is used as the baseline for the sparsity kernels
+void SparsityMapReference(State& state) {
+    const auto weights = generateSparseWeights(state.arg());
+    const auto numOC = static_cast<int64_t>(weights.size()) / SPARSITY_WORKLOAD_SIZE;
+    const auto mapSizePerOC = alignVal<int64_t>(SPARSITY_WORKLOAD_SIZE / CHAR_BIT, 16);
+
+    std::vector<uint8_t> map(numOC * mapSizePerOC);
+    while (state.keepRunning()) {
+        std::fill(map.begin(), map.end(), 0);
+
+        for (int64_t oc = 0; oc < numOC; ++oc) {
+            auto outIdx = oc * mapSizePerOC;
+            for (int64_t inIdx = 0; inIdx < SPARSITY_WORKLOAD_SIZE; inIdx += CHAR_BIT) {
+                const auto byteStart = oc * SPARSITY_WORKLOAD_SIZE + inIdx;
+                uint8_t byteValue = 0;
+                for (int64_t bitShift = 0; bitShift < CHAR_BIT; ++bitShift) {
+                    if (weights[byteStart + bitShift] != SPARSITY_ZERO_POINT) {
+                        byteValue |= (1 << bitShift);
+                    }
+                }
+                map[outIdx++] = byteValue;
+            }
+        }
+    }
+
+    state.setItemsProcessed(state.iterations() * static_cast<int64_t>(weights.size()));
+}
+
+void SparsityMap(State& state) {
+    const auto weights = generateSparseWeights(state.arg());
+    const auto numOC = static_cast<int64_t>(weights.size()) / SPARSITY_WORKLOAD_SIZE;
+    const auto mapSizePerOC = alignVal<int64_t>(SPARSITY_WORKLOAD_SIZE / CHAR_BIT, 16);
+
+    std::vector<char> map(numOC * mapSizePerOC);
+    while (state.keepRunning()) {
+        std::fill(map.begin(), map.end(), 0);
+        Const::buildSparsityMap(makeArrayRef(weights), numOC, SPARSITY_ZERO_POINT, mapSizePerOC, map);
+    }
+
+    state.setItemsProcessed(state.iterations() * static_cast<int64_t>(weights.size()));
+}
+
+void SparsifyReference(State& state) {
+    const auto weights = generateSparseWeights(state.arg());
+    const auto numOC = static_cast<int64_t>(weights.size()) / SPARSITY_WORKLOAD_SIZE;
+
+    std::vector<uint8_t> output(weights.size() + numOC * 16);
+    while (state.keepRunning()) {
+        std::fill(output.begin(), output.end(), 0);
+
+        int64_t outputIndex = 0;
+        for (int64_t oc = 0; oc < numOC; ++oc) {
+            for (auto inputIndex = oc * SPARSITY_WORKLOAD_SIZE; inputIndex < (oc + 1) * SPARSITY_WORKLOAD_SIZE;
+                 ++inputIndex) {
+                if (weights[inputIndex] != SPARSITY_ZERO_POINT) {
+                    output[outputIndex++] = weights[inputIndex];
+                }
+            }
+            outputIndex = alignVal<int64_t>(outputIndex, 16);
+        }
+    }
+
+    state.setItemsProcessed(state.iterations() * static_cast<int64_t>(weights.size()));
+}
+
+void Sparsify(State& state) {
+    const auto weights = generateSparseWeights(state.arg());
+    const auto numOC = static_cast<int64_t>(weights.size()) / SPARSITY_WORKLOAD_SIZE;
+
+    std::vector<char> output(weights.size() + numOC * 16);
+    while (state.keepRunning()) {
+        std::fill(output.begin(), output.end(), 0);
+        Const::compactWeights(makeArrayRef(weights), numOC, SPARSITY_ZERO_POINT, 16, output);
+    }
+
+    state.setItemsProcessed(state.iterations() * static_cast<int64_t>(weights.size()));
+}
+
+//
+// Swizzling
+//
+
+// The address transformation applied to each 16-byte chunk, used as the baseline for the stripe pattern
+void BufferSwizzleReference(State& state) {
+    BufferTransform::AddressTransform addressTransform{5, VPU::ArchKind::VPUX37XX};
+    const auto copyDataWidth = 1u << addressTransform.getLog2RamCutDataWidth();
+
+    const auto stride = BufferTransform::BufferSwizzleTransform{5, VPU::ArchKind::VPUX37XX}.getSwizzlePatternStride();
+    const auto size = alignVal<int64_t>(state.arg(), stride);
+
+    const auto input = generateWeights(size);
+    std::vector<uint8_t> output(size);
+
+    while (state.keepRunning()) {
+        for (uint32_t dpuAddr = 0; dpuAddr < input.size(); dpuAddr += copyDataWidth) {
+            const auto phyAddr = addressTransform.getPhysicalAddress(dpuAddr);
+            std::memcpy(output.data() + phyAddr, input.data() + dpuAddr, copyDataWidth);
+        }
+    }
+
+    state.setBytesProcessed(state.iterations() * size);
+}
+
+void BufferSwizzle(State& state) {
+    BufferTransform::BufferSwizzleTransform transform{5, VPU::ArchKind::VPUX37XX};
+
+    const auto stride = transform.getSwizzlePatternStride();
+    const auto size = alignVal<int64_t>(state.arg(), stride);
+
+    const auto input = generateWeights(size);
+    std::vector<uint8_t> output(size);
+
+    const auto inputRef = makeArrayRef(reinterpret_cast<const char*>(input.data()), input.size());
+    MutableArrayRef<uint8_t> outputRef(output);
+
+    while (state.keepRunning()) {
+        transform.swizzle<uint8_t>(inputRef, outputRef);
+    }
+
+    state.setBytesProcessed(state.iterations() * size);
+}
+
+}  // namespace
+
+VPUX_BENCHMARK("LinearScanAlloc", LinearScanAlloc, {1000, 10000, 100000});
+VPUX_BENCHMARK("PartitionerAllocFree", PartitionerAllocFree, {1000, 10000, 100000});
+VPUX_BENCHMARK("ConstReorderNHWC", ConstReorderNHWC, {64, 512, 2048});
+VPUX_BENCHMARK("HuffmanCompress", HuffmanCompress, {64 * 1024, 1024 * 1024});
+VPUX_BENCHMARK("BitCompactorCompress", BitCompactorCompress, {64 * 1024, 1024 * 1024});
+VPUX_BENCHMARK("SparsityMapReference", SparsityMapReference, {1000 * 1000, 100 * 1000 * 1000});
+VPUX_BENCHMARK("SparsityMap", SparsityMap, {1000 * 1000, 100 * 1000 * 1000});
+VPUX_BENCHMARK("SparsifyReference", SparsifyReference, {1000 * 1000, 100 * 1000 * 1000});
+VPUX_BENCHMARK("Sparsify", Sparsify, {1000 * 1000, 100 * 1000 * 1000});
+VPUX_BENCHMARK("BufferSwizzleReference", BufferSwizzleReference, {64 * 1024, 1024 * 1024, 64 * 1024 * 1024});
+VPUX_BENCHMARK("BufferSwizzle", BufferSwizzle, {64 * 1024, 1024 * 1024, 64 * 1024 * 1024});
@@ -0,0 +1,192 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "benchmark.hpp"
+
+#include "vpux/compiler/dialect/VPU/passes.hpp"
+#include "vpux/compiler/init.hpp"
+#include "vpux/compiler/pipelines.hpp"
+
+#include "vpux/utils/core/format.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Parser.h>
+#include <mlir/Pass/PassInstrumentation.h>
+#include <mlir/Pass/PassManager.h>
+
+#include <llvm/Support/raw_ostream.h>
+
+#include <chrono>
+#include <map>
+
+using namespace vpux;
+using namespace vpux::bench;
+
+namespace {
+
+//
+// Synthetic network
+//
+
+// Chain of 3x3 convolutions with ReLU activations and a residual connection every 4 layers.
+// The number of layers is the size parameter of the benchmarks.
+std::string buildSyntheticNetwork(int64_t numLayers) {
+    constexpr llvm::StringLiteral tensorType = "tensor<1x16x32x32xf32>";
+
+    std::string str;
+    llvm::raw_string_ostream stream(str);
+
+    stream << "module @Synthetic {\n";
+    stream << "  IE.CNNNetwork entryPoint : @main\n";
+    stream << "  inputsInfo : {\n";
+    stream << "    DataInfo \"input\" : tensor<1x16x32x32xf16>\n";
+    stream << "  } outputsInfo : {\n";
+    stream << "    DataInfo \"output\" : tensor<1x16x32x32xf16>\n";
+    stream << "  }\n";
+    stream << "  func @main(%arg0: " << tensorType << ") -> " << tensorType << " {\n";
+
+    std::string last = "%arg0";
+    std::string residual = last;
+
+    for (int64_t i = 0; i < numLayers; ++i) {
+        stream << printToString("    %cst{0} = const.Declare tensor<16x16x3x3xf32> = "
+                                "dense<{1}> : tensor<16x16x3x3xf32>\n",
+                                i, 0.01 * static_cast<double>(i % 7 + 1));
+        stream << printToString("    %conv{0} = IE.Convolution({1}, %cst{0}) {{dilations = [1, 1], "
+                                "pads_begin = [1, 1], pads_end = [1, 1], strides = [1, 1]} : {2}, "
+                                "tensor<16x16x3x3xf32> -> {2}\n",
+                                i, last, tensorType);
+        stream << printToString("    %relu{0} = IE.ReLU(%conv{0}) : {1} -> {1}\n", i, tensorType);
+        last = printToString("%relu{0}", i);
+
+        if (i % 4 == 3) {
+            stream << printToString("    %add{0} = IE.Add({1}, {2}) {{auto_broadcast = \"NUMPY\"} : {3}, {3} -> {3}\n",
+                                    i, last, residual, tensorType);
+            last = printToString("%add{0}", i);
+            residual = last;
+        }
+    }
+
+    stream << "    return " << last << " : " << tensorType << "\n";
+    stream << "  }\n";
+    stream << "}\n";
+
+    return stream.str();
+}
+
+//
+// PassTimer
+//
+
+// Lightweight instrumentation to report the time of the hot components, which are run as a part of the pipeline.
+// The contexts are single-threaded, so the passes are never run concurrently.
+class PassTimer final : public mlir::PassInstrumentation {
+public:
+    explicit PassTimer(std::map<std::string, std::chrono::nanoseconds>& times): _times(times) {
+    }
+
+    void runBeforePass(mlir::Pass* pass, mlir::Operation*) final {
+        if (_times.count(pass->getArgument().str()) != 0) {
+            _startTime = std::chrono::steady_clock::now();
+        }
+    }
+
+    void runAfterPass(mlir::Pass* pass, mlir::Operation*) final {
+        const auto it = _times.find(pass->getArgument().str());
+        if (it != _times.end()) {
+            it->second += std::chrono::steady_clock::now() - _startTime;
+        }
+    }
+
+private:
+    std::map<std::string, std::chrono::nanoseconds>& _times;
+    std::chrono::steady_clock::time_point _startTime;
+};
+
+//
+// Pipeline benchmarks
+//
+
+using PipelineBuilder = void (*)(mlir::OpPassManager& pm);
+
+void runPipelineBenchmark(State& state, PipelineBuilder buildPipeline) {
+    mlir::DialectRegistry registry;
+    registerDialects(registry);
+
+    mlir::MLIRContext ctx(registry);
+    ctx.disableMultithreading();
+
+    const auto networkStr = buildSyntheticNetwork(state.arg());
+
+    std::map<std::string, std::chrono::nanoseconds> passTimes = {
+            {"feasible-allocation", {}},     {"static-allocation", {}},        {"linearization", {}},
+            {"assign-virtual-barriers", {}}, {"assign-physical-barriers", {}},
+    };
+
+    while (state.keepRunning()) {
+        // Each iteration compiles its own copy of the network, the parsing is not a part of the measurement
+        state.pauseTiming();
+        auto module = mlir::parseSourceString(networkStr, &ctx);
+        if (module.get() == nullptr) {
+            state.skipWithError("Failed to parse the synthetic network");
+            break;
+        }
+
+        mlir::PassManager pm(&ctx, mlir::OpPassManager::Nesting::Implicit);
+        pm.addInstrumentation(std::make_unique<PassTimer>(passTimes));
+        buildPipeline(pm);
+        state.resumeTiming();
+
+        if (mlir::failed(pm.run(module.get()))) {
+            state.skipWithError("Compilation pipeline failed");
+            break;
+        }
+
+        state.pauseTiming();
+        module = nullptr;
+        state.resumeTiming();
+    }
+
+    if (state.iterations() == 0 || !state.error().empty()) {
+        return;
+    }
+
+    state.setItemsProcessed(state.iterations() * state.arg());
+
+    for (const auto& passTime : passTimes) {
+        if (passTime.second.count() != 0) {
+            const auto ms = std::chrono::duration<double, std::milli>(passTime.second).count();
+            state.setCounter(passTime.first + "_ms", ms / static_cast<double>(state.iterations()));
+        }
+    }
+}
+
+void DefaultHWModePipeline(State& state) {
+    runPipelineBenchmark(state, [](mlir::OpPassManager& pm) {
+        const auto options = DefaultHWOptions::createFromString("vpu-arch=VPUX30XX");
+        VPUX_THROW_UNLESS(options != nullptr, "Failed to parse DefaultHWOptions");
+
+        pm.addPass(VPU::createInitCompilerPass(VPU::ArchKind::VPUX30XX, VPU::CompilationMode::DefaultHW));
+        buildDefaultHWModePipeline(pm, *options, Logger::global());
+    });
+}
+
+void ReferenceSWModePipeline(State& state) {
+    runPipelineBenchmark(state, [](mlir::OpPassManager& pm) {
+        const auto options = ReferenceSWOptions::createFromString("vpu-arch=VPUX30XX");
+        VPUX_THROW_UNLESS(options != nullptr, "Failed to parse ReferenceSWOptions");
+
+        pm.addPass(VPU::createInitCompilerPass(VPU::ArchKind::VPUX30XX, VPU::CompilationMode::ReferenceSW));
+        buildReferenceSWModePipeline(pm, *options, Logger::global());
+    });
+}
+
+}  // namespace
+
+// The full pipelines are heavy, so they are run for a fixed number of iterations
+VPUX_BENCHMARK("DefaultHWModePipeline", DefaultHWModePipeline, {4, 16, 64}, 3);
+VPUX_BENCHMARK("ReferenceSWModePipeline", ReferenceSWModePipeline, {4, 16, 64}, 3);
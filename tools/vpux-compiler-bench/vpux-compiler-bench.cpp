@@ -0,0 +1,23 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "benchmark.hpp"
+
+#include <llvm/Support/InitLLVM.h>
+
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, char* argv[]) {
+    try {
+        llvm::InitLLVM initLLVM(argc, argv);
+        return vpux::bench::benchmarkMain(argc, argv, "VPUX Compiler Benchmarks");
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,249 @@
+//
+// Copyright (C) 2022 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "benchmark.hpp"
+
+#include "vpux/al/backend/repacking.hpp"
+#include "vpux/utils/IE/blob.hpp"
+#include "vpux/utils/core/format.hpp"
+
+#include <ie_layouts.h>
+#include <ie_precision.hpp>
+
+#include <sstream>
+#include <vector>
+
+using namespace vpux;
+using namespace vpux::bench;
+using namespace InferenceEngine;
+
+namespace {
+
+// The backends log every conversion, which is not a part of the measured path
+const Logger BENCH_LOG("vpux-host-bench", LogLevel::None);
+
+// The concurrent callers, like several infer requests of the same network
+const std::vector<int64_t> THREADS = {1, 2, 4, 8};
+
+// Spatial size of the image like tensors
+const std::vector<int64_t> SIZES = {224, 512, 1024};
+
+// All precisions supported by cvtBlobPrecision
+const std::vector<Precision> PRECISIONS = {
+        Precision::FP64, Precision::FP32, Precision::FP16, Precision::BF16, Precision::U64, Precision::I64,
+        Precision::U32,  Precision::I32,  Precision::U16,  Precision::I16,  Precision::U8,  Precision::I8,
+};
+
+// Pairs of the user and the device layouts, which require the repacking
+const std::vector<std::pair<Layout, Layout>> LAYOUTS = {
+        {Layout::NCHW, Layout::NHWC},
+        {Layout::NHWC, Layout::NCHW},
+        {Layout::CHW, Layout::HWC},
+        {Layout::HWC, Layout::CHW},
+        {Layout::NCDHW, Layout::NDHWC},
+        {Layout::NDHWC, Layout::NCDHW},
+};
+
+SizeVector getDims(Layout layout, int64_t size) {
+    const auto s = static_cast<size_t>(size);
+    switch (layout) {
+    case Layout::CHW:
+    case Layout::HWC:
+        return {3, s, s};
+    case Layout::NCDHW:
+    case Layout::NDHWC:
+        return {1, 3, 8, s / 2, s / 2};
+    default:
+        return {1, 3, s, s};
+    }
+}
+
+std::string getName(Layout layout) {
+    std::ostringstream stream;
+    stream << layout;
+    return stream.str();
+}
+
+// Small integer values are exactly representable in all precisions, so no conversion is out of range
+MemoryBlob::Ptr makeInputBlob(const TensorDesc& desc) {
+    const auto fp32Blob = makeBlob(TensorDesc(Precision::FP32, desc.getDims(), desc.getLayout()));
+    {
+        const auto mem = fp32Blob->wmap();
+        const auto ptr = mem.as<float*>();
+        for (size_t i = 0; i < fp32Blob->size(); ++i) {
+            ptr[i] = static_cast<float>(i % 101);
+        }
+    }
+
+    return desc.getPrecision() == Precision::FP32 ? fp32Blob : toPrecision(fp32Blob, desc.getPrecision());
+}
+
+//
+// ToPrecision
+//
+
+void ToPrecision(State& state, Precision inPrecision, Precision outPrecision) {
+    const auto inBlob = makeInputBlob(TensorDesc(inPrecision, getDims(Layout::NCHW, state.arg()), Layout::NCHW));
+    std::vector<uint8_t> outBuffer(inBlob->size() * outPrecision.size());
+
+    while (state.keepRunning()) {
+        toPrecision(inBlob, outPrecision, None, nullptr, outBuffer.data());
+    }
+
+    state.setItemsProcessed(state.iterations() * static_cast<int64_t>(inBlob->size()));
+    state.setBytesProcessed(state.iterations() * static_cast<int64_t>(inBlob->byteSize() + outBuffer.size()));
+}
+
+// FP32 / FP16 to U8 with the plugin side quantization
+void ToPrecisionQuantized(State& state, Precision inPrecision) {
+    const auto inBlob = makeInputBlob(TensorDesc(inPrecision, getDims(Layout::NCHW, state.arg()), Layout::NCHW));
+    std::vector<uint8_t> outBuffer(inBlob->size());
+    const auto quantParams = QuantizationParam(0.5f, 128);
+
+    while (state.keepRunning()) {
+        toPrecision(inBlob, Precision::U8, quantParams, nullptr, outBuffer.data());
+    }
+
+    state.setItemsProcessed(state.iterations() * static_cast<int64_t>(inBlob->size()));
+    state.setBytesProcessed(state.iterations() * static_cast<int64_t>(inBlob->byteSize() + outBuffer.size()));
+}
+
+//
+// ToLayout
+//
+
+void ToLayout(State& state, Precision precision, Layout inLayout, Layout outLayout) {
+    const auto inBlob = makeInputBlob(TensorDesc(precision, getDims(inLayout, state.arg()), inLayout));
+    std::vector<uint8_t> outBuffer(inBlob->byteSize());
+
+    while (state.keepRunning()) {
+        toLayout(inBlob, outLayout, nullptr, outBuffer.data());
+    }
+
+    state.setItemsProcessed(state.iterations() * static_cast<int64_t>(inBlob->size()));
+    state.setBytesProcessed(state.iterations() * static_cast<int64_t>(2 * inBlob->byteSize()));
+}
+
+//
+// Backend repacking paths
+//
+
+// The input preparation of the Level Zero executor, the result is written directly into the device buffer
+void ZeroPrepareInput(State& state, Precision userPrecision, Precision devicePrecision) {
+    const auto dims = getDims(Layout::NCHW, state.arg());
+    const auto userBlob = makeInputBlob(TensorDesc(userPrecision, dims, Layout::NCHW));
+    const auto deviceDesc = TensorDesc(devicePrecision, dims, Layout::NHWC);
+    std::vector<uint8_t> deviceBuffer(userBlob->size() * devicePrecision.size());
+
+    while (state.keepRunning()) {
+        prepareInputForInference(userBlob, deviceDesc, deviceBuffer.data(), None, BENCH_LOG);
+    }
+
+    state.setItemsProcessed(state.iterations() * static_cast<int64_t>(userBlob->size()));
+}
+
+// The input repacking of the emulator executor, each conversion allocates its result
+void EmulatorRepackTensor(State& state, Precision userPrecision, Precision devicePrecision) {
+    const auto dims = getDims(Layout::NCHW, state.arg());
+    const auto userBlob = makeInputBlob(TensorDesc(userPrecision, dims, Layout::NCHW));
+    const auto deviceDesc = TensorDesc(devicePrecision, dims, Layout::NHWC);
+
+    while (state.keepRunning()) {
+        repackTensor(userBlob, deviceDesc, BENCH_LOG);
+    }
+
+    state.setItemsProcessed(state.iterations() * static_cast<int64_t>(userBlob->size()));
+}
+
+//
+// Blob creation and copying
+//
+
+void MakeSplatBlob(State& state, Precision precision) {
+    const auto desc = TensorDesc(precision, getDims(Layout::NCHW, state.arg()), Layout::NCHW);
+
+    while (state.keepRunning()) {
+        makeSplatBlob(desc, 1.0);
+    }
+
+    state.setBytesProcessed(state.iterations() * static_cast<int64_t>(getMemorySize(desc).count()));
+}
+
+void CopyBlob(State& state) {
+    const auto inBlob = makeInputBlob(TensorDesc(Precision::FP32, getDims(Layout::NCHW, state.arg()), Layout::NCHW));
+    const auto outBlob = makeBlob(inBlob->getTensorDesc());
+
+    while (state.keepRunning()) {
+        copyBlob(inBlob, outBlob);
+    }
+
+    state.setBytesProcessed(state.iterations() * static_cast<int64_t>(2 * inBlob->byteSize()));
+}
+
+//
+// Registration
+//
+
+void addBenchmark(std::string name, BenchmarkFunc func, std::vector<int64_t> threads = THREADS) {
+    getRegisteredBenchmarks().push_back(Benchmark{std::move(name), std::move(func), SIZES, 0, std::move(threads)});
+}
+
+struct BlobBenchmarks final {
+    BlobBenchmarks() {
+        // The whole matrix of precisions is large, so the thread scaling is measured on the common cases only
+        for (const auto& inPrecision : PRECISIONS) {
+            for (const auto& outPrecision : PRECISIONS) {
+                if (inPrecision != outPrecision) {
+                    addBenchmark(
+                            printToString("ToPrecision/{0}_{1}", inPrecision.name(), outPrecision.name()),
+                            [=](State& state) {
+                                ToPrecision(state, inPrecision, outPrecision);
+                            },
+                            {1});
+                }
+            }
+        }
+
+        for (const auto& inPrecision : {Precision::FP32, Precision::FP16}) {
+            addBenchmark(printToString("ToPrecisionQuantized/{0}_U8", inPrecision.name()), [=](State& state) {
+                ToPrecisionQuantized(state, inPrecision);
+            });
+        }
+
+        for (const auto& precision : {Precision::FP32, Precision::FP16, Precision::U8}) {
+            for (const auto& layouts : LAYOUTS) {
+                addBenchmark(printToString("ToLayout/{0}/{1}_{2}", precision.name(), getName(layouts.first),
+                                           getName(layouts.second)),
+                             [=](State& state) {
+                                 ToLayout(state, precision, layouts.first, layouts.second);
+                             });
+            }
+        }
+
+        // The user precisions of the typical networks with FP16 device inputs
+        for (const auto& userPrecision : {Precision::FP32, Precision::U8}) {
+            addBenchmark(printToString("ZeroPrepareInput/{0}_FP16", userPrecision.name()), [=](State& state) {
+                ZeroPrepareInput(state, userPrecision, Precision::FP16);
+            });
+            addBenchmark(printToString("EmulatorRepackTensor/{0}_FP16", userPrecision.name()), [=](State& state) {
+                EmulatorRepackTensor(state, userPrecision, Precision::FP16);
+            });
+        }
+
+        for (const auto& precision : {Precision::FP32, Precision::FP16, Precision::U8}) {
+            addBenchmark(printToString("MakeSplatBlob/{0}", precision.name()), [=](State& state) {
+                MakeSplatBlob(state, precision);
+            });
+        }
+
+        addBenchmark("CopyBlob", CopyBlob);
+    }
+};
+
+BlobBenchmarks blobBenchmarks;
+
+}  // namespace
@@ -7,12 +7,18 @@
 
 #include "vpux/compiler/dialect/ELF/export.hpp"
 #include "vpux/compiler/dialect/ELF/import.hpp"
+#include "vpux/compiler/dialect/VPUIP/graph-schema/export.hpp"
 #include "vpux/compiler/dialect/VPUIP/graph-schema/import.hpp"
+#include "vpux/compiler/dialect/VPUIP/graph-schema/weights_segment.hpp"
+#include "vpux/compiler/dialect/const/utils/content.hpp"
 #include "vpux/compiler/frontend/IE.hpp"
 #include "vpux/compiler/init.hpp"
+#include "vpux/compiler/utils/compile_telemetry.hpp"
 #include "vpux/hwtest/hwtest.hpp"
 
+#include "vpux/utils/core/checked_cast.hpp"
 #include "vpux/utils/core/format.hpp"
+#include "vpux/utils/core/numeric.hpp"
 
 // TODO: E66812, it should be sufficient to have warnings disabled for 3-rd parties
 // in CMake but it does not work for early versions of MSVC 2019
@@ -56,6 +62,30 @@ llvm::cl::opt<bool> enableDummyOpReplacement{"dummy-op-replacement",
                                              llvm::cl::desc("Replace unsupported SW Kernel ops with Dummy ones"),
                                              llvm::cl::init(false)};
 
+llvm::cl::opt<bool> outOfLineWeights("vpux-out-of-line-weights",
+                                      llvm::cl::desc("Store the constants of the exported VPUIP blob in the weights "
+                                                     "segment instead of the blob itself"),
+                                      llvm::cl::init(false));
+
+llvm::cl::opt<std::string> weightsFile("vpux-weights-file",
+                                       llvm::cl::desc("Sidecar weights segment file for the VPUIP blob, the segment "
+                                                      "is appended to the blob, if it is not set"),
+                                       llvm::cl::init(""));
+
+llvm::cl::opt<std::string> telemetryFile("vpux-telemetry-file",
+                                         llvm::cl::desc("Write the time and memory statistics of the translation "
+                                                        "to the JSON file"),
+                                         llvm::cl::init(""));
+
+CompileTelemetry* getTelemetry() {
+    if (telemetryFile.empty()) {
+        return nullptr;
+    }
+
+    static CompileTelemetry telemetry;
+    return &telemetry;
+}
+
 //
 // import-IE
 //
@@ -98,8 +128,10 @@ mlir::OwningOpRef<mlir::ModuleOp> importIE(llvm::SourceMgr& sourceMgr, mlir::MLI
         // For VPUX37XX the ngraph transformations are different compared to the rest of the platforms
         // because scales do not need to be aligned. Running with VPU::ArchKind::UNKNOWN will align scales, which can
         // result in an accuracy drop for VPUX37XX.
+        TelemetryScope importTelemetry(getTelemetry(), "import-IE");
         module = IE::importNetwork(ctx, cnnNet, preProcInfo, false, rootTiming, vpuxProfiling, enableDummyOpReplacement,
                                    VPU::ArchKind::UNKNOWN);
+        importTelemetry.setOperation(module.get());
     } catch (const std::exception& ex) {
         printTo(llvm::errs(), "Failed to translate IE IR {0} to MLIR : {1}", netFileName, ex.what());
         return nullptr;
@@ -136,7 +168,14 @@ mlir::OwningOpRef<mlir::ModuleOp> importVPUIP(llvm::SourceMgr& sourceMgr, mlir::
     auto blob = std::vector<char>(std::istreambuf_iterator<char>(blobStream), std::istreambuf_iterator<char>());
 
     try {
-        module = VPUIP::importBlob(ctx, blob);
+        TelemetryScope importTelemetry(getTelemetry(), "import-VPUIP");
+        if (weightsFile.empty()) {
+            module = VPUIP::importBlob(ctx, blob);
+        } else {
+            const VPUIP::WeightsSegmentReader weights(weightsFile.getValue());
+            module = VPUIP::importBlob(ctx, blob, weights);
+        }
+        importTelemetry.setOperation(module.get());
     } catch (const std::exception& ex) {
         printTo(llvm::errs(), "Failed to translate blob {0} to MLIR : {1}", blobFileName, ex.what());
         return nullptr;
@@ -171,7 +210,9 @@ mlir::OwningOpRef<mlir::ModuleOp> importELF(llvm::SourceMgr& sourceMgr, mlir::ML
     mlir::OwningOpRef<mlir::ModuleOp> module;
 
     try {
+        TelemetryScope importTelemetry(getTelemetry(), "import-ELF");
         module = ELF::importELF(ctx, elfFileName.str());
+        importTelemetry.setOperation(module.get());
     } catch (const std::exception& ex) {
         printTo(llvm::errs(), "Failed to translate elf {0} to MLIR : {1}", elfFileName, ex.what());
         return nullptr;
@@ -184,7 +225,58 @@ mlir::OwningOpRef<mlir::ModuleOp> importELF(llvm::SourceMgr& sourceMgr, mlir::ML
 // export-VPUIP
 //
 
+mlir::LogicalResult exportVPUIP(mlir::ModuleOp module, llvm::raw_ostream& output, StringRef /*outputFileName*/) {
+    TelemetryScope exportTelemetry(getTelemetry(), "export-VPUIP", module);
+    mlir::DefaultTimingManager tm;
+    auto rootTiming = tm.getRootScope();
+    const std::vector<vpux::PreProcessInfo> preProcInfo;
+    const std::vector<std::shared_ptr<const ov::Node>> parameters;
+    const std::vector<std::shared_ptr<const ov::Node>> results;
+
+    if (!outOfLineWeights) {
+        const auto buf = VPUIP::exportToBlob(module, rootTiming, preProcInfo, parameters, results);
+        output.write(reinterpret_cast<const char*>(buf.data()), buf.size());
+
+        const auto predictedCycles = VPUIP::exportPredictedCycles(module);
+        output.write(predictedCycles.data(), predictedCycles.size());
+        return mlir::success();
+    }
+
+    VPUIP::WeightsSegmentWriter weights;
+    const auto buf = VPUIP::exportToBlob(module, rootTiming, preProcInfo, parameters, results, weights);
+    output.write(reinterpret_cast<const char*>(buf.data()), buf.size());
+
+    if (!weightsFile.empty()) {
+        const auto predictedCycles = VPUIP::exportPredictedCycles(module);
+        output.write(predictedCycles.data(), predictedCycles.size());
+
+        std::error_code ec;
+        llvm::raw_fd_ostream weightsStream(weightsFile.getValue(), ec);
+        if (ec) {
+            printTo(llvm::errs(), "Failed to open weights file {0} : {1}", weightsFile.getValue(), ec.message());
+            return mlir::failure();
+        }
+
+        weights.write(weightsStream, Const::getFoldingExecPolicy(module.getContext()));
+        return mlir::success();
+    }
+
+    // Keep the trailing segment aligned inside the blob, so the entries are aligned in the mapped blob as well.
+    // The predicted cycles segment is placed in between, its size is aligned for that.
+    const auto paddingSize = alignVal<size_t>(buf.size(), VPUIP::WEIGHTS_SEGMENT_DEFAULT_ALIGNMENT) - buf.size();
+    output.write_zeros(checked_cast<unsigned>(paddingSize));
+    const auto predictedCycles = VPUIP::exportPredictedCycles(module, VPUIP::WEIGHTS_SEGMENT_DEFAULT_ALIGNMENT);
+    output.write(predictedCycles.data(), predictedCycles.size());
+    weights.write(output, Const::getFoldingExecPolicy(module.getContext()));
+    return mlir::success();
+}
+
+//
+// export-ELF
+//
+
 mlir::LogicalResult exportELF(mlir::ModuleOp module, llvm::raw_ostream& output, StringRef /*outputFileName*/) {
+    TelemetryScope exportTelemetry(getTelemetry(), "export-ELF", module);
     mlir::DefaultTimingManager tm;
     const auto buf = ELF::exportToELF(module);
     output.write(reinterpret_cast<const char*>(buf.data()), buf.size());
@@ -247,10 +339,17 @@ int main(int argc, char* argv[]) {
         mlir::TranslateToMLIRRegistration("import-HWTEST", importHWTEST);
         mlir::TranslateToMLIRRegistration("import-VPUIP", importVPUIP);
         mlir::TranslateToMLIRRegistration("import-ELF", importELF);
+        mlir::TranslateFromMLIRRegistration("export-VPUIP", exportVPUIP, registerDialects);
         mlir::TranslateFromMLIRRegistration("export-ELF", exportELF, registerDialects);
         mlir::TranslateFromMLIRRegistration("export-LLVMIR", exportLLVMIR, registerDialects);
 
-        return mlir::asMainReturnCode(mlir::mlirTranslateMain(argc, argv, "VPUX Translation Testing Tool"));
+        const auto result = mlir::mlirTranslateMain(argc, argv, "VPUX Translation Testing Tool");
+
+        if (auto telemetry = getTelemetry()) {
+            telemetry->writeToFile(telemetryFile.getValue());
+        }
+
+        return mlir::asMainReturnCode(result);
     } catch (const std::exception& e) {
         std::cerr << e.what() << std::endl;
         return EXIT_FAILURE;